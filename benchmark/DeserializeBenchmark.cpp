@@ -0,0 +1,101 @@
+/**
+ * @file DeserializeBenchmark.cpp
+ * @brief Lines/sec of record tokenizing and model deserialization
+ *
+ * Compares the allocating split()/trim() path the deserializers used to
+ * take with the splitView()/trimView() path they use now, then reports
+ * end-to-end deserialize() throughput per model.
+ *
+ * Usage: DeserializeBenchmark [lines]
+ */
+
+#include "common/Constants.h"
+#include "common/Utils.h"
+#include "model/Appointment.h"
+#include "model/Patient.h"
+#include "advance/Medicine.h"
+#include "advance/Prescription.h"
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace HMS;
+
+namespace
+{
+    const std::array<std::string_view, 4> SAMPLE_LINES = {
+        "APT001|patient1|D001|2024-06-15|09:00|Regular checkup|500000|1|completed|Patient in good health",
+        "P001|patient1|Nguyen Van A|0912345678|Male|1990-05-15|123 Le Loi St, District 1|Diabetes Type 2",
+        "MED001|Paracetamol|Acetaminophen|Pain Relief|PharmaCo|Pain medicine|5000|100|20|2026-12-31|Tablet|500mg",
+        "PRE001|APT001|patient1|D001|2024-03-15|Diagnosis|Notes|1|MED001:10:1 tablet daily:5 days:After meals"};
+
+    // Keeps results observable so the optimizer cannot drop the loops
+    volatile size_t g_sink = 0;
+
+    template <typename Fn>
+    void run(std::string_view label, size_t lines, Fn &&fn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < lines; ++i)
+        {
+            fn(SAMPLE_LINES[i % SAMPLE_LINES.size()]);
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << std::format("{:<34} {:>12.0f} lines/sec\n", label,
+                                 static_cast<double>(lines) / elapsed.count());
+    }
+
+    template <typename Model>
+    void runDeserialize(std::string_view label, std::string_view line, size_t lines)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < lines; ++i)
+        {
+            auto result = Model::deserialize(line);
+            g_sink = g_sink + result.has_value();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << std::format("{:<34} {:>12.0f} lines/sec\n", label,
+                                 static_cast<double>(lines) / elapsed.count());
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    size_t lines = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    std::cout << std::format("Tokenizing {} lines\n", lines);
+
+    run("split + trim (allocating)", lines, [](std::string_view line)
+        {
+            auto parts = Utils::split(line, Constants::FIELD_DELIMITER);
+            size_t total = 0;
+            for (const auto &part : parts)
+                total += Utils::trim(part).size();
+            g_sink = g_sink + total; });
+
+    run("splitView + trimView", lines, [](std::string_view line)
+        {
+            std::array<std::string_view, 12> parts;
+            size_t count = Utils::splitView(line, Constants::FIELD_DELIMITER, parts);
+            size_t total = 0;
+            for (size_t i = 0; i < count && i < parts.size(); ++i)
+                total += Utils::trimView(parts[i]).size();
+            g_sink = g_sink + total; });
+
+    std::cout << std::format("\nDeserializing {} lines per model\n", lines);
+    runDeserialize<Model::Appointment>("Appointment::deserialize", SAMPLE_LINES[0], lines);
+    runDeserialize<Model::Patient>("Patient::deserialize", SAMPLE_LINES[1], lines);
+    runDeserialize<Model::Medicine>("Medicine::deserialize", SAMPLE_LINES[2], lines);
+    runDeserialize<Model::Prescription>("Prescription::deserialize", SAMPLE_LINES[3], lines);
+
+    return 0;
+}
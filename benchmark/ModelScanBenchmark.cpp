@@ -0,0 +1,137 @@
+/**
+ * @file ModelScanBenchmark.cpp
+ * @brief Rows/sec of predicate scans over model records
+ *
+ * Compares predicates that copy getter results into std::string (what
+ * by-value getters cost every row) with predicates that compare through
+ * the const-reference getters directly, for the filters the repositories
+ * run most: appointments by doctor and date, prescriptions by medicine,
+ * and case-insensitive medicine name search.
+ *
+ * Usage: ModelScanBenchmark [rows] [passes]
+ */
+
+#include "common/Utils.h"
+#include "model/Appointment.h"
+#include "advance/Medicine.h"
+#include "advance/Prescription.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace HMS;
+
+namespace
+{
+    // Keeps results observable so the optimizer cannot drop the loops
+    volatile size_t g_sink = 0;
+
+    template <typename T, typename Pred>
+    void run(std::string_view label, const std::vector<T> &rows, size_t passes, Pred &&pred)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t pass = 0; pass < passes; ++pass)
+        {
+            g_sink = g_sink + static_cast<size_t>(std::ranges::count_if(rows, pred));
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << std::format("{:<40} {:>14.0f} rows/sec\n", label,
+                                 static_cast<double>(rows.size() * passes) / elapsed.count());
+    }
+
+    std::string makeId(const char *prefix, size_t n)
+    {
+        return std::format("{}{:06}", prefix, n);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    size_t rows = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    size_t passes = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 20;
+
+    std::vector<Model::Appointment> appointments;
+    std::vector<Model::Prescription> prescriptions;
+    std::vector<Model::Medicine> medicines;
+    appointments.reserve(rows);
+    prescriptions.reserve(rows);
+    medicines.reserve(rows);
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+        // Realistic field lengths, long enough to defeat the small-string buffer
+        std::string date = std::format("2024-{:02}-{:02}", i % 12 + 1, i % 28 + 1);
+        appointments.emplace_back(makeId("APT", i), makeId("patient_user_", i % 5000),
+                                  makeId("D", i % 200), date, "09:00",
+                                  "Routine follow-up examination", 500000.0,
+                                  false, AppointmentStatus::SCHEDULED, "");
+
+        Model::Prescription presc(makeId("PRE", i), makeId("APT", i),
+                                  makeId("patient_user_", i % 5000), makeId("D", i % 200), date);
+        for (size_t item = 0; item < 3; ++item)
+        {
+            presc.addItem(Model::PrescriptionItem{makeId("MED", (i + item) % 1000), "Paracetamol",
+                                                  10, "1 tablet daily", "5 days", "After meals"});
+        }
+        prescriptions.push_back(std::move(presc));
+
+        medicines.emplace_back(makeId("MED", i), std::format("Paracetamol Extended Release {}", i),
+                               "Pain Relief", 5000.0, 100);
+    }
+
+    const std::string doctorID = makeId("D", 42);
+    const std::string fromDate = "2024-03-01";
+    const std::string toDate = "2024-06-30";
+    const std::string medicineID = makeId("MED", 7);
+
+    std::cout << std::format("Scanning {} rows x {} passes\n", rows, passes);
+
+    run("appointments: copied getters", appointments, passes,
+        [&](const Model::Appointment &a)
+        {
+            std::string doctor = a.getDoctorID();
+            std::string date = a.getDate();
+            return doctor == doctorID && date >= fromDate && date <= toDate;
+        });
+    run("appointments: reference getters", appointments, passes,
+        [&](const Model::Appointment &a)
+        {
+            const std::string &date = a.getDate();
+            return a.getDoctorID() == doctorID && date >= fromDate && date <= toDate;
+        });
+
+    run("prescriptions: copied items", prescriptions, passes,
+        [&](const Model::Prescription &p)
+        {
+            std::vector<Model::PrescriptionItem> items = p.getItems();
+            return std::ranges::any_of(items, [&](const auto &item)
+                                       { return item.medicineID == medicineID; });
+        });
+    run("prescriptions: referenced items", prescriptions, passes,
+        [&](const Model::Prescription &p)
+        {
+            return std::ranges::any_of(p.getItems(), [&](const auto &item)
+                                       { return item.medicineID == medicineID; });
+        });
+
+    run("medicine search: lowered copies", medicines, passes,
+        [](const Model::Medicine &m)
+        {
+            std::string name = m.getName();
+            return Utils::toLower(name).find(Utils::toLower("release 99")) != std::string::npos;
+        });
+    run("medicine search: in place", medicines, passes,
+        [](const Model::Medicine &m)
+        {
+            return Utils::containsIgnoreCase(m.getName(), "release 99");
+        });
+
+    return 0;
+}
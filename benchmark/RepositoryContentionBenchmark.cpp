@@ -0,0 +1,118 @@
+/**
+ * @file RepositoryContentionBenchmark.cpp
+ * @brief Reader throughput of a repository under concurrent writes
+ *
+ * Reader threads look patients up by ID and, every 100th operation, run a
+ * full name scan. A single writer keeps updating records meanwhile. The
+ * reader count doubles up to the hardware thread count; with shared
+ * locking, reader throughput should grow with it.
+ *
+ * Usage: RepositoryContentionBenchmark [patients] [millisecondsPerRun]
+ */
+
+#include "dal/PatientRepository.h"
+#include "model/Patient.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace HMS;
+
+namespace
+{
+    std::string patientID(size_t i)
+    {
+        return std::format("P{:06}", i);
+    }
+
+    Model::Patient makePatient(size_t i, const std::string &history)
+    {
+        return Model::Patient(patientID(i), std::format("patient{}", i),
+                              std::format("Patient {}", i), "0912345678", Gender::MALE,
+                              "1990-01-01", "Address", history);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    size_t patients = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5000;
+    auto runTime = std::chrono::milliseconds(argc > 2 ? std::strtoll(argv[2], nullptr, 10) : 1000);
+
+    // A test/fixtures/ path, as in the tests, keeps saves out of the backup store
+    const std::filesystem::path dataDir = std::filesystem::temp_directory_path() / "hms_contention";
+    std::filesystem::remove_all(dataDir);
+    std::filesystem::create_directories(dataDir / "test" / "fixtures");
+    const std::string dataFile = (dataDir / "test" / "fixtures" / "Patient.txt").string();
+
+    // Journal mode keeps each write to an append, so the lock is what is measured
+    DAL::PatientRepository *repo = DAL::PatientRepository::getInstance();
+    repo->setFilePath(dataFile);
+    repo->clear();
+    repo->setJournalEnabled(true);
+    for (size_t i = 0; i < patients; ++i)
+    {
+        repo->add(makePatient(i, "None"));
+    }
+
+    size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << std::format("{} patients, {} hardware threads, {} ms per run\n\n",
+                             patients, hardware, runTime.count());
+    std::cout << std::format("{:>8} {:>16} {:>16}\n", "readers", "reads/sec", "writes/sec");
+
+    for (size_t readers = 1; readers <= hardware * 2; readers *= 2)
+    {
+        std::atomic<bool> running{true};
+        std::atomic<size_t> reads{0};
+        std::atomic<size_t> writes{0};
+
+        std::vector<std::jthread> threads;
+        for (size_t r = 0; r < readers; ++r)
+        {
+            threads.emplace_back([&, r]
+                                 {
+                size_t local = 0;
+                size_t next = r;
+                while (running.load(std::memory_order_relaxed))
+                {
+                    if (local % 100 == 99)
+                        repo->searchByName("Patient 1");
+                    else
+                        repo->getById(patientID(next % patients));
+                    next += 7919;
+                    ++local;
+                }
+                reads += local; });
+        }
+
+        threads.emplace_back([&]
+                             {
+            size_t local = 0;
+            while (running.load(std::memory_order_relaxed))
+            {
+                repo->update(makePatient(local % patients, std::format("Visit {}", local)));
+                ++local;
+            }
+            writes += local; });
+
+        std::this_thread::sleep_for(runTime);
+        running = false;
+        threads.clear();
+
+        double seconds = std::chrono::duration<double>(runTime).count();
+        std::cout << std::format("{:>8} {:>16.0f} {:>16.0f}\n", readers,
+                                 static_cast<double>(reads) / seconds,
+                                 static_cast<double>(writes) / seconds);
+    }
+
+    repo->clear();
+    DAL::PatientRepository::resetInstance();
+    std::filesystem::remove_all(dataDir);
+    return 0;
+}
@@ -9,6 +9,7 @@
  */
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include "../common/Types.h"
 
@@ -67,43 +68,43 @@ namespace HMS
              * @brief Get department's unique ID
              * @return Department ID string
              */
-            std::string getDepartmentID() const;
+            const std::string &getDepartmentID() const;
 
             /**
              * @brief Get department name
              * @return Department name string
              */
-            std::string getName() const;
+            const std::string &getName() const;
 
             /**
              * @brief Get department description
              * @return Description string
              */
-            std::string getDescription() const;
+            const std::string &getDescription() const;
 
             /**
              * @brief Get head doctor's ID
              * @return Head doctor ID string
              */
-            std::string getHeadDoctorID() const;
+            const std::string &getHeadDoctorID() const;
 
             /**
              * @brief Get list of assigned doctor IDs
              * @return Vector of doctor ID strings
              */
-            std::vector<std::string> getDoctorIDs() const;
+            const std::vector<std::string> &getDoctorIDs() const;
 
             /**
              * @brief Get department location
              * @return Location string
              */
-            std::string getLocation() const;
+            const std::string &getLocation() const;
 
             /**
              * @brief Get department phone number
              * @return Phone number string
              */
-            std::string getPhone() const;
+            const std::string &getPhone() const;
 
             // ==================== Setters ====================
 
@@ -186,7 +187,7 @@ namespace HMS
              * @param line Pipe-delimited string from file
              * @return Department object or nullopt if parsing fails
              */
-            static Result<Department> deserialize(const std::string &line);
+            static Result<Department> deserialize(std::string_view line);
         };
 
     } // namespace Model
@@ -9,6 +9,7 @@
  */
 
 #include <string>
+#include <string_view>
 #include "../common/Types.h"
 
 namespace HMS
@@ -33,7 +34,7 @@ namespace HMS
             std::string m_category;        ///< Category (e.g., "Pain Relief", "Antibiotics")
             std::string m_manufacturer;    ///< Manufacturer name
             std::string m_description;     ///< Medicine description
-            double m_unitPrice = 0.0;      ///< Price per unit (VND)
+            Money m_unitPrice;             ///< Price per unit (VND)
             int m_quantityInStock = 0;     ///< Current stock quantity
             int m_reorderLevel = 0;        ///< Minimum stock level before reorder alert
             std::string m_expiryDate;      ///< Expiry date (YYYY-MM-DD format)
@@ -62,6 +63,18 @@ namespace HMS
                      double unitPrice,
                      int quantityInStock);
 
+            /**
+             * @brief Parameterized constructor with an exact unit price
+             * @param unitPrice Price per unit (kept as is, no double round trip)
+             *
+             * Other parameters as above.
+             */
+            Medicine(const std::string &medicineID,
+                     const std::string &name,
+                     const std::string &category,
+                     Money unitPrice,
+                     int quantityInStock);
+
             /**
              * @brief Destructor
              */
@@ -73,37 +86,37 @@ namespace HMS
              * @brief Get medicine's unique ID
              * @return Medicine ID string
              */
-            std::string getMedicineID() const;
+            const std::string &getMedicineID() const;
 
             /**
              * @brief Get medicine brand/trade name
              * @return Name string
              */
-            std::string getName() const;
+            const std::string &getName() const;
 
             /**
              * @brief Get medicine generic name
              * @return Generic name string
              */
-            std::string getGenericName() const;
+            const std::string &getGenericName() const;
 
             /**
              * @brief Get medicine category
              * @return Category string
              */
-            std::string getCategory() const;
+            const std::string &getCategory() const;
 
             /**
              * @brief Get manufacturer name
              * @return Manufacturer string
              */
-            std::string getManufacturer() const;
+            const std::string &getManufacturer() const;
 
             /**
              * @brief Get medicine description
              * @return Description string
              */
-            std::string getDescription() const;
+            const std::string &getDescription() const;
 
             /**
              * @brief Get unit price
@@ -111,6 +124,12 @@ namespace HMS
              */
             double getUnitPrice() const;
 
+            /**
+             * @brief Get unit price as an exact amount
+             * @return Price per unit (VND)
+             */
+            Money getUnitPriceValue() const;
+
             /**
              * @brief Get current stock quantity
              * @return Quantity in stock
@@ -127,19 +146,19 @@ namespace HMS
              * @brief Get expiry date
              * @return Expiry date string (YYYY-MM-DD)
              */
-            std::string getExpiryDate() const;
+            const std::string &getExpiryDate() const;
 
             /**
              * @brief Get dosage form
              * @return Dosage form string
              */
-            std::string getDosageForm() const;
+            const std::string &getDosageForm() const;
 
             /**
              * @brief Get medicine strength
              * @return Strength string
              */
-            std::string getStrength() const;
+            const std::string &getStrength() const;
 
             // ==================== Setters ====================
 
@@ -263,7 +282,7 @@ namespace HMS
              * @param line Pipe-delimited string from file
              * @return Medicine object or nullopt if parsing fails
              */
-            static Result<Medicine> deserialize(const std::string &line);
+            static Result<Medicine> deserialize(std::string_view line);
         };
 
     } // namespace Model
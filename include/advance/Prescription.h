@@ -9,8 +9,10 @@
  */
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include "../common/Types.h"
+#include "../common/InternTable.h"
 
 namespace HMS
 {
@@ -26,7 +28,7 @@ namespace HMS
          */
         struct PrescriptionItem
         {
-            std::string medicineID;    ///< Medicine identifier (e.g., "MED001")
+            InternedString medicineID; ///< Medicine identifier (e.g., "MED001")
             std::string medicineName;  ///< Medicine name for display
             int quantity;              ///< Quantity to dispense
             std::string dosage;        ///< Dosage instructions (e.g., "2 tablets, 3 times daily")
@@ -47,9 +49,10 @@ namespace HMS
         private:
             std::string m_prescriptionID;              ///< Unique prescription identifier (e.g., "PRE001")
             std::string m_appointmentID;               ///< Associated appointment ID
-            std::string m_patientUsername;             ///< Patient's account username
-            std::string m_doctorID;                    ///< Prescribing doctor's ID
+            InternedString m_patientUsername;          ///< Patient's account username
+            InternedString m_doctorID;                 ///< Prescribing doctor's ID
             std::string m_prescriptionDate;            ///< Date prescribed (YYYY-MM-DD)
+            Date m_prescriptionDateValue;              ///< Parsed m_prescriptionDate for range queries (invalid if malformed)
             std::vector<PrescriptionItem> m_items;     ///< List of prescribed medicine items
             std::string m_diagnosis;                   ///< Medical diagnosis
             std::string m_notes;                       ///< Additional notes
@@ -88,49 +91,67 @@ namespace HMS
              * @brief Get prescription's unique ID
              * @return Prescription ID string
              */
-            std::string getPrescriptionID() const;
+            const std::string &getPrescriptionID() const;
 
             /**
              * @brief Get associated appointment ID
              * @return Appointment ID string
              */
-            std::string getAppointmentID() const;
+            const std::string &getAppointmentID() const;
 
             /**
              * @brief Get patient's username
              * @return Patient username string
              */
-            std::string getPatientUsername() const;
+            const std::string &getPatientUsername() const;
 
             /**
              * @brief Get prescribing doctor's ID
              * @return Doctor ID string
              */
-            std::string getDoctorID() const;
+            const std::string &getDoctorID() const;
+
+            /**
+             * @brief Get patient's username as an interned handle
+             * @return Handle that compares by integer identity
+             */
+            const InternedString &getPatientHandle() const;
+
+            /**
+             * @brief Get prescribing doctor's ID as an interned handle
+             * @return Handle that compares by integer identity
+             */
+            const InternedString &getDoctorHandle() const;
 
             /**
              * @brief Get prescription date
              * @return Date string (YYYY-MM-DD)
              */
-            std::string getPrescriptionDate() const;
+            const std::string &getPrescriptionDate() const;
+
+            /**
+             * @brief Get prescription date in compact form
+             * @return Parsed date (invalid if the stored date is malformed)
+             */
+            Date getPrescriptionDateValue() const;
 
             /**
              * @brief Get list of prescribed items
              * @return Vector of PrescriptionItem
              */
-            std::vector<PrescriptionItem> getItems() const;
+            const std::vector<PrescriptionItem> &getItems() const;
 
             /**
              * @brief Get diagnosis
              * @return Diagnosis string
              */
-            std::string getDiagnosis() const;
+            const std::string &getDiagnosis() const;
 
             /**
              * @brief Get additional notes
              * @return Notes string
              */
-            std::string getNotes() const;
+            const std::string &getNotes() const;
 
             /**
              * @brief Check if prescription has been dispensed
@@ -211,7 +232,7 @@ namespace HMS
              * @param line Pipe-delimited string from file
              * @return Prescription object or nullopt if parsing fails
              */
-            static Result<Prescription> deserialize(const std::string &line);
+            static Result<Prescription> deserialize(std::string_view line);
         };
 
     } // namespace Model
@@ -230,6 +230,9 @@ public:
 
     /**
      * @brief Load all data from files
+     *
+     * The patient, doctor and appointment files are loaded concurrently.
+     *
      * @return True if successful
      */
     bool loadAllData();
@@ -314,7 +314,7 @@ private:
 
     /**
      * @brief Generate a new appointment ID
-     * @return New unique appointment ID
+     * @return New unique appointment ID, reserved so concurrent bookings never share it
      */
     std::string generateAppointmentID();
 
@@ -345,9 +345,9 @@ private:
      * @param paidRevenue Output: paid revenue
      * @param unpaidRevenue Output: unpaid revenue
      */
-    void calculateRevenueStatistics(double& totalRevenue,
-                                    double& paidRevenue,
-                                    double& unpaidRevenue);
+    void calculateRevenueStatistics(Money& totalRevenue,
+                                    Money& paidRevenue,
+                                    Money& unpaidRevenue);
 };
 
 } // namespace BLL
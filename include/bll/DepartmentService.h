@@ -2,6 +2,7 @@
 
 #include "../dal/DepartmentRepository.h"
 #include "../dal/DoctorRepository.h"
+#include "../dal/IdSequence.h"
 #include "../advance/Department.h"
 #include "../model/Doctor.h"
 #include "../common/Types.h"
@@ -235,15 +236,15 @@ public:
 
     /**
      * @brief Get statistics for all departments
-     * @return Map of department ID to statistics
+     * @return Map of department ID to statistics, in ID order (DEP999 before DEP1000)
      */
-    std::map<std::string, DepartmentStats> getAllDepartmentStats();
+    std::map<std::string, DepartmentStats, DAL::IdLess> getAllDepartmentStats();
 
     /**
      * @brief Get doctor count by department
-     * @return Map of department ID to doctor count
+     * @return Map of department ID to doctor count, in ID order
      */
-    std::map<std::string, int> getDoctorCountByDepartment();
+    std::map<std::string, int, DAL::IdLess> getDoctorCountByDepartment();
 
     // ==================== Validation ====================
 
@@ -125,6 +125,21 @@ public:
      */
     bool deleteMedicine(const std::string& medicineID);
 
+    /**
+     * @brief Create many medicines with one write
+     * @param medicines The medicines to add
+     * @return True if all were added; false (nothing added) if any is invalid
+     *         or its ID is already taken or repeated
+     */
+    bool createMedicines(const std::vector<Model::Medicine>& medicines);
+
+    /**
+     * @brief Create or update many medicines with one write
+     * @param medicines The medicines to store
+     * @return True if successful; false (nothing stored) if any is invalid
+     */
+    bool upsertMedicines(const std::vector<Model::Medicine>& medicines);
+
     // ==================== Query Operations ====================
 
     /**
@@ -107,6 +107,22 @@ public:
      */
     bool deletePatient(const std::string& patientID);
 
+    /**
+     * @brief Create many patient records with one write
+     * @param patients The patients to add
+     * @return True if all were added; false (nothing added) if any is invalid
+     *         or its ID or username is already taken or repeated
+     */
+    bool createPatients(const std::vector<Model::Patient>& patients);
+
+    /**
+     * @brief Create or update many patient records with one write
+     * @param patients The patients to store
+     * @return True if successful; false (nothing stored) if any is invalid
+     *         or uses a username held by another patient
+     */
+    bool upsertPatients(const std::vector<Model::Patient>& patients);
+
     // ==================== Query Operations ====================
 
     /**
@@ -96,7 +96,7 @@ public:
 
     /**
      * @brief Generate next prescription ID in sequence (PRE001, PRE002, ...)
-     * @return Next available prescription ID
+     * @return Next available prescription ID, reserved for the caller
      */
     std::string generateNextID();
 
@@ -250,6 +250,9 @@ public:
      * @brief Dispense a prescription (updates medicine inventory)
      * @param prescriptionID The prescription's ID
      * @return Dispense result with success status and details
+     *
+     * Stock deductions and the dispensed flag are committed as one unit
+     * of work: all of them or none, with one write per data file.
      */
     DispenseResult dispensePrescription(const std::string& prescriptionID);
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 namespace HMS {
@@ -30,6 +31,30 @@ constexpr const char* MEDICINE_FILE = PROJECT_SOURCE_DIR "/data/Medicine.txt";
 constexpr const char* PRESCRIPTION_FILE = PROJECT_SOURCE_DIR "/data/Prescription.txt";
 constexpr const char* REPORTS_DIR = PROJECT_SOURCE_DIR "/data/reports/";
 
+// Append-only mutation log kept next to each data file (e.g. Appointment.txt.journal)
+constexpr const char* JOURNAL_FILE_SUFFIX = ".journal";
+constexpr const char* JOURNAL_COMPACTING_SUFFIX = ".compacting";
+
+// Background snapshot thresholds for journaled repositories
+constexpr size_t JOURNAL_COMPACT_MAX_RECORDS = 5000;
+constexpr size_t JOURNAL_COMPACT_MAX_BYTES = 4 * 1024 * 1024;  // 4 MB
+
+// Backup index kept in BACKUP_DIR, and the default retention policy
+constexpr const char* BACKUP_INDEX_FILE = "backup.index";
+constexpr size_t BACKUP_KEEP_LAST = 10;
+constexpr size_t BACKUP_KEEP_HOURLY = 24;
+constexpr size_t BACKUP_KEEP_DAILY = 7;
+
+// Minimum time between two background backups of the same data file
+constexpr int BACKUP_INTERVAL_SECONDS = 60;
+
+// Default write-behind policy: flush after this delay or this many pending changes
+constexpr int WRITE_BEHIND_INTERVAL_MS = 1000;
+constexpr size_t WRITE_BEHIND_MAX_PENDING = 500;
+
+// Minimum lines per loader thread; smaller files are parsed on the calling thread
+constexpr size_t PARALLEL_LOAD_MIN_LINES = 2048;
+
 // ==================== Field Delimiters ====================
 constexpr char FIELD_DELIMITER = '|';
 constexpr char COMMENT_CHAR = '#';
@@ -37,6 +62,8 @@ constexpr char COMMENT_CHAR = '#';
 // ==================== Work Hours ====================
 constexpr int WORK_START_HOUR = 8;   // 8 AM
 constexpr int WORK_END_HOUR = 17;    // 5 PM
+constexpr int SLOT_DURATION_MINUTES = 30;
+constexpr int SLOTS_PER_DAY = (WORK_END_HOUR - WORK_START_HOUR) * 60 / SLOT_DURATION_MINUTES;
 
 // ==================== Validation Rules ====================
 constexpr int MIN_USERNAME_LENGTH = 3;
@@ -56,6 +83,9 @@ constexpr const char* DEPARTMENT_ID_PREFIX = "DEP";
 constexpr const char* MEDICINE_ID_PREFIX = "MED";
 constexpr const char* PRESCRIPTION_ID_PREFIX = "PRE";
 
+// IDs are zero-padded to at least this many digits and grow beyond it (D999 -> D1000)
+constexpr size_t ID_MIN_DIGITS = 3;
+
 // ==================== Medicine/Inventory Constants ====================
 constexpr int DEFAULT_REORDER_LEVEL = 10;
 constexpr int EXPIRY_WARNING_DAYS = 30;
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace HMS {
+
+/** Small integer handle of an interned identifier */
+using InternId = std::uint32_t;
+
+// ==================== Intern Table ====================
+
+/**
+ * @class InternTable
+ * @brief Process-wide table of unique identifier strings
+ *
+ * Each distinct string is stored once and given a small integer handle.
+ * Entries are never removed, so references to them stay valid for the
+ * lifetime of the process. Thread-safe; lookups of known strings only
+ * take a shared lock.
+ */
+class InternTable {
+public:
+    /** One interned string and its handle */
+    struct Entry {
+        std::string value;
+        InternId id;
+    };
+
+    /**
+     * @brief Get the process-wide table
+     * @return Table instance
+     */
+    static InternTable& instance();
+
+    InternTable(const InternTable&) = delete;
+    InternTable& operator=(const InternTable&) = delete;
+
+    /**
+     * @brief Get the entry for a string, adding it if new
+     * @param value String to intern
+     * @return Stable entry pointer
+     */
+    const Entry* intern(std::string_view value);
+
+    /**
+     * @brief Get the entry for a string without adding it
+     * @param value String to look up
+     * @return Entry pointer, or nullptr if the string was never interned
+     */
+    const Entry* find(std::string_view value) const;
+
+    /**
+     * @brief Get the entry of the empty string (handle 0)
+     */
+    const Entry* emptyEntry() const { return m_empty; }
+
+    /**
+     * @brief Number of distinct strings interned
+     */
+    size_t size() const;
+
+private:
+    InternTable();
+
+    mutable std::shared_mutex m_mutex;
+    std::deque<Entry> m_entries;                                  // Never shrinks: addresses are stable
+    std::unordered_map<std::string_view, const Entry*> m_lookup;  // Keys view into m_entries
+    const Entry* m_empty;
+};
+
+// ==================== Interned String ====================
+
+/**
+ * @class InternedString
+ * @brief Identifier stored as a handle into the InternTable
+ *
+ * Pointer-sized and trivially copyable. Equality between two interned
+ * strings compares handles, never characters. Reads as a
+ * const std::string& so it can stand in for the identifier it replaces.
+ */
+class InternedString {
+public:
+    InternedString() : m_entry(InternTable::instance().emptyEntry()) {}
+    InternedString(std::string_view value) : m_entry(InternTable::instance().intern(value)) {}
+    InternedString(const std::string& value) : InternedString(std::string_view(value)) {}
+    InternedString(const char* value) : InternedString(std::string_view(value)) {}
+
+    /**
+     * @brief Get the handle of an already interned string
+     * @param value String to look up
+     * @return Handle, or nullopt if no record uses this string (nothing can match it)
+     */
+    static std::optional<InternedString> lookup(std::string_view value) {
+        const InternTable::Entry* entry = InternTable::instance().find(value);
+        if (!entry) return std::nullopt;
+        return InternedString(entry);
+    }
+
+    const std::string& str() const { return m_entry->value; }
+    InternId id() const { return m_entry->id; }
+    bool empty() const { return m_entry->value.empty(); }
+
+    operator const std::string&() const { return m_entry->value; }
+
+    bool operator==(const InternedString& other) const { return m_entry == other.m_entry; }
+    bool operator==(std::string_view other) const { return m_entry->value == other; }
+    bool operator==(const std::string& other) const { return m_entry->value == other; }
+    bool operator==(const char* other) const { return m_entry->value == other; }
+
+    friend std::ostream& operator<<(std::ostream& os, const InternedString& str) {
+        return os << str.m_entry->value;
+    }
+
+private:
+    explicit InternedString(const InternTable::Entry* entry) : m_entry(entry) {}
+
+    const InternTable::Entry* m_entry;
+};
+
+} // namespace HMS
+
+template <>
+struct std::hash<HMS::InternedString> {
+    size_t operator()(const HMS::InternedString& str) const noexcept {
+        return std::hash<HMS::InternId>{}(str.id());
+    }
+};
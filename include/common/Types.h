@@ -1,6 +1,13 @@
 #pragma once
 
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <limits>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <optional>
 #include <memory>
@@ -90,14 +97,356 @@ inline Gender stringToGender(const std::string& str) {
     return Gender::UNKNOWN;
 }
 
+// ==================== Date / Time Types ====================
+
+/**
+ * @class Date
+ * @brief Calendar date stored as days since 1970-01-01
+ *
+ * Four bytes, ordered and subtractable as plain integers. Parses and
+ * formats the internal YYYY-MM-DD format; both are constexpr. A
+ * default-constructed Date is invalid and orders before every valid one.
+ */
+class Date {
+public:
+    constexpr Date() = default;
+
+    /**
+     * @brief Build a date from its calendar fields (no validation)
+     */
+    static constexpr Date fromCivil(int year, int month, int day) {
+        // Howard Hinnant's days_from_civil
+        year -= month <= 2;
+        const int era = (year >= 0 ? year : year - 399) / 400;
+        const int yoe = year - era * 400;
+        const int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+        const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return fromDays(era * 146097 + doe - 719468);
+    }
+
+    static constexpr Date fromDays(std::int32_t days) {
+        Date date;
+        date.m_days = days;
+        return date;
+    }
+
+    /**
+     * @brief Parse a YYYY-MM-DD date (years 1900-2100)
+     * @return Date, or nullopt if the text is not a valid internal date
+     */
+    static constexpr std::optional<Date> parse(std::string_view text) {
+        if (text.size() != 10 || text[4] != '-' || text[7] != '-') return std::nullopt;
+        for (size_t i = 0; i < 10; ++i) {
+            if (i != 4 && i != 7 && (text[i] < '0' || text[i] > '9')) return std::nullopt;
+        }
+
+        const int year = digits(text.substr(0, 4));
+        const int month = digits(text.substr(5, 2));
+        const int day = digits(text.substr(8, 2));
+        if (year < 1900 || year > 2100 || month < 1 || month > 12) return std::nullopt;
+        if (day < 1 || day > daysInMonth(month, year)) return std::nullopt;
+        return fromCivil(year, month, day);
+    }
+
+    /**
+     * @brief Number of days in a month (0 for an invalid month)
+     */
+    static constexpr int daysInMonth(int month, int year) {
+        constexpr int DAYS[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        if (month < 1 || month > 12) return 0;
+        const bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+        return month == 2 && leap ? 29 : DAYS[month - 1];
+    }
+
+    constexpr bool isValid() const { return m_days != INVALID; }
+    constexpr std::int32_t daysSinceEpoch() const { return m_days; }
+
+    constexpr int year() const { return civil().year; }
+    constexpr int month() const { return civil().month; }
+    constexpr int day() const { return civil().day; }
+
+    /**
+     * @brief Day of the week, Monday = 0 ... Sunday = 6
+     */
+    constexpr int weekday() const {
+        // 1970-01-01 was a Thursday
+        return static_cast<int>(((m_days % 7) + 7 + 3) % 7);
+    }
+
+    constexpr Date addDays(int days) const { return isValid() ? fromDays(m_days + days) : Date(); }
+
+    /** Days from other to this date */
+    constexpr int operator-(Date other) const { return m_days - other.m_days; }
+
+    constexpr auto operator<=>(const Date&) const = default;
+
+    /**
+     * @brief Format as YYYY-MM-DD without allocating
+     */
+    constexpr std::array<char, 10> toChars() const {
+        const Civil c = civil();
+        std::array<char, 10> out{};
+        writeDigits(out.data(), c.year, 4);
+        out[4] = '-';
+        writeDigits(out.data() + 5, c.month, 2);
+        out[7] = '-';
+        writeDigits(out.data() + 8, c.day, 2);
+        return out;
+    }
+
+    /**
+     * @brief Format as YYYY-MM-DD (empty for an invalid date)
+     */
+    std::string toString() const {
+        if (!isValid()) return {};
+        const auto chars = toChars();
+        return std::string(chars.data(), chars.size());
+    }
+
+private:
+    struct Civil {
+        int year;
+        int month;
+        int day;
+    };
+
+    // Howard Hinnant's civil_from_days
+    constexpr Civil civil() const {
+        const int z = m_days + 719468;
+        const int era = (z >= 0 ? z : z - 146096) / 146097;
+        const int doe = z - era * 146097;
+        const int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        const int mp = (5 * doy + 2) / 153;
+        const int day = doy - (153 * mp + 2) / 5 + 1;
+        const int month = mp < 10 ? mp + 3 : mp - 9;
+        return {yoe + era * 400 + (month <= 2), month, day};
+    }
+
+    static constexpr int digits(std::string_view text) {
+        int value = 0;
+        for (char ch : text) value = value * 10 + (ch - '0');
+        return value;
+    }
+
+    static constexpr void writeDigits(char* out, int value, int width) {
+        for (int i = width - 1; i >= 0; --i) {
+            out[i] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+    }
+
+    static constexpr std::int32_t INVALID = std::numeric_limits<std::int32_t>::min();
+    std::int32_t m_days = INVALID;
+};
+
+/**
+ * @class TimeOfDay
+ * @brief Clock time stored as minutes since midnight
+ *
+ * Two bytes; parses and formats HH:MM. A default-constructed TimeOfDay is
+ * invalid and orders after every valid one.
+ */
+class TimeOfDay {
+public:
+    constexpr TimeOfDay() = default;
+
+    static constexpr TimeOfDay fromMinutes(int minutes) {
+        TimeOfDay time;
+        time.m_minutes = static_cast<std::uint16_t>(minutes);
+        return time;
+    }
+
+    /**
+     * @brief Parse an HH:MM time (00:00-23:59)
+     * @return Time, or nullopt if the text is not a valid time
+     */
+    static constexpr std::optional<TimeOfDay> parse(std::string_view text) {
+        if (text.size() != 5 || text[2] != ':') return std::nullopt;
+        for (size_t i = 0; i < 5; ++i) {
+            if (i != 2 && (text[i] < '0' || text[i] > '9')) return std::nullopt;
+        }
+
+        const int hour = (text[0] - '0') * 10 + (text[1] - '0');
+        const int minute = (text[3] - '0') * 10 + (text[4] - '0');
+        if (hour > 23 || minute > 59) return std::nullopt;
+        return fromMinutes(hour * 60 + minute);
+    }
+
+    constexpr bool isValid() const { return m_minutes != INVALID; }
+    constexpr int minutes() const { return m_minutes; }
+    constexpr int hour() const { return m_minutes / 60; }
+    constexpr int minute() const { return m_minutes % 60; }
+
+    constexpr auto operator<=>(const TimeOfDay&) const = default;
+
+    /**
+     * @brief Format as HH:MM without allocating
+     */
+    constexpr std::array<char, 5> toChars() const {
+        return {static_cast<char>('0' + hour() / 10), static_cast<char>('0' + hour() % 10), ':',
+                static_cast<char>('0' + minute() / 10), static_cast<char>('0' + minute() % 10)};
+    }
+
+    /**
+     * @brief Format as HH:MM (empty for an invalid time)
+     */
+    std::string toString() const {
+        if (!isValid()) return {};
+        const auto chars = toChars();
+        return std::string(chars.data(), chars.size());
+    }
+
+private:
+    static constexpr std::uint16_t INVALID = std::numeric_limits<std::uint16_t>::max();
+    std::uint16_t m_minutes = INVALID;
+};
+
+static_assert(Date::parse("1970-01-01")->daysSinceEpoch() == 0);
+static_assert(Date::parse("2024-02-29")->addDays(1) == *Date::parse("2024-03-01"));
+static_assert(Date::parse("2024-06-17")->weekday() == 0); // Monday
+static_assert(!Date::parse("2023-02-29"));
+static_assert(TimeOfDay::parse("09:30")->minutes() == 570);
+
+// ==================== Money ====================
+
+/**
+ * @class Money
+ * @brief Exact fixed-point amount of VND
+ *
+ * Stored as a signed count of hundredths of a dong in an int64, so sums are
+ * exact and do not depend on the order in which amounts are added. Records
+ * are serialized exactly: whole dong as before, with ".NN" appended only
+ * when there is a fraction.
+ */
+class Money {
+public:
+    /** Minor units per dong */
+    static constexpr std::int64_t SCALE = 100;
+
+    constexpr Money() = default;
+
+    static constexpr Money fromMinor(std::int64_t minor) {
+        Money money;
+        money.m_minor = minor;
+        return money;
+    }
+
+    static constexpr Money fromUnits(std::int64_t units) { return fromMinor(units * SCALE); }
+
+    /**
+     * @brief Convert from a floating-point amount, rounded to the nearest minor unit
+     * @return Converted amount (zero for NaN or infinity)
+     */
+    static Money fromDouble(double amount) {
+        if (!std::isfinite(amount)) return {};
+        return fromMinor(std::llround(amount * SCALE));
+    }
+
+    /**
+     * @brief Parse a decimal amount such as "150000", "-5000" or "250000.50"
+     *
+     * Extra fraction digits are rounded half away from zero.
+     * @return Amount, or nullopt if the text is not a plain decimal number
+     */
+    static std::optional<Money> parse(std::string_view text) {
+        const bool negative = !text.empty() && text.front() == '-';
+        if (negative || (!text.empty() && text.front() == '+')) text.remove_prefix(1);
+
+        const size_t dot = text.find('.');
+        const std::string_view whole = text.substr(0, dot);
+        const std::string_view fraction =
+            dot == std::string_view::npos ? std::string_view() : text.substr(dot + 1);
+        if (whole.empty() && fraction.empty()) return std::nullopt;
+        if (!whole.empty() && (whole.front() == '-' || whole.front() == '+')) return std::nullopt;
+
+        std::int64_t units = 0;
+        if (!whole.empty()) {
+            auto [ptr, ec] = std::from_chars(whole.data(), whole.data() + whole.size(), units);
+            if (ec != std::errc() || ptr != whole.data() + whole.size()) return std::nullopt;
+            if (units > std::numeric_limits<std::int64_t>::max() / SCALE - 1) return std::nullopt;
+        }
+
+        std::int64_t minor = 0;
+        for (size_t i = 0; i < fraction.size(); ++i) {
+            const char c = fraction[i];
+            if (c < '0' || c > '9') return std::nullopt;
+            if (i < 2) minor = minor * 10 + (c - '0');
+            else if (i == 2 && c >= '5') ++minor;
+        }
+        if (fraction.size() == 1) minor *= 10;
+
+        const std::int64_t total = units * SCALE + minor;
+        return fromMinor(negative ? -total : total);
+    }
+
+    constexpr std::int64_t minorUnits() const { return m_minor; }
+
+    /** Whole dong, rounded half away from zero */
+    constexpr std::int64_t roundedUnits() const {
+        return (m_minor + (m_minor < 0 ? -SCALE / 2 : SCALE / 2)) / SCALE;
+    }
+
+    double toDouble() const { return static_cast<double>(m_minor) / SCALE; }
+
+    constexpr bool isNegative() const { return m_minor < 0; }
+    constexpr bool isZero() const { return m_minor == 0; }
+
+    constexpr Money operator+(Money other) const { return fromMinor(m_minor + other.m_minor); }
+    constexpr Money operator-(Money other) const { return fromMinor(m_minor - other.m_minor); }
+    constexpr Money operator-() const { return fromMinor(-m_minor); }
+    constexpr Money operator*(std::int64_t count) const { return fromMinor(m_minor * count); }
+    constexpr Money& operator+=(Money other) { m_minor += other.m_minor; return *this; }
+    constexpr Money& operator-=(Money other) { m_minor -= other.m_minor; return *this; }
+
+    constexpr auto operator<=>(const Money&) const = default;
+
+    /**
+     * @brief Write the exact amount without allocating
+     * @return std::to_chars result
+     */
+    std::to_chars_result toChars(char* first, char* last) const {
+        const std::uint64_t magnitude =
+            m_minor < 0 ? 0 - static_cast<std::uint64_t>(m_minor) : static_cast<std::uint64_t>(m_minor);
+        if (m_minor < 0) {
+            if (first == last) return {last, std::errc::value_too_large};
+            *first++ = '-';
+        }
+
+        auto result = std::to_chars(first, last, magnitude / SCALE);
+        const auto fraction = magnitude % SCALE;
+        if (result.ec != std::errc() || fraction == 0) return result;
+
+        if (last - result.ptr < 3) return {last, std::errc::value_too_large};
+        result.ptr[0] = '.';
+        result.ptr[1] = static_cast<char>('0' + fraction / 10);
+        result.ptr[2] = static_cast<char>('0' + fraction % 10);
+        return {result.ptr + 3, std::errc()};
+    }
+
+    /**
+     * @brief Format exactly, e.g. "150000" or "250000.50"
+     */
+    std::string toString() const {
+        std::array<char, 24> buffer;
+        auto [ptr, ec] = toChars(buffer.data(), buffer.data() + buffer.size());
+        return std::string(buffer.data(), ptr);
+    }
+
+private:
+    std::int64_t m_minor = 0;
+};
+
+static_assert(Money::fromUnits(150000).roundedUnits() == 150000);
+static_assert(Money::fromMinor(25000050).roundedUnits() == 250001);
+static_assert(Money::fromMinor(-150).roundedUnits() == -2);
+
 // ==================== Type Aliases ====================
 using ID = std::string;
 using Username = std::string;
 using PasswordHash = std::string;
-using Date = std::string;      // Format: YYYY-MM-DD
-using Time = std::string;      // Format: HH:MM
 using Phone = std::string;
-using Money = double;
+using SlotMask = std::uint64_t; // Bit i = i-th standard slot of the working day
 
 // Advanced Feature Type Aliases
 using DepartmentID = std::string;
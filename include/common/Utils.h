@@ -1,12 +1,15 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <span>
 #include <vector>
 #include <sstream>
 #include <chrono>
 #include <iomanip>
 #include <algorithm>
 #include <random>
+#include "Types.h"
 
 namespace HMS {
 namespace Utils {
@@ -19,7 +22,42 @@ namespace Utils {
  * @param delimiter The character to split by
  * @return Vector of substrings
  */
-std::vector<std::string> split(const std::string& str, char delimiter);
+std::vector<std::string> split(std::string_view str, char delimiter);
+
+/**
+ * @class FieldTokenizer
+ * @brief Allocation-free iterator over delimited fields
+ *
+ * Yields views into the input with the same rules as split(): a trailing
+ * delimiter produces a final empty field and an empty input has no fields.
+ * The input must outlive the tokenizer and every view it returns.
+ */
+class FieldTokenizer {
+public:
+    FieldTokenizer(std::string_view str, char delimiter);
+
+    /**
+     * @brief Advance to the next field
+     * @param field Receives the field view
+     * @return False once all fields have been consumed
+     */
+    bool next(std::string_view& field);
+
+private:
+    std::string_view m_str;
+    char m_delimiter;
+    size_t m_pos;
+    bool m_done;
+};
+
+/**
+ * @brief Split a string into views without allocating
+ * @param str The input string
+ * @param delimiter The character to split by
+ * @param fields Receives the first fields.size() fields
+ * @return Total number of fields in str (may exceed fields.size())
+ */
+size_t splitView(std::string_view str, char delimiter, std::span<std::string_view> fields);
 
 /**
  * @brief Join vector of strings with delimiter
@@ -34,7 +72,14 @@ std::string join(const std::vector<std::string>& parts, char delimiter);
  * @param str The input string
  * @return Trimmed string
  */
-std::string trim(const std::string& str);
+std::string trim(std::string_view str);
+
+/**
+ * @brief Trim whitespace from both ends of a view
+ * @param str The input view
+ * @return Sub-view of str without surrounding whitespace
+ */
+std::string_view trimView(std::string_view str);
 
 /**
  * @brief Convert string to lowercase
@@ -56,7 +101,7 @@ std::string toUpper(const std::string& str);
  * @param substr The substring to find
  * @return True if found
  */
-bool containsIgnoreCase(const std::string& str, const std::string& substr);
+bool containsIgnoreCase(std::string_view str, std::string_view substr);
 
 // ==================== Date/Time Utilities ====================
 
@@ -160,6 +205,20 @@ int getDaysInMonth(int month, int year);
  */
 bool getWeekRange(const std::string& date, std::string& startDate, std::string& endDate);
 
+/**
+ * @brief Get the position of a time in the standard appointment slot grid
+ * @param time Time in HH:MM format
+ * @return Slot index (0 = WORK_START_HOUR:00), or -1 if not a standard slot
+ */
+int getSlotIndex(const std::string& time);
+
+/**
+ * @brief Get the time of a standard appointment slot
+ * @param index Slot index (0 .. SLOTS_PER_DAY - 1)
+ * @return Time in HH:MM format
+ */
+std::string getSlotTime(int index);
+
 // ==================== ID Generation ====================
 
 /**
@@ -251,6 +310,13 @@ bool isValidMoney(const std::string& str);
  */
 std::string formatMoney(double amount);
 
+/**
+ * @brief Format an exact money amount as whole dong
+ * @param amount The amount
+ * @return Formatted string (e.g., "1000000 VND")
+ */
+std::string formatMoney(Money amount);
+
 /**
  * @brief Format date for display
  * @param date Date in YYYY-MM-DD format
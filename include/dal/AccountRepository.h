@@ -1,11 +1,17 @@
 #pragma once
 
 #include "IRepository.h"
+#include "CowVector.h"
+#include "Journal.h"
+#include "GroupCommit.h"
+#include "WriteBehindFlusher.h"
 #include "../model/Account.h"
 #include <vector>
 #include <optional>
+#include <unordered_map>
 #include <string>
 #include <mutex>
+#include <shared_mutex>
 #include <memory>
 
 namespace HMS
@@ -29,11 +35,25 @@ namespace HMS
             static std::mutex s_mutex;
 
             // ==================== Data ====================
-            mutable std::mutex m_dataMutex;
-            std::vector<Model::Account> m_accounts;
+            mutable std::shared_mutex m_dataMutex;
+            CowVector<Model::Account> m_accounts;
             std::string m_filePath;
             mutable bool m_isLoaded;
 
+            // ==================== Primary Key Index ====================
+            std::unordered_map<std::string, size_t> m_idIndex; // ID -> slot in m_accounts
+
+            // ==================== Journal ====================
+            Journal m_journal;
+            bool m_journalEnabled;
+
+            // ==================== Write-Behind ====================
+            DurabilityPolicy m_durability;
+            std::vector<Journal::Record> m_pendingRecords; // Deferred journal records (journal mode only)
+            size_t m_pendingChanges;
+            bool m_flushScheduled; // Set once a flush was handed to the WriteBehindFlusher
+            GroupCommit m_groupCommit;
+
             // ==================== Private Constructor ====================
             AccountRepository();
 
@@ -75,6 +95,18 @@ namespace HMS
              */
             std::vector<Model::Account> getAll() override;
 
+            /**
+             * @brief Get an immutable point-in-time view of all accounts
+             * @return Snapshot sharing the current records (O(1), nothing is copied)
+             */
+            Snapshot<Model::Account> getSnapshot() const;
+
+            /**
+             * @brief Borrow all records in place under a shared lock
+             * @return View valid until destroyed; do not modify this repository meanwhile
+             */
+            ReadView<Model::Account> view() const override;
+
             /**
              * @brief Get account by username
              * @param id Username (used as ID)
@@ -110,6 +142,20 @@ namespace HMS
              */
             bool remove(const std::string &id) override;
 
+            /**
+             * @brief Add several accounts with one write
+             * @param accounts Accounts to add
+             * @return True if all were added; false (nothing added) if any username exists or repeats
+             */
+            bool addRange(const std::vector<Model::Account> &accounts) override;
+
+            /**
+             * @brief Add new accounts and replace existing ones with one write
+             * @param accounts Accounts to store (a repeated username keeps the last one)
+             * @return True if successful
+             */
+            bool upsertRange(const std::vector<Model::Account> &accounts) override;
+
             // ==================== Persistence ====================
 
             /**
@@ -124,6 +170,65 @@ namespace HMS
              */
             bool load() override;
 
+            // ==================== Journal Mode ====================
+
+            /**
+             * @brief Enable or disable append-only journal mode
+             * @param enabled True to log each mutation as one journal record
+             *
+             * In journal mode mutations append a single record instead of rewriting
+             * the data file, and a background snapshot is taken once the compaction
+             * thresholds are reached. save() writes a snapshot and truncates the
+             * journal. Disabling folds the journal into a snapshot.
+             */
+            void setJournalEnabled(bool enabled);
+
+            /**
+             * @brief Check if journal mode is enabled
+             * @return True if mutations are journaled
+             */
+            bool isJournalEnabled() const;
+
+            /**
+             * @brief Number of journal records pending since the last snapshot
+             * @return Record count
+             */
+            size_t getJournalRecordCount() const;
+
+            /**
+             * @brief Set the record-count/size thresholds for background compaction
+             * @param policy New thresholds
+             */
+            void setCompactionPolicy(const Journal::CompactionPolicy &policy);
+
+            // ==================== Durability ====================
+
+            /**
+             * @brief Choose when mutations are persisted
+             * @param policy SYNC (default), GROUP_COMMIT or INTERVAL write-behind
+             *
+             * Changes pending under the old policy are flushed first.
+             */
+            void setDurabilityPolicy(const DurabilityPolicy &policy);
+
+            /**
+             * @brief Get the current durability policy
+             * @return Active policy
+             */
+            DurabilityPolicy getDurabilityPolicy() const;
+
+            /**
+             * @brief Persist deferred mutations now
+             * @return True if nothing is pending afterwards
+             */
+            bool flush();
+
+            /**
+             * @brief Number of mutations not yet persisted
+             * @return Pending change count (always 0 in SYNC mode)
+             */
+            size_t getPendingChangeCount() const;
+
             // ==================== Query Operations ====================
 
             /**
@@ -191,6 +296,22 @@ namespace HMS
              */
             void ensureLoaded() const;
 
+            /**
+             * @brief Acquire a shared lock with the data loaded
+             *
+             * Queries share the lock; the first access upgrades to an exclusive
+             * lock once to load the file.
+             */
+            std::shared_lock<std::shared_mutex> lockForRead() const;
+
+            /**
+             * @brief Acquire the exclusive lock with the data loaded and unshared
+             *
+             * Detaches the records from outstanding snapshots, so call it before
+             * looking up anything that will be modified.
+             */
+            std::unique_lock<std::shared_mutex> lockForWrite();
+
             /**
              * @brief Internal load without mutex (called from locked context)
              */
@@ -200,6 +321,70 @@ namespace HMS
              * @brief Internal save without mutex (called from locked context)
              */
             bool saveInternal();
+
+            /**
+             * @brief Persist one inserted/updated account (without lock)
+             * @return True if successful
+             *
+             * Appends a journal record in journal mode, rewrites the file otherwise.
+             */
+            bool persistUpsert(const Model::Account &account);
+
+            /**
+             * @brief Persist one removal (without lock)
+             * @return True if successful
+             */
+            bool persistRemove(const std::string &id);
+
+            /**
+             * @brief Count deferred mutations and schedule a flush (caller holds the lock)
+             * @param changes Number of mutations deferred
+             * @return True if successful
+             *
+             * In GROUP_COMMIT mode waits for the shared write, releasing the lock
+             * meanwhile. In INTERVAL mode flushes at once when maxPendingChanges
+             * is reached.
+             */
+            bool deferWrite(size_t changes);
+
+            /**
+             * @brief Persist deferred mutations (without lock)
+             * @return True if nothing is pending afterwards
+             */
+            bool flushPendingInternal();
+
+            /**
+             * @brief Persist several mutations with one write (without lock)
+             * @param records Journal records describing the mutations
+             * @return True if successful
+             *
+             * Appends all records with one flush in journal mode, rewrites the
+             * file once otherwise.
+             */
+            bool persistRecords(const std::vector<Journal::Record> &records);
+
+            /**
+             * @brief Undo a range operation whose write failed (without lock)
+             * @param oldSize Record count before the batch
+             * @param replaced Slot and previous value of each record the batch replaced, in order
+             * @param recordCount Number of journal records the batch queued
+             */
+            void rollbackRange(size_t oldSize,
+                               const std::vector<std::pair<size_t, Model::Account>> &replaced,
+                               size_t recordCount);
+
+            /**
+             * @brief Re-index accounts from the given slot onwards (without lock)
+             * @param from First slot whose position changed (0 rebuilds the whole index)
+             */
+            void rebuildIndex(size_t from = 0);
+
+            /**
+             * @brief Find an account by primary key via the index (without lock)
+             * @param id Primary key
+             * @return Iterator into m_accounts, or end() if not found
+             */
+            std::vector<Model::Account>::iterator findById(const std::string &id);
         };
 
     } // namespace DAL
@@ -1,12 +1,23 @@
 #pragma once
 
 #include "IRepository.h"
+#include "CowVector.h"
+#include "Journal.h"
+#include "GroupCommit.h"
+#include "IdSequence.h"
+#include "WriteBehindFlusher.h"
 #include "../model/Appointment.h"
 #include "../common/Types.h"
+#include "../common/Constants.h"
+#include <array>
+#include <cstdint>
+#include <map>
 #include <vector>
 #include <optional>
+#include <unordered_map>
 #include <string>
 #include <mutex>
+#include <shared_mutex>
 #include <memory>
 
 namespace HMS
@@ -30,19 +41,215 @@ namespace HMS
             static std::mutex s_mutex;
 
             // ==================== Data ====================
-            std::vector<Model::Appointment> m_appointments;
+            CowVector<Model::Appointment> m_appointments;
             std::string m_filePath;
             bool m_isLoaded;
-            mutable std::mutex m_dataMutex;
+            mutable std::shared_mutex m_dataMutex;
+
+            // ==================== Primary Key Index ====================
+            std::unordered_map<std::string, size_t> m_idIndex; // ID -> slot in m_appointments
+            IdSequence m_idSequence; // Next appointment ID, seeded at load
+
+            // ==================== Patient Index ====================
+            // Interned patient username -> appointment IDs, ordered by date then time
+            std::unordered_map<InternedString, std::vector<std::string>> m_patientIndex;
+
+            // ==================== Slot Index ====================
+
+            /**
+             * @struct DaySlots
+             * @brief Non-cancelled bookings of one doctor on one date
+             */
+            struct DaySlots
+            {
+                SlotMask booked = 0;                                             // Standard slots with a booking
+                std::array<std::uint16_t, Constants::SLOTS_PER_DAY> bookings{}; // Bookings per standard slot
+                std::vector<std::string> offGridTimes;                           // Bookings outside the grid
+            };
+
+            // "doctorID|date" -> bookings of that day
+            std::unordered_map<std::string, DaySlots> m_slotIndex;
+
+            // ==================== Date Index ====================
+            // (date, time) -> appointment ID, for ordered range queries
+            std::multimap<std::pair<Date, TimeOfDay>, std::string> m_dateIndex;
+
+            // ==================== Journal ====================
+            Journal m_journal;
+            bool m_journalEnabled;
+
+            // ==================== Write-Behind ====================
+            DurabilityPolicy m_durability;
+            std::vector<Journal::Record> m_pendingRecords; // Deferred journal records (journal mode only)
+            size_t m_pendingChanges;
+            bool m_flushScheduled; // Set once a flush was handed to the WriteBehindFlusher
+            GroupCommit m_groupCommit;
+
+            // Captures several repositories under one set of shared locks
+            friend struct DataSnapshot;
 
             // ==================== Private Constructor ====================
             AppointmentRepository();
 
             // ==================== Private Helpers ====================
             void ensureLoaded() const;
+
+            /**
+             * @brief Acquire a shared lock with the data loaded
+             *
+             * Queries share the lock; the first access upgrades to an exclusive
+             * lock once to load the file.
+             */
+            std::shared_lock<std::shared_mutex> lockForRead() const;
+
+            /**
+             * @brief Acquire the exclusive lock with the data loaded and unshared
+             *
+             * Detaches the records from outstanding snapshots, so call it before
+             * looking up anything that will be modified.
+             */
+            std::unique_lock<std::shared_mutex> lockForWrite();
+
             bool loadInternal();
             bool saveInternal();
 
+            /**
+             * @brief Persist one inserted/updated appointment (without lock)
+             * @return True if successful
+             *
+             * Appends a journal record in journal mode, rewrites the file otherwise.
+             */
+            bool persistUpsert(const Model::Appointment &appointment);
+
+            /**
+             * @brief Persist one removal (without lock)
+             * @return True if successful
+             */
+            bool persistRemove(const std::string &id);
+
+            /**
+             * @brief Count deferred mutations and schedule a flush (caller holds the lock)
+             * @param changes Number of mutations deferred
+             * @return True if successful
+             *
+             * In GROUP_COMMIT mode waits for the shared write, releasing the lock
+             * meanwhile. In INTERVAL mode flushes at once when maxPendingChanges
+             * is reached.
+             */
+            bool deferWrite(size_t changes);
+
+            /**
+             * @brief Persist deferred mutations (without lock)
+             * @return True if nothing is pending afterwards
+             */
+            bool flushPendingInternal();
+
+            /**
+             * @brief Persist several mutations with one write (without lock)
+             * @param records Journal records describing the mutations
+             * @return True if successful
+             *
+             * Appends all records with one flush in journal mode, rewrites the
+             * file once otherwise.
+             */
+            bool persistRecords(const std::vector<Journal::Record> &records);
+
+            /**
+             * @brief Undo a range operation whose write failed (without lock)
+             * @param oldSize Record count before the batch
+             * @param replaced Slot and previous value of each record the batch replaced, in order
+             * @param recordCount Number of journal records the batch queued
+             */
+            void rollbackRange(size_t oldSize,
+                               const std::vector<std::pair<size_t, Model::Appointment>> &replaced,
+                               size_t recordCount);
+
+            /**
+             * @brief Re-index appointments from the given slot onwards (without lock)
+             * @param from First slot whose position changed (0 rebuilds the whole index)
+             */
+            void rebuildIndex(size_t from = 0);
+
+            /**
+             * @brief Find an appointment by primary key via the index (without lock)
+             * @param id Primary key
+             * @return Iterator into m_appointments, or end() if not found
+             */
+            std::vector<Model::Appointment>::iterator findById(const std::string &id);
+
+            /**
+             * @brief Rebuild the patient index from m_appointments (without lock)
+             */
+            void rebuildPatientIndex();
+
+            /**
+             * @brief Insert an appointment into its patient's date-ordered list (without lock)
+             * @param appointment Appointment already stored and present in the ID index
+             */
+            void indexByPatient(const Model::Appointment &appointment);
+
+            /**
+             * @brief Remove an appointment from its patient's list (without lock)
+             * @param appointment Appointment as currently stored
+             */
+            void unindexByPatient(const Model::Appointment &appointment);
+
+            /**
+             * @brief Get one patient's appointments via the patient index (without lock)
+             * @param patientUsername The patient's username
+             * @return Appointments ordered by date then time (ascending)
+             */
+            std::vector<Model::Appointment> collectByPatient(const std::string &patientUsername) const;
+
+            /**
+             * @brief Rebuild the slot index from m_appointments (without lock)
+             */
+            void rebuildSlotIndex();
+
+            /**
+             * @brief Mark an appointment's slot as booked (without lock)
+             * @param appointment Appointment to index; cancelled ones are ignored
+             */
+            void bookSlot(const Model::Appointment &appointment);
+
+            /**
+             * @brief Release an appointment's slot (without lock)
+             * @param appointment Appointment as currently stored; cancelled ones are ignored
+             */
+            void releaseSlot(const Model::Appointment &appointment);
+
+            /**
+             * @brief Count non-cancelled bookings of a doctor at a date and time (without lock)
+             * @return Number of bookings in that slot
+             */
+            size_t countBookings(const std::string &doctorID, const std::string &date,
+                                 const std::string &time) const;
+
+            /**
+             * @brief Build the slot index key
+             * @return "doctorID|date"
+             */
+            static std::string getSlotKey(const std::string &doctorID, const std::string &date);
+
+            /**
+             * @brief Rebuild the date index from m_appointments (without lock)
+             */
+            void rebuildDateIndex();
+
+            /**
+             * @brief Remove an appointment from the date index (without lock)
+             * @param appointment Appointment as currently stored
+             */
+            void unindexByDate(const Model::Appointment &appointment);
+
+            /**
+             * @brief Get appointments in a date range via the date index (without lock)
+             * @param startDate Start date (inclusive)
+             * @param endDate End date (inclusive)
+             * @return Appointments ordered by date then time
+             */
+            std::vector<Model::Appointment> collectByDateRange(Date startDate, Date endDate) const;
+
         public:
             // ==================== Singleton Access ====================
 
@@ -80,6 +287,18 @@ namespace HMS
              */
             std::vector<Model::Appointment> getAll() override;
 
+            /**
+             * @brief Get an immutable point-in-time view of all appointments
+             * @return Snapshot sharing the current records (O(1), nothing is copied)
+             */
+            Snapshot<Model::Appointment> getSnapshot() const;
+
+            /**
+             * @brief Borrow all records in place under a shared lock
+             * @return View valid until destroyed; do not modify this repository meanwhile
+             */
+            ReadView<Model::Appointment> view() const override;
+
             /**
              * @brief Get appointment by appointment ID
              * @param id Appointment ID
@@ -108,6 +327,20 @@ namespace HMS
              */
             bool remove(const std::string &id) override;
 
+            /**
+             * @brief Add several appointments with one write
+             * @param appointments Appointments to add
+             * @return True if all were added; false (nothing added) if any ID exists or repeats
+             */
+            bool addRange(const std::vector<Model::Appointment> &appointments) override;
+
+            /**
+             * @brief Add new appointments and replace existing ones with one write
+             * @param appointments Appointments to store (a repeated ID keeps the last one)
+             * @return True if successful
+             */
+            bool upsertRange(const std::vector<Model::Appointment> &appointments) override;
+
             // ==================== Persistence ====================
 
             /**
@@ -122,6 +355,65 @@ namespace HMS
              */
             bool load() override;
 
+            // ==================== Journal Mode ====================
+
+            /**
+             * @brief Enable or disable append-only journal mode
+             * @param enabled True to log each mutation as one journal record
+             *
+             * In journal mode mutations append a single record instead of rewriting
+             * the data file, and a background snapshot is taken once the compaction
+             * thresholds are reached. save() writes a snapshot and truncates the
+             * journal. Disabling folds the journal into a snapshot.
+             */
+            void setJournalEnabled(bool enabled);
+
+            /**
+             * @brief Check if journal mode is enabled
+             * @return True if mutations are journaled
+             */
+            bool isJournalEnabled() const;
+
+            /**
+             * @brief Number of journal records pending since the last snapshot
+             * @return Record count
+             */
+            size_t getJournalRecordCount() const;
+
+            /**
+             * @brief Set the record-count/size thresholds for background compaction
+             * @param policy New thresholds
+             */
+            void setCompactionPolicy(const Journal::CompactionPolicy &policy);
+
+            // ==================== Durability ====================
+
+            /**
+             * @brief Choose when mutations are persisted
+             * @param policy SYNC (default), GROUP_COMMIT or INTERVAL write-behind
+             *
+             * Changes pending under the old policy are flushed first.
+             */
+            void setDurabilityPolicy(const DurabilityPolicy &policy);
+
+            /**
+             * @brief Get the current durability policy
+             * @return Active policy
+             */
+            DurabilityPolicy getDurabilityPolicy() const;
+
+            /**
+             * @brief Persist deferred mutations now
+             * @return True if nothing is pending afterwards
+             */
+            bool flush();
+
+            /**
+             * @brief Number of mutations not yet persisted
+             * @return Pending change count (always 0 in SYNC mode)
+             */
+            size_t getPendingChangeCount() const;
+
             // ==================== Query Operations ====================
 
             /**
@@ -148,7 +440,7 @@ namespace HMS
             /**
              * @brief Get all appointments for a patient
              * @param patientUsername The patient's username
-             * @return Vector of patient's appointments
+             * @return Vector of patient's appointments, ordered by date and time
              */
             std::vector<Model::Appointment> getByPatient(const std::string &patientUsername);
 
@@ -169,7 +461,7 @@ namespace HMS
             /**
              * @brief Get patient's unpaid appointments
              * @param patientUsername The patient's username
-             * @return Vector of unpaid appointments
+             * @return Vector of unpaid appointments, ordered by date and time
              */
             std::vector<Model::Appointment> getUnpaidByPatient(const std::string &patientUsername);
 
@@ -284,14 +576,33 @@ namespace HMS
             std::vector<std::string> getBookedSlots(const std::string &doctorID,
                                                     const std::string &date);
 
+            /**
+             * @brief Get booked standard slots for a doctor on a date as a bitmask
+             * @param doctorID Doctor's ID
+             * @param date Date (YYYY-MM-DD)
+             * @return Bit i set if the i-th standard slot (see Utils::getSlotTime) is booked
+             */
+            SlotMask getBookedSlotMask(const std::string &doctorID, const std::string &date);
+
             // ==================== ID Generation ====================
 
             /**
-             * @brief Get the next available appointment ID
-             * @return New appointment ID string
+             * @brief Get the next available appointment ID without reserving it
+             * @return ID the next allocateId() call returns
+             *
+             * O(1): read from the ID sequence instead of scanning the records.
+             * Use allocateId() for an ID that is about to be added.
              */
             std::string getNextId();
 
+            /**
+             * @brief Reserve a new appointment ID
+             * @return ID no other caller receives, even concurrently
+             *
+             * IDs are never reused: an ID reserved but not added is skipped.
+             */
+            std::string allocateId();
+
             // ==================== File Path ====================
 
             /**
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace HMS
+{
+    namespace DAL
+    {
+
+        /**
+         * @struct RetentionPolicy
+         * @brief Which backups of a data file are kept
+         *
+         * A backup survives if it is one of the newest keepLast backups, or the
+         * newest backup of one of the keepHourly most recent hours, or of one of
+         * the keepDaily most recent days (UTC).
+         */
+        struct RetentionPolicy
+        {
+            size_t keepLast;
+            size_t keepHourly;
+            size_t keepDaily;
+        };
+
+        /**
+         * @struct BackupEntry
+         * @brief One backup of a data file, as recorded in the index
+         */
+        struct BackupEntry
+        {
+            std::int64_t timestamp; ///< Milliseconds since the Unix epoch
+            std::string source;     ///< Data file name (e.g. "Appointment.txt")
+            std::uint64_t hash;     ///< Content hash of the backed-up file
+            std::string object;     ///< File name of the stored copy in the backup directory
+        };
+
+        /**
+         * @class BackupStore
+         * @brief Deduplicated, retention-managed backups of data files
+         *
+         * Copies are stored once per distinct content (named by content hash),
+         * so saving an unchanged file stores nothing. A hash match is
+         * confirmed byte for byte; content that collides with an existing
+         * copy gets a numbered name instead. An index file records
+         * every backup in time order, so the latest backup is found without
+         * scanning the directory. After each backup the retention policy is
+         * applied and copies no longer referenced by the index are deleted.
+         *
+         * Thread-safe. getInstance() returns the store for Constants::BACKUP_DIR.
+         */
+        class BackupStore
+        {
+        private:
+            // ==================== State ====================
+            std::string m_directory;
+            RetentionPolicy m_policy;
+            std::vector<BackupEntry> m_entries; // Ordered by timestamp
+            bool m_loaded;
+            mutable std::mutex m_mutex;
+
+            // ==================== Private Helpers (caller holds m_mutex) ====================
+            void ensureLoaded();
+            void adoptLegacyBackups();
+            bool saveIndex() const;
+            void applyRetention(const std::string &source);
+            void removeUnreferencedObjects(const std::vector<std::string> &candidates);
+            std::string indexPath() const;
+            std::string objectPath(const std::string &object) const;
+            bool objectHasContent(const std::string &object, const std::string &content) const;
+
+        public:
+            // ==================== Constructor ====================
+
+            /**
+             * @brief Create a store over a backup directory
+             * @param directory Directory holding the copies and the index
+             * @param policy Retention policy applied after each backup
+             */
+            explicit BackupStore(std::string directory, RetentionPolicy policy = defaultPolicy());
+
+            BackupStore(const BackupStore &) = delete;
+            BackupStore &operator=(const BackupStore &) = delete;
+
+            // ==================== Singleton Access ====================
+
+            /**
+             * @brief Get the store for the application backup directory
+             * @return Pointer to the shared instance
+             *
+             * Never destroyed, so pending backups can still be written at exit.
+             */
+            static BackupStore *getInstance();
+
+            /**
+             * @brief Retention policy from Constants
+             */
+            static RetentionPolicy defaultPolicy();
+
+            // ==================== Backup / Restore ====================
+
+            /**
+             * @brief Back up a data file now
+             * @param filePath File to back up
+             * @return True if the file is backed up (including when unchanged)
+             */
+            bool backup(const std::string &filePath);
+
+            /**
+             * @brief Back up a data file with an explicit timestamp
+             * @param filePath File to back up
+             * @param timestamp Milliseconds since the Unix epoch
+             * @return True if the file is backed up (including when unchanged)
+             */
+            bool backup(const std::string &filePath, std::int64_t timestamp);
+
+            /**
+             * @brief Back up content already in memory as a version of a data file
+             * @param filePath Data file the content belongs to
+             * @param content File content
+             * @param timestamp Milliseconds since the Unix epoch
+             * @return True if the content is backed up (including when unchanged)
+             */
+            bool backupContent(const std::string &filePath, const std::string &content,
+                               std::int64_t timestamp);
+
+            /**
+             * @brief Current time in backup timestamp units
+             * @return Milliseconds since the Unix epoch
+             */
+            static std::int64_t now();
+
+            /**
+             * @brief Restore a data file from its latest backup
+             * @param filePath File to restore
+             * @return True if a backup existed and was copied back
+             */
+            bool restoreLatest(const std::string &filePath);
+
+            // ==================== Queries ====================
+
+            /**
+             * @brief Get the latest backup of a data file
+             * @param filePath Data file path (only its file name is used)
+             * @return Latest entry, or nullopt if none
+             */
+            std::optional<BackupEntry> getLatest(const std::string &filePath);
+
+            /**
+             * @brief Get all backups of a data file, oldest first
+             * @param filePath Data file path (only its file name is used)
+             * @return Backup entries
+             */
+            std::vector<BackupEntry> getEntries(const std::string &filePath);
+
+            /**
+             * @brief Get the path of a stored copy
+             * @param entry Backup entry
+             * @return Path inside the backup directory
+             */
+            std::string getObjectPath(const BackupEntry &entry) const;
+
+            // ==================== Configuration ====================
+
+            void setRetentionPolicy(const RetentionPolicy &policy);
+            RetentionPolicy getRetentionPolicy() const;
+        };
+
+    } // namespace DAL
+} // namespace HMS
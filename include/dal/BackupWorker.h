@@ -0,0 +1,123 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace HMS
+{
+    namespace DAL
+    {
+
+        /**
+         * @class BackupWorker
+         * @brief Background thread that writes data file backups
+         *
+         * Implements Singleton pattern. After a repository rewrites its data
+         * file it hands the written lines to the worker instead of copying the
+         * file on the request path. Each file is backed up at most once per
+         * interval: saves arriving in between replace the pending content, so
+         * a burst of saves produces a single backup of the newest state.
+         *
+         * Pending backups are written when flush() is called and before the
+         * worker is destroyed by resetInstance(). The instance is never
+         * destroyed at exit, so HMSFacade::shutdown() flushes it.
+         */
+        class BackupWorker
+        {
+        private:
+            using Clock = std::chrono::steady_clock;
+
+            /** Newest unsaved content of one data file */
+            struct PendingBackup
+            {
+                std::vector<std::string> lines;
+                std::int64_t timestamp; // Backup timestamp (ms since the Unix epoch)
+            };
+
+            // ==================== Singleton ====================
+            static BackupWorker *s_instance; // Leaked on purpose: repository destructors run during static destruction
+            static std::mutex s_mutex;
+
+            // ==================== Queue ====================
+            std::map<std::string, PendingBackup> m_pending;           // File path -> pending backup
+            std::unordered_map<std::string, Clock::time_point> m_lastBackup;
+            std::chrono::milliseconds m_interval;
+            mutable std::mutex m_queueMutex;
+            std::condition_variable m_wake;
+            std::condition_variable m_idle;
+            bool m_busy;
+            bool m_flushRequested;
+            bool m_stopping;
+            std::thread m_thread;
+
+            // ==================== Private Constructor ====================
+            BackupWorker();
+
+            // ==================== Private Helpers ====================
+            void run();
+            static void writeBackup(const std::string &filePath, const PendingBackup &pending);
+
+        public:
+            // ==================== Singleton Access ====================
+
+            /**
+             * @brief Get the singleton instance (starts the thread on first use)
+             * @return Pointer to the singleton instance
+             */
+            static BackupWorker *getInstance();
+
+            /**
+             * @brief Reset the singleton instance (for testing)
+             *
+             * Pending backups are written before the thread stops.
+             */
+            static void resetInstance();
+
+            BackupWorker(const BackupWorker &) = delete;
+            BackupWorker &operator=(const BackupWorker &) = delete;
+
+            /**
+             * @brief Destructor - writes pending backups and joins the thread
+             */
+            ~BackupWorker();
+
+            // ==================== Backup Requests ====================
+
+            /**
+             * @brief Queue a backup of a data file's newly written content
+             * @param filePath Data file that was written
+             * @param lines Lines written to it (replaces any pending content)
+             */
+            void submit(const std::string &filePath, std::vector<std::string> lines);
+
+            /**
+             * @brief Write every pending backup now and wait until done
+             */
+            void flush();
+
+            /**
+             * @brief Number of files with a pending or running backup
+             * @return File count
+             */
+            size_t getPendingCount() const;
+
+            // ==================== Configuration ====================
+
+            /**
+             * @brief Set the minimum time between two backups of the same file
+             * @param interval Coalescing interval
+             */
+            void setInterval(std::chrono::milliseconds interval);
+
+            std::chrono::milliseconds getInterval() const;
+        };
+
+    } // namespace DAL
+} // namespace HMS
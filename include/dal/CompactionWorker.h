@@ -0,0 +1,93 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace HMS
+{
+    namespace DAL
+    {
+
+        /**
+         * @class CompactionWorker
+         * @brief Background thread that writes journal snapshots
+         *
+         * Implements Singleton pattern. Repositories hand over a task that
+         * owns a snapshot of their data; the worker serializes it, rewrites the
+         * data file and drops the journal segment it replaces, keeping the
+         * full-file rewrite off the request path.
+         *
+         * Tasks run one at a time in submission order.
+         */
+        class CompactionWorker
+        {
+        private:
+            // ==================== Singleton ====================
+            static std::unique_ptr<CompactionWorker> s_instance;
+            static std::mutex s_mutex;
+
+            // ==================== Queue ====================
+            std::deque<std::function<void()>> m_tasks;
+            mutable std::mutex m_queueMutex;
+            std::condition_variable m_taskAvailable;
+            std::condition_variable m_idle;
+            bool m_busy;
+            bool m_stopping;
+            std::thread m_thread;
+
+            // ==================== Private Constructor ====================
+            CompactionWorker();
+
+            // ==================== Private Helpers ====================
+            void run();
+
+        public:
+            // ==================== Singleton Access ====================
+
+            /**
+             * @brief Get the singleton instance (starts the thread on first use)
+             * @return Pointer to the singleton instance
+             */
+            static CompactionWorker *getInstance();
+
+            /**
+             * @brief Reset the singleton instance (for testing)
+             *
+             * Pending tasks are finished before the thread stops.
+             */
+            static void resetInstance();
+
+            CompactionWorker(const CompactionWorker &) = delete;
+            CompactionWorker &operator=(const CompactionWorker &) = delete;
+
+            /**
+             * @brief Destructor - drains the queue and joins the thread
+             */
+            ~CompactionWorker();
+
+            // ==================== Task Management ====================
+
+            /**
+             * @brief Queue a task for the worker thread
+             * @param task The task to run
+             */
+            void submit(std::function<void()> task);
+
+            /**
+             * @brief Block until every queued task has finished
+             */
+            void waitIdle();
+
+            /**
+             * @brief Number of tasks queued or running
+             * @return Task count
+             */
+            size_t getPendingCount() const;
+        };
+
+    } // namespace DAL
+} // namespace HMS
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace HMS
+{
+    namespace DAL
+    {
+
+        /**
+         * @brief Immutable point-in-time view of a repository's records
+         *
+         * Taking a snapshot is O(1). It stays valid and unchanged however
+         * the repository is modified afterwards.
+         */
+        template <typename T>
+        using Snapshot = std::shared_ptr<const std::vector<T>>;
+
+        /**
+         * @class CowVector
+         * @brief Reference-counted copy-on-write record storage
+         *
+         * Behaves like the std::vector it wraps, but the storage can be
+         * shared with any number of Snapshot readers. A writer calls
+         * detach() before modifying records; it copies the storage only if
+         * a snapshot still references it, so readers never see a change and
+         * never block the writer.
+         *
+         * Not thread-safe by itself: the owning repository calls detach()
+         * and the mutators under its exclusive lock, and snapshot() under
+         * at least a shared lock.
+         */
+        template <typename T>
+        class CowVector
+        {
+        public:
+            using value_type = T;
+            using size_type = typename std::vector<T>::size_type;
+            using iterator = typename std::vector<T>::iterator;
+            using const_iterator = typename std::vector<T>::const_iterator;
+
+            // ==================== Constructors ====================
+
+            CowVector() : m_items(std::make_shared<std::vector<T>>()) {}
+
+            /**
+             * @brief Replace the contents with freshly built records
+             *
+             * Snapshots of the old contents are unaffected.
+             */
+            CowVector &operator=(std::vector<T> items)
+            {
+                m_items = std::make_shared<std::vector<T>>(std::move(items));
+                return *this;
+            }
+
+            // ==================== Copy-on-Write ====================
+
+            /**
+             * @brief Make the storage private before modifying it
+             *
+             * Iterators obtained before a detach() that copied refer to the
+             * snapshot's storage, so call this before looking records up.
+             */
+            void detach()
+            {
+                if (m_items.use_count() > 1)
+                {
+                    m_items = std::make_shared<std::vector<T>>(*m_items);
+                }
+            }
+
+            /**
+             * @brief Share the current contents with a reader
+             * @return Snapshot of the records as they are now
+             */
+            Snapshot<T> snapshot() const
+            {
+                return m_items;
+            }
+
+            /**
+             * @brief Access the underlying vector (detach() first to modify it)
+             */
+            std::vector<T> &items() { return *m_items; }
+            const std::vector<T> &items() const { return *m_items; }
+
+            // ==================== Vector Interface ====================
+
+            iterator begin() { return m_items->begin(); }
+            iterator end() { return m_items->end(); }
+            const_iterator begin() const { return m_items->cbegin(); }
+            const_iterator end() const { return m_items->cend(); }
+
+            size_type size() const { return m_items->size(); }
+            bool empty() const { return m_items->empty(); }
+
+            T &operator[](size_type i) { return (*m_items)[i]; }
+            const T &operator[](size_type i) const { return (*m_items)[i]; }
+
+            T &back() { return m_items->back(); }
+            const T &back() const { return m_items->back(); }
+
+            void reserve(size_type capacity) { m_items->reserve(capacity); }
+            void push_back(const T &item) { m_items->push_back(item); }
+            void push_back(T &&item) { m_items->push_back(std::move(item)); }
+            iterator erase(const_iterator pos) { return m_items->erase(pos); }
+
+            /**
+             * @brief Remove all records without copying shared storage
+             */
+            void clear()
+            {
+                if (m_items.use_count() > 1)
+                {
+                    m_items = std::make_shared<std::vector<T>>();
+                }
+                else
+                {
+                    m_items->clear();
+                }
+            }
+
+        private:
+            std::shared_ptr<std::vector<T>> m_items;
+        };
+
+    } // namespace DAL
+} // namespace HMS
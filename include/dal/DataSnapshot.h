@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CowVector.h"
+#include "../model/Patient.h"
+#include "../model/Doctor.h"
+#include "../model/Appointment.h"
+#include "../advance/Medicine.h"
+#include "../advance/Prescription.h"
+
+namespace HMS
+{
+    namespace DAL
+    {
+
+        /**
+         * @struct DataSnapshot
+         * @brief Consistent point-in-time view across repositories
+         *
+         * Reports read from one DataSnapshot instead of calling getAll() on
+         * each repository: capturing is O(1) per repository, nothing is
+         * copied, and writers keep going while the report runs (their next
+         * write copies the records once if the snapshot is still alive).
+         *
+         * Repositories not requested in capture() are left null.
+         */
+        struct DataSnapshot
+        {
+            /**
+             * @brief Repositories that can be captured
+             *
+             * The declaration order is also the global lock order: code that
+             * holds the locks of several repositories at once (capture(),
+             * UnitOfWork::commit()) takes them in this order only. A
+             * repository visitor (IRepository::forEach(), scan(), view())
+             * already holds a lock, so it must never take another one.
+             */
+            enum Source : unsigned
+            {
+                PATIENTS = 1u << 0,
+                DOCTORS = 1u << 1,
+                APPOINTMENTS = 1u << 2,
+                MEDICINES = 1u << 3,
+                PRESCRIPTIONS = 1u << 4,
+                ALL = PATIENTS | DOCTORS | APPOINTMENTS | MEDICINES | PRESCRIPTIONS
+            };
+
+            Snapshot<Model::Patient> patients;
+            Snapshot<Model::Doctor> doctors;
+            Snapshot<Model::Appointment> appointments;
+            Snapshot<Model::Medicine> medicines;
+            Snapshot<Model::Prescription> prescriptions;
+
+            /**
+             * @brief Snapshot the requested repositories at one point in time
+             *
+             * Holds the shared locks of every requested repository at once,
+             * so no write that is in progress on any of them is half
+             * visible. Locks are taken in the order of Source.
+             *
+             * @param sources Bitwise OR of Source values
+             * @return The captured snapshots
+             */
+            static DataSnapshot capture(unsigned sources = ALL);
+        };
+
+    } // namespace DAL
+} // namespace HMS
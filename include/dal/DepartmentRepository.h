@@ -1,11 +1,18 @@
 #pragma once
 
 #include "IRepository.h"
+#include "CowVector.h"
+#include "Journal.h"
+#include "GroupCommit.h"
+#include "IdSequence.h"
+#include "WriteBehindFlusher.h"
 #include "../advance/Department.h"
 #include <vector>
 #include <optional>
+#include <unordered_map>
 #include <string>
 #include <mutex>
+#include <shared_mutex>
 #include <memory>
 
 namespace HMS {
@@ -25,10 +32,25 @@ private:
     static std::mutex s_mutex;
 
     // ==================== Data ====================
-    std::vector<Model::Department> m_departments;
+    CowVector<Model::Department> m_departments;
     std::string m_filePath;
     bool m_isLoaded;
-    mutable std::mutex m_dataMutex;
+    mutable std::shared_mutex m_dataMutex;
+
+    // ==================== Primary Key Index ====================
+    std::unordered_map<std::string, size_t> m_idIndex; // ID -> slot in m_departments
+    IdSequence m_idSequence; // Next department ID, seeded at load
+
+    // ==================== Journal ====================
+    Journal m_journal;
+    bool m_journalEnabled;
+
+    // ==================== Write-Behind ====================
+    DurabilityPolicy m_durability;
+    std::vector<Journal::Record> m_pendingRecords; // Deferred journal records (journal mode only)
+    size_t m_pendingChanges;
+    bool m_flushScheduled; // Set once a flush was handed to the WriteBehindFlusher
+    GroupCommit m_groupCommit;
 
     // ==================== Private Constructor ====================
     DepartmentRepository();
@@ -40,6 +62,22 @@ private:
      */
     void ensureLoaded() const;
 
+    /**
+     * @brief Acquire a shared lock with the data loaded
+     *
+     * Queries share the lock; the first access upgrades to an exclusive
+     * lock once to load the file.
+     */
+    std::shared_lock<std::shared_mutex> lockForRead() const;
+
+    /**
+     * @brief Acquire the exclusive lock with the data loaded and unshared
+     *
+     * Detaches the records from outstanding snapshots, so call it before
+     * looking up anything that will be modified.
+     */
+    std::unique_lock<std::shared_mutex> lockForWrite();
+
     /**
      * @brief Internal load implementation (without lock)
      * @return True if successful
@@ -52,6 +90,70 @@ private:
      */
     bool saveInternal();
 
+    /**
+     * @brief Persist one inserted/updated department (without lock)
+     * @return True if successful
+     *
+     * Appends a journal record in journal mode, rewrites the file otherwise.
+     */
+    bool persistUpsert(const Model::Department& department);
+
+    /**
+     * @brief Persist one removal (without lock)
+     * @return True if successful
+     */
+    bool persistRemove(const std::string& id);
+
+    /**
+     * @brief Count deferred mutations and schedule a flush (caller holds the lock)
+     * @param changes Number of mutations deferred
+     * @return True if successful
+     *
+     * In GROUP_COMMIT mode waits for the shared write, releasing the lock
+     * meanwhile. In INTERVAL mode flushes at once when maxPendingChanges
+     * is reached.
+     */
+    bool deferWrite(size_t changes);
+
+    /**
+     * @brief Persist deferred mutations (without lock)
+     * @return True if nothing is pending afterwards
+     */
+    bool flushPendingInternal();
+
+    /**
+     * @brief Persist several mutations with one write (without lock)
+     * @param records Journal records describing the mutations
+     * @return True if successful
+     *
+     * Appends all records with one flush in journal mode, rewrites the
+     * file once otherwise.
+     */
+    bool persistRecords(const std::vector<Journal::Record>& records);
+
+    /**
+     * @brief Undo a range operation whose write failed (without lock)
+     * @param oldSize Record count before the batch
+     * @param replaced Slot and previous value of each record the batch replaced, in order
+     * @param recordCount Number of journal records the batch queued
+     */
+    void rollbackRange(size_t oldSize,
+                       const std::vector<std::pair<size_t, Model::Department>>& replaced,
+                       size_t recordCount);
+
+    /**
+     * @brief Re-index departments from the given slot onwards (without lock)
+     * @param from First slot whose position changed (0 rebuilds the whole index)
+     */
+    void rebuildIndex(size_t from = 0);
+
+    /**
+     * @brief Find a department by primary key via the index (without lock)
+     * @param id Primary key
+     * @return Iterator into m_departments, or end() if not found
+     */
+    std::vector<Model::Department>::iterator findById(const std::string& id);
+
 public:
     // ==================== Singleton Access ====================
 
@@ -89,6 +191,18 @@ public:
      */
     std::vector<Model::Department> getAll() override;
 
+    /**
+     * @brief Get an immutable point-in-time view of all departments
+     * @return Snapshot sharing the current records (O(1), nothing is copied)
+     */
+    Snapshot<Model::Department> getSnapshot() const;
+
+    /**
+     * @brief Borrow all records in place under a shared lock
+     * @return View valid until destroyed; do not modify this repository meanwhile
+     */
+    ReadView<Model::Department> view() const override;
+
     /**
      * @brief Get department by department ID
      * @param id Department ID
@@ -117,6 +231,20 @@ public:
      */
     bool remove(const std::string& id) override;
 
+    /**
+     * @brief Add several departments with one write
+     * @param departments Departments to add
+     * @return True if all were added; false (nothing added) if any ID exists or repeats
+     */
+    bool addRange(const std::vector<Model::Department>& departments) override;
+
+    /**
+     * @brief Add new departments and replace existing ones with one write
+     * @param departments Departments to store (a repeated ID keeps the last one)
+     * @return True if successful
+     */
+    bool upsertRange(const std::vector<Model::Department>& departments) override;
+
     // ==================== Persistence ====================
 
     /**
@@ -131,6 +259,65 @@ public:
      */
     bool load() override;
 
+    // ==================== Journal Mode ====================
+
+    /**
+     * @brief Enable or disable append-only journal mode
+     * @param enabled True to log each mutation as one journal record
+     *
+     * In journal mode mutations append a single record instead of rewriting
+     * the data file, and a background snapshot is taken once the compaction
+     * thresholds are reached. save() writes a snapshot and truncates the
+     * journal. Disabling folds the journal into a snapshot.
+     */
+    void setJournalEnabled(bool enabled);
+
+    /**
+     * @brief Check if journal mode is enabled
+     * @return True if mutations are journaled
+     */
+    bool isJournalEnabled() const;
+
+    /**
+     * @brief Number of journal records pending since the last snapshot
+     * @return Record count
+     */
+    size_t getJournalRecordCount() const;
+
+    /**
+     * @brief Set the record-count/size thresholds for background compaction
+     * @param policy New thresholds
+     */
+    void setCompactionPolicy(const Journal::CompactionPolicy& policy);
+
+    // ==================== Durability ====================
+
+    /**
+     * @brief Choose when mutations are persisted
+     * @param policy SYNC (default), GROUP_COMMIT or INTERVAL write-behind
+     *
+     * Changes pending under the old policy are flushed first.
+     */
+    void setDurabilityPolicy(const DurabilityPolicy& policy);
+
+    /**
+     * @brief Get the current durability policy
+     * @return Active policy
+     */
+    DurabilityPolicy getDurabilityPolicy() const;
+
+    /**
+     * @brief Persist deferred mutations now
+     * @return True if nothing is pending afterwards
+     */
+    bool flush();
+
+    /**
+     * @brief Number of mutations not yet persisted
+     * @return Pending change count (always 0 in SYNC mode)
+     */
+    size_t getPendingChangeCount() const;
+
     // ==================== Query Operations ====================
 
     /**
@@ -196,11 +383,22 @@ public:
     std::vector<std::string> getAllNames();
 
     /**
-     * @brief Get the next available department ID
-     * @return New department ID string (e.g., "DEP001")
+     * @brief Get the next available department ID without reserving it
+     * @return ID the next allocateId() call returns (e.g., "DEP001")
+     *
+     * O(1): read from the ID sequence instead of scanning the records.
+     * Use allocateId() for an ID that is about to be added.
      */
     std::string getNextId();
 
+    /**
+     * @brief Reserve a new department ID
+     * @return ID no other caller receives, even concurrently
+     *
+     * IDs are never reused: an ID reserved but not added is skipped.
+     */
+    std::string allocateId();
+
     // ==================== File Path ====================
 
     /**
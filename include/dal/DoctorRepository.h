@@ -1,11 +1,18 @@
 #pragma once
 
 #include "IRepository.h"
+#include "CowVector.h"
+#include "Journal.h"
+#include "GroupCommit.h"
+#include "IdSequence.h"
+#include "WriteBehindFlusher.h"
 #include "../model/Doctor.h"
 #include <vector>
 #include <optional>
+#include <unordered_map>
 #include <string>
 #include <mutex>
+#include <shared_mutex>
 #include <memory>
 
 namespace HMS
@@ -28,19 +35,118 @@ namespace HMS
             static std::mutex s_mutex;
 
             // ==================== Data ====================
-            std::vector<Model::Doctor> m_doctors;
+            CowVector<Model::Doctor> m_doctors;
             std::string m_filePath;
             bool m_isLoaded;
-            mutable std::mutex m_dataMutex;
+            mutable std::shared_mutex m_dataMutex;
+
+            // ==================== Primary Key Index ====================
+            std::unordered_map<std::string, size_t> m_idIndex; // ID -> slot in m_doctors
+            IdSequence m_idSequence; // Next doctor ID, seeded at load
+
+            // ==================== Journal ====================
+            Journal m_journal;
+            bool m_journalEnabled;
+
+            // ==================== Write-Behind ====================
+            DurabilityPolicy m_durability;
+            std::vector<Journal::Record> m_pendingRecords; // Deferred journal records (journal mode only)
+            size_t m_pendingChanges;
+            bool m_flushScheduled; // Set once a flush was handed to the WriteBehindFlusher
+            GroupCommit m_groupCommit;
+
+            // Captures several repositories under one set of shared locks
+            friend struct DataSnapshot;
 
             // ==================== Private Constructor ====================
             DoctorRepository();
 
             // ==================== Private Helpers ====================
             void ensureLoaded() const;
+
+            /**
+             * @brief Acquire a shared lock with the data loaded
+             *
+             * Queries share the lock; the first access upgrades to an exclusive
+             * lock once to load the file.
+             */
+            std::shared_lock<std::shared_mutex> lockForRead() const;
+
+            /**
+             * @brief Acquire the exclusive lock with the data loaded and unshared
+             *
+             * Detaches the records from outstanding snapshots, so call it before
+             * looking up anything that will be modified.
+             */
+            std::unique_lock<std::shared_mutex> lockForWrite();
+
             bool loadInternal();
             bool saveInternal();
 
+            /**
+             * @brief Persist one inserted/updated doctor (without lock)
+             * @return True if successful
+             *
+             * Appends a journal record in journal mode, rewrites the file otherwise.
+             */
+            bool persistUpsert(const Model::Doctor &doctor);
+
+            /**
+             * @brief Persist one removal (without lock)
+             * @return True if successful
+             */
+            bool persistRemove(const std::string &id);
+
+            /**
+             * @brief Count deferred mutations and schedule a flush (caller holds the lock)
+             * @param changes Number of mutations deferred
+             * @return True if successful
+             *
+             * In GROUP_COMMIT mode waits for the shared write, releasing the lock
+             * meanwhile. In INTERVAL mode flushes at once when maxPendingChanges
+             * is reached.
+             */
+            bool deferWrite(size_t changes);
+
+            /**
+             * @brief Persist deferred mutations (without lock)
+             * @return True if nothing is pending afterwards
+             */
+            bool flushPendingInternal();
+
+            /**
+             * @brief Persist several mutations with one write (without lock)
+             * @param records Journal records describing the mutations
+             * @return True if successful
+             *
+             * Appends all records with one flush in journal mode, rewrites the
+             * file once otherwise.
+             */
+            bool persistRecords(const std::vector<Journal::Record> &records);
+
+            /**
+             * @brief Undo a range operation whose write failed (without lock)
+             * @param oldSize Record count before the batch
+             * @param replaced Slot and previous value of each record the batch replaced, in order
+             * @param recordCount Number of journal records the batch queued
+             */
+            void rollbackRange(size_t oldSize,
+                               const std::vector<std::pair<size_t, Model::Doctor>> &replaced,
+                               size_t recordCount);
+
+            /**
+             * @brief Re-index doctors from the given slot onwards (without lock)
+             * @param from First slot whose position changed (0 rebuilds the whole index)
+             */
+            void rebuildIndex(size_t from = 0);
+
+            /**
+             * @brief Find a doctor by primary key via the index (without lock)
+             * @param id Primary key
+             * @return Iterator into m_doctors, or end() if not found
+             */
+            std::vector<Model::Doctor>::iterator findById(const std::string &id);
+
         public:
             // ==================== Singleton Access ====================
 
@@ -78,6 +184,18 @@ namespace HMS
              */
             std::vector<Model::Doctor> getAll() override;
 
+            /**
+             * @brief Get an immutable point-in-time view of all doctors
+             * @return Snapshot sharing the current records (O(1), nothing is copied)
+             */
+            Snapshot<Model::Doctor> getSnapshot() const;
+
+            /**
+             * @brief Borrow all records in place under a shared lock
+             * @return View valid until destroyed; do not modify this repository meanwhile
+             */
+            ReadView<Model::Doctor> view() const override;
+
             /**
              * @brief Get doctor by doctor ID
              * @param id Doctor ID
@@ -106,6 +224,20 @@ namespace HMS
              */
             bool remove(const std::string &id) override;
 
+            /**
+             * @brief Add several doctors with one write
+             * @param doctors Doctors to add
+             * @return True if all were added; false (nothing added) if any ID exists or repeats
+             */
+            bool addRange(const std::vector<Model::Doctor> &doctors) override;
+
+            /**
+             * @brief Add new doctors and replace existing ones with one write
+             * @param doctors Doctors to store (a repeated ID keeps the last one)
+             * @return True if successful
+             */
+            bool upsertRange(const std::vector<Model::Doctor> &doctors) override;
+
             // ==================== Persistence ====================
 
             /**
@@ -120,6 +252,65 @@ namespace HMS
              */
             bool load() override;
 
+            // ==================== Journal Mode ====================
+
+            /**
+             * @brief Enable or disable append-only journal mode
+             * @param enabled True to log each mutation as one journal record
+             *
+             * In journal mode mutations append a single record instead of rewriting
+             * the data file, and a background snapshot is taken once the compaction
+             * thresholds are reached. save() writes a snapshot and truncates the
+             * journal. Disabling folds the journal into a snapshot.
+             */
+            void setJournalEnabled(bool enabled);
+
+            /**
+             * @brief Check if journal mode is enabled
+             * @return True if mutations are journaled
+             */
+            bool isJournalEnabled() const;
+
+            /**
+             * @brief Number of journal records pending since the last snapshot
+             * @return Record count
+             */
+            size_t getJournalRecordCount() const;
+
+            /**
+             * @brief Set the record-count/size thresholds for background compaction
+             * @param policy New thresholds
+             */
+            void setCompactionPolicy(const Journal::CompactionPolicy &policy);
+
+            // ==================== Durability ====================
+
+            /**
+             * @brief Choose when mutations are persisted
+             * @param policy SYNC (default), GROUP_COMMIT or INTERVAL write-behind
+             *
+             * Changes pending under the old policy are flushed first.
+             */
+            void setDurabilityPolicy(const DurabilityPolicy &policy);
+
+            /**
+             * @brief Get the current durability policy
+             * @return Active policy
+             */
+            DurabilityPolicy getDurabilityPolicy() const;
+
+            /**
+             * @brief Persist deferred mutations now
+             * @return True if nothing is pending afterwards
+             */
+            bool flush();
+
+            /**
+             * @brief Number of mutations not yet persisted
+             * @return Pending change count (always 0 in SYNC mode)
+             */
+            size_t getPendingChangeCount() const;
+
             // ==================== Query Operations ====================
 
             /**
@@ -178,11 +369,22 @@ namespace HMS
             std::vector<std::string> getAllSpecializations();
 
             /**
-             * @brief Get the next available doctor ID
-             * @return New doctor ID string
+             * @brief Get the next available doctor ID without reserving it
+             * @return ID the next allocateId() call returns
+             *
+             * O(1): read from the ID sequence instead of scanning the records.
+             * Use allocateId() for an ID that is about to be added.
              */
             std::string getNextId();
 
+            /**
+             * @brief Reserve a new doctor ID
+             * @return ID no other caller receives, even concurrently
+             *
+             * IDs are never reused: an ID reserved but not added is skipped.
+             */
+            std::string allocateId();
+
             // ==================== File Path ====================
 
             /**
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "MappedFile.h"
+
 #include <string>
+#include <string_view>
 #include <vector>
 #include <fstream>
 #include <optional>
@@ -43,6 +46,22 @@ namespace HMS
              */
             static std::optional<std::string> readFile(const std::string &filePath);
 
+            /**
+             * @brief Split a mapped file into data lines without copying
+             * @param file Open mapping of the file
+             * @return Views of the lines (empty lines and comments excluded)
+             *
+             * Views point into the mapping and are valid while it is open.
+             */
+            static std::vector<std::string_view> readLineViews(const MappedFile &file);
+
+            /**
+             * @brief Get the comment lines at the top of a mapped file
+             * @param file Open mapping of the file
+             * @return Views of the leading comment lines (up to the first data line)
+             */
+            static std::vector<std::string_view> readHeaderLines(const MappedFile &file);
+
             // ==================== Write Operations ====================
 
             /**
@@ -50,6 +69,11 @@ namespace HMS
              * @param filePath Path to the file
              * @param lines Vector of lines to write
              * @return True if successful
+             *
+             * The file is replaced atomically: content goes to a temp file
+             * beside it, which is synced and renamed over the target. After
+             * a crash the file holds either the old or the new content, and
+             * on failure the old file is left untouched.
              */
             static bool writeLines(const std::string &filePath,
                                    const std::vector<std::string> &lines);
@@ -59,6 +83,8 @@ namespace HMS
              * @param filePath Path to the file
              * @param content Content to write
              * @return True if successful
+             *
+             * Replaces the file atomically, like writeLines().
              */
             static bool writeFile(const std::string &filePath,
                                   const std::string &content);
@@ -125,9 +151,10 @@ namespace HMS
             /**
              * @brief Create a backup of a file
              * @param filePath Path to the file to backup
-             * @return True if backup was created
+             * @return True if the file is backed up
              *
-             * Creates a copy with timestamp suffix in backup directory
+             * Records the file in the BackupStore; unchanged content is not
+             * copied again and old backups are pruned by its retention policy.
              */
             static bool createBackup(const std::string &filePath);
 
@@ -135,6 +162,8 @@ namespace HMS
              * @brief Restore from the latest backup
              * @param filePath Path to the file to restore
              * @return True if restore was successful
+             *
+             * The latest backup is looked up in the BackupStore index.
              */
             static bool restoreFromBackup(const std::string &filePath);
 
@@ -142,6 +171,9 @@ namespace HMS
              * @brief Get backup file path for a given file
              * @param filePath Original file path
              * @return Backup file path with timestamp
+             *
+             * Naming used by backups made before the BackupStore; such copies
+             * are adopted into its index the first time it is opened.
              */
             static std::string getBackupPath(const std::string &filePath);
 
@@ -152,14 +184,21 @@ namespace HMS
              * @param line The line to check
              * @return True if line is a comment
              */
-            static bool isComment(const std::string &line);
+            static bool isComment(std::string_view line);
 
             /**
              * @brief Check if a line is empty or whitespace only
              * @param line The line to check
              * @return True if line is empty
              */
-            static bool isEmpty(const std::string &line);
+            static bool isEmpty(std::string_view line);
+
+            /**
+             * @brief Check if a path is a test fixture file (never backed up)
+             * @param filePath The path to check
+             * @return True if the path is under test/fixtures
+             */
+            static bool isTestFixture(const std::string &filePath);
 
             /**
              * @brief Get the header comment for a data file
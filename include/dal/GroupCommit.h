@@ -0,0 +1,59 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+namespace HMS
+{
+    namespace DAL
+    {
+
+        /**
+         * @class GroupCommit
+         * @brief Shares one durable write among concurrent writers
+         *
+         * A writer that has applied its change under the repository's
+         * exclusive lock joins the open batch and releases the lock while it
+         * waits. The first waiter with no write in progress becomes the leader:
+         * it retakes the lock, closes the batch and performs one write that
+         * persists the changes of every writer in it, then wakes them all.
+         * Writers arriving during that write form the next batch, so the
+         * number of writes stays near the number of leaders rather than the
+         * number of mutations.
+         */
+        class GroupCommit
+        {
+        private:
+            struct Batch
+            {
+                bool done = false;
+                bool ok = false;
+            };
+
+            std::shared_ptr<Batch> m_open; // Batch new writers join (null until the first)
+            bool m_leaderActive = false;
+            std::mutex m_mutex;
+            std::condition_variable m_done;
+
+        public:
+            GroupCommit() = default;
+            GroupCommit(const GroupCommit &) = delete;
+            GroupCommit &operator=(const GroupCommit &) = delete;
+
+            /**
+             * @brief Wait until the caller's change is durable
+             * @param dataMutex Repository lock, held exclusively by the caller
+             * @param flush Writes every pending change (called with dataMutex held)
+             * @return Result of the write that covered the caller's change
+             *
+             * dataMutex is released while waiting and held again on return, so
+             * the caller must not use anything it looked up before the call.
+             */
+            bool commit(std::shared_mutex &dataMutex, const std::function<bool()> &flush);
+        };
+
+    } // namespace DAL
+} // namespace HMS
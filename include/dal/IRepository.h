@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ReadView.h"
 #include <vector>
 #include <optional>
 #include <string>
@@ -63,6 +64,20 @@ namespace HMS
              */
             virtual bool remove(const std::string &id) = 0;
 
+            /**
+             * @brief Add several entities, persisted with a single write
+             * @param entities The entities to add
+             * @return True if all were added; false (and nothing added) if any key exists or repeats
+             */
+            virtual bool addRange(const std::vector<T> &entities) = 0;
+
+            /**
+             * @brief Add new entities and replace existing ones, persisted with a single write
+             * @param entities The entities to store (the last one wins for a repeated key)
+             * @return True if successful, false otherwise
+             */
+            virtual bool upsertRange(const std::vector<T> &entities) = 0;
+
             // ==================== Persistence Operations ====================
 
             /**
@@ -97,6 +112,58 @@ namespace HMS
              * @return True if successful, false otherwise
              */
             virtual bool clear() = 0;
+
+            // ==================== Zero-Copy Access ====================
+
+            /**
+             * @brief Borrow all entities in place under a shared lock
+             * @return View over the stored entities (nothing is copied)
+             *
+             * Release the view before calling into another repository.
+             */
+            virtual ReadView<T> view() const = 0;
+
+            /**
+             * @brief Visit every entity in place
+             * @param visit Callable taking const T&
+             *
+             * The visitor runs under the repository's shared lock. It must not
+             * call into this or any other repository: a nested lock can
+             * deadlock against writers. Collect what is needed first (or copy
+             * the entities out) and do further lookups after the call.
+             */
+            template <typename Visitor>
+            void forEach(Visitor &&visit) const
+            {
+                for (const T &entity : view())
+                {
+                    visit(entity);
+                }
+            }
+
+            /**
+             * @brief Visit the entities matching a predicate in place
+             * @param pred Callable taking const T& and returning bool
+             * @param visit Callable taking const T&
+             * @return Number of entities visited
+             *
+             * pred and visit run under the repository's shared lock and must
+             * not call into any repository (see forEach()).
+             */
+            template <typename Predicate, typename Visitor>
+            size_t scan(Predicate &&pred, Visitor &&visit) const
+            {
+                size_t visited = 0;
+                for (const T &entity : view())
+                {
+                    if (pred(entity))
+                    {
+                        visit(entity);
+                        ++visited;
+                    }
+                }
+                return visited;
+            }
         };
 
     } // namespace DAL
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace HMS
+{
+    namespace DAL
+    {
+
+        /**
+         * @class IdSequence
+         * @brief Monotonic generator for prefixed IDs (e.g. D001, APT1000)
+         *
+         * The owning repository seeds the sequence once per load: from the
+         * high-water mark stored in its data file header and from every ID it
+         * reads. Adding a record with a larger ID raises the sequence, so
+         * explicitly chosen IDs are never handed out again.
+         *
+         * allocate() is a single atomic increment: concurrent callers never
+         * receive the same ID and no record is scanned. Numbers are not
+         * reused, even after the record holding the highest one is removed,
+         * as long as the high-water mark is written with the data
+         * (see getHeaderLine()).
+         *
+         * Numbers are zero-padded to Constants::ID_MIN_DIGITS and grow beyond
+         * that width instead of overflowing it, so plain string order puts
+         * D1000 before D999. Containers and sorts keyed by ID use IdLess,
+         * which orders IDs by number.
+         */
+        class IdSequence
+        {
+        private:
+            std::string m_prefix;
+            std::atomic<std::uint64_t> m_next; // Number the next allocation returns
+
+        public:
+            /**
+             * @brief Construct an empty sequence (starts at 1)
+             * @param prefix ID prefix (e.g. "APT")
+             */
+            explicit IdSequence(std::string prefix);
+
+            IdSequence(const IdSequence &) = delete;
+            IdSequence &operator=(const IdSequence &) = delete;
+
+            // ==================== Seeding ====================
+
+            /**
+             * @brief Start over at 1 (before a reload or after clearing the data)
+             */
+            void reset();
+
+            /**
+             * @brief Make sure the sequence is past an existing ID
+             * @param id ID of a stored or removed record (others are ignored)
+             */
+            void observe(std::string_view id);
+
+            /**
+             * @brief Restore the high-water mark from a data file header line
+             * @param line Line as written by getHeaderLine()
+             * @return True if the line was a sequence header
+             */
+            bool restore(std::string_view line);
+
+            // ==================== Allocation ====================
+
+            /**
+             * @brief Reserve the next ID (thread-safe, O(1))
+             * @return New ID, never returned before by this sequence
+             */
+            std::string allocate();
+
+            /**
+             * @brief ID the next allocate() would return, without reserving it
+             * @return Next ID
+             */
+            std::string peek() const;
+
+            /**
+             * @brief Header line recording the high-water mark (e.g. "# nextId=42")
+             * @return Comment line for the data file
+             */
+            std::string getHeaderLine() const;
+
+            // ==================== Utility Methods ====================
+
+            /**
+             * @brief Extract the number of a prefixed ID
+             * @param prefix ID prefix
+             * @param id ID to parse
+             * @return Number, or nullopt if id is not prefix + digits
+             */
+            static std::optional<std::uint64_t> parse(std::string_view prefix, std::string_view id);
+
+            /**
+             * @brief Format a prefixed ID
+             * @param prefix ID prefix
+             * @param number ID number
+             * @return prefix + number, zero-padded to at least ID_MIN_DIGITS digits
+             */
+            static std::string format(std::string_view prefix, std::uint64_t number);
+
+            /**
+             * @brief Order two IDs by prefix, then by number
+             * @param a First ID
+             * @param b Second ID
+             * @return Negative, zero or positive like std::string::compare
+             */
+            static int compare(std::string_view a, std::string_view b);
+        };
+
+        /**
+         * @struct IdLess
+         * @brief Transparent comparator ordering IDs by IdSequence::compare()
+         *
+         * Use as the comparator of ID-keyed ordered containers, e.g.
+         * std::map<std::string, DoctorStats, IdLess>.
+         */
+        struct IdLess
+        {
+            using is_transparent = void;
+
+            bool operator()(std::string_view a, std::string_view b) const
+            {
+                return IdSequence::compare(a, b) < 0;
+            }
+        };
+
+    } // namespace DAL
+} // namespace HMS
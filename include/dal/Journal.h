@@ -0,0 +1,419 @@
+#pragma once
+
+#include "../common/Constants.h"
+#include "CowVector.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace HMS
+{
+    namespace DAL
+    {
+
+        /**
+         * @class Journal
+         * @brief Append-only log of repository mutations
+         *
+         * Each mutation is written as a single line next to the data file
+         * (e.g. Appointment.txt.journal), so persisting one change costs the
+         * size of one record instead of a rewrite of the whole data file.
+         * The data file acts as the snapshot; replaying the journal on top
+         * of it rebuilds the current state.
+         *
+         * Record format (one per line):
+         *   U|<serialized entity>   - insert or replace by primary key
+         *   D|<id>                  - remove by primary key
+         *
+         * Records are idempotent, so replaying a journal over a snapshot that
+         * already contains some of its changes yields the same state.
+         *
+         * Compaction: once the CompactionPolicy thresholds are reached the
+         * active journal is rotated to a ".compacting" segment and a snapshot
+         * of the repository data is handed to the CompactionWorker, which writes
+         * a new snapshot and then deletes the segment. Replay reads the
+         * compacting segment (if any) before the active journal.
+         *
+         * A successful append has been synced with fdatasync() (on Windows only
+         * flushed to the OS). Each call syncs once, so batching records
+         * into one call is what makes group commit and write-behind cheaper.
+         *
+         * Not thread-safe: the owning repository serializes access.
+         */
+        class Journal
+        {
+        public:
+            /**
+             * @brief Kind of mutation recorded in the journal
+             */
+            enum class Operation
+            {
+                UPSERT,
+                REMOVE
+            };
+
+            /**
+             * @struct Record
+             * @brief One decoded journal entry
+             */
+            struct Record
+            {
+                Operation operation;
+                std::string payload; // Serialized entity (UPSERT) or ID (REMOVE)
+            };
+
+            /**
+             * @struct CompactionPolicy
+             * @brief Thresholds that trigger a background snapshot
+             *
+             * A value of 0 disables that threshold.
+             */
+            struct CompactionPolicy
+            {
+                size_t maxRecords = Constants::JOURNAL_COMPACT_MAX_RECORDS;
+                std::uintmax_t maxBytes = Constants::JOURNAL_COMPACT_MAX_BYTES;
+            };
+
+            // ==================== Constructors ====================
+
+            /**
+             * @brief Construct a journal for the given data file
+             * @param dataFilePath Path of the data file the journal belongs to
+             */
+            explicit Journal(const std::string &dataFilePath = "");
+
+            /**
+             * @brief Destructor (waits for a pending compaction)
+             */
+            ~Journal();
+
+            Journal(const Journal &) = delete;
+            Journal &operator=(const Journal &) = delete;
+
+            // ==================== Configuration ====================
+
+            /**
+             * @brief Point the journal at a different data file
+             * @param dataFilePath Path of the data file
+             */
+            void setDataFilePath(const std::string &dataFilePath);
+
+            /**
+             * @brief Get the journal file path
+             * @return Path of the .journal file
+             */
+            std::string getFilePath() const;
+
+            /**
+             * @brief Set the compaction thresholds
+             * @param policy New thresholds
+             */
+            void setCompactionPolicy(const CompactionPolicy &policy);
+
+            /**
+             * @brief Get the compaction thresholds
+             * @return Current policy
+             */
+            CompactionPolicy getCompactionPolicy() const;
+
+            /**
+             * @brief Add a header line to background snapshots
+             * @param header Returns the line; called when a compaction is scheduled
+             *
+             * Lets the owner keep metadata such as its ID sequence in snapshots
+             * it does not write itself.
+             */
+            void setSnapshotHeader(std::function<std::string()> header);
+
+            // ==================== Write Operations ====================
+
+            /**
+             * @brief Append one record and sync it to disk
+             * @param operation Mutation kind
+             * @param payload Serialized entity or ID
+             * @return True if the record was written (on failure the file is cut back)
+             */
+            bool append(Operation operation, const std::string &payload);
+
+            /**
+             * @brief Append several records with a single sync to disk
+             * @param records Records in the order they are applied
+             * @return True if every record was written (on failure none are kept)
+             */
+            bool append(const std::vector<Record> &records);
+
+            /**
+             * @brief Append several records and compact in the background if due
+             * @param records Records in the order they are applied
+             * @param items Current repository contents (shared with the worker, not copied)
+             * @param fileType File type for the snapshot header (see FileHelper::getFileHeader)
+             * @return True if every record was written
+             */
+            template <typename T>
+            bool append(const std::vector<Record> &records,
+                        const CowVector<T> &items, const std::string &fileType)
+            {
+                if (!append(records))
+                {
+                    return false;
+                }
+
+                if (needsCompaction())
+                {
+                    compactInBackground(items.snapshot(), fileType);
+                }
+                return true;
+            }
+
+            /**
+             * @brief Append one record and compact in the background if due
+             * @param operation Mutation kind
+             * @param payload Serialized entity or ID
+             * @param items Current repository contents (copied only when compacting)
+             * @param fileType File type for the snapshot header (see FileHelper::getFileHeader)
+             * @return True if the record was written
+             */
+            template <typename T>
+            bool append(Operation operation, const std::string &payload,
+                        const std::vector<T> &items, const std::string &fileType)
+            {
+                if (!append(operation, payload))
+                {
+                    return false;
+                }
+
+                if (needsCompaction())
+                {
+                    compactInBackground(std::make_shared<const std::vector<T>>(items), fileType);
+                }
+                return true;
+            }
+
+            /**
+             * @brief Append one record and compact in the background if due
+             * @param operation Mutation kind
+             * @param payload Serialized entity or ID
+             * @param items Current repository contents (shared with the worker, not copied)
+             * @param fileType File type for the snapshot header (see FileHelper::getFileHeader)
+             * @return True if the record was written
+             */
+            template <typename T>
+            bool append(Operation operation, const std::string &payload,
+                        const CowVector<T> &items, const std::string &fileType)
+            {
+                if (!append(operation, payload))
+                {
+                    return false;
+                }
+
+                if (needsCompaction())
+                {
+                    compactInBackground(items.snapshot(), fileType);
+                }
+                return true;
+            }
+
+            /**
+             * @brief Discard all records (after a snapshot has been written)
+             * @return True if the journal is empty afterwards
+             */
+            bool truncate();
+
+            // ==================== Compaction ====================
+
+            /**
+             * @brief Check if the thresholds are reached and no compaction is running
+             * @return True if a compaction should be scheduled
+             */
+            bool needsCompaction() const;
+
+            /**
+             * @brief Rotate the journal and write a snapshot on the worker thread
+             * @param snapshot Repository contents at the time of the call
+             * @param fileType File type for the snapshot header
+             * @return True if a compaction was scheduled
+             */
+            template <typename T>
+            bool compactInBackground(Snapshot<T> snapshot, const std::string &fileType)
+            {
+                if (isCompactionPending())
+                {
+                    return false;
+                }
+
+                return scheduleCompaction(fileType, [snapshot]()
+                                          {
+                    std::vector<std::string> lines;
+                    lines.reserve(snapshot->size());
+                    for (const auto &item : *snapshot)
+                    {
+                        lines.push_back(item.serialize());
+                    }
+                    return lines; });
+            }
+
+            /**
+             * @brief Check if a background compaction is queued or running
+             * @return True if pending
+             */
+            bool isCompactionPending() const;
+
+            /**
+             * @brief Block until the pending compaction (if any) has finished
+             *
+             * Must be called before the owner reads or rewrites the data file.
+             */
+            void waitForCompaction() const;
+
+            // ==================== Read Operations ====================
+
+            /**
+             * @brief Read all complete records in file order
+             * @return Vector of records
+             *
+             * A trailing record without a newline (torn write from a crash)
+             * is dropped and cut from the file so later appends stay aligned.
+             */
+            std::vector<Record> readRecords();
+
+            /**
+             * @brief Replay all records onto the loaded snapshot
+             * @param items Entities read from the data file
+             * @param keyOf Function returning the primary key of an entity
+             */
+            template <typename T, typename KeyFn>
+            void replay(std::vector<T> &items, KeyFn keyOf)
+            {
+                replay(items, keyOf, [](const std::string &) {});
+            }
+
+            /**
+             * @brief Replay all records onto the loaded snapshot
+             * @param items Entities read from the data file
+             * @param keyOf Function returning the primary key of an entity
+             * @param onRemove Called with the ID of every REMOVE record
+             */
+            template <typename T, typename KeyFn, typename RemoveFn>
+            void replay(std::vector<T> &items, KeyFn keyOf, RemoveFn onRemove)
+            {
+                auto records = readRecords();
+                if (records.empty())
+                {
+                    return;
+                }
+
+                std::unordered_map<std::string, size_t> slots;
+                slots.reserve(items.size() + records.size());
+                for (size_t i = 0; i < items.size(); ++i)
+                {
+                    slots[keyOf(items[i])] = i;
+                }
+
+                std::vector<bool> removed(items.size(), false);
+                for (auto &record : records)
+                {
+                    if (record.operation == Operation::REMOVE)
+                    {
+                        onRemove(record.payload);
+                        auto it = slots.find(record.payload);
+                        if (it != slots.end())
+                        {
+                            removed[it->second] = true;
+                            slots.erase(it);
+                        }
+                        continue;
+                    }
+
+                    auto entity = T::deserialize(record.payload);
+                    if (!entity)
+                    {
+                        continue;
+                    }
+
+                    auto [it, inserted] = slots.try_emplace(keyOf(*entity), items.size());
+                    if (inserted)
+                    {
+                        items.push_back(std::move(*entity));
+                        removed.push_back(false);
+                    }
+                    else
+                    {
+                        items[it->second] = std::move(*entity);
+                    }
+                }
+
+                size_t kept = 0;
+                for (size_t i = 0; i < items.size(); ++i)
+                {
+                    if (!removed[i])
+                    {
+                        if (kept != i)
+                        {
+                            items[kept] = std::move(items[i]);
+                        }
+                        ++kept;
+                    }
+                }
+                items.erase(items.begin() + static_cast<std::ptrdiff_t>(kept), items.end());
+            }
+
+            /**
+             * @brief Number of records written since the last truncate or rotation
+             * @return Record count
+             */
+            size_t getRecordCount() const;
+
+            /**
+             * @brief Size of the active journal segment
+             * @return Size in bytes
+             */
+            std::uintmax_t getSizeBytes() const;
+
+            // ==================== Utility Methods ====================
+
+            /**
+             * @brief Get the journal path for a data file
+             * @param dataFilePath Path of the data file
+             * @return dataFilePath + ".journal"
+             */
+            static std::string getJournalPath(const std::string &dataFilePath);
+
+        private:
+            /**
+             * @struct CompactionState
+             * @brief Completion flag shared with the worker task
+             */
+            struct CompactionState
+            {
+                std::mutex mutex;
+                std::condition_variable done;
+                bool pending = false;
+            };
+
+            std::string m_dataFilePath;
+            std::string m_filePath;
+            std::ofstream m_stream;
+            size_t m_recordCount;
+            std::uintmax_t m_sizeBytes;
+            CompactionPolicy m_policy;
+            std::shared_ptr<CompactionState> m_compaction;
+            std::function<std::string()> m_snapshotHeader;
+
+            void discardTail(std::uintmax_t size);
+            void closeStream();
+            std::string getCompactingPath() const;
+            bool rotate();
+            bool scheduleCompaction(const std::string &fileType,
+                                    std::function<std::vector<std::string>()> serialize);
+            static void readSegment(const std::string &path, std::vector<Record> &records);
+        };
+
+    } // namespace DAL
+} // namespace HMS
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "common/Constants.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace HMS
+{
+    namespace DAL
+    {
+
+        /**
+         * @class ParseWorkerBudget
+         * @brief Reservation of extra parseLines() workers from a process-wide cap
+         *
+         * Reserves at most the requested number of threads, fewer if other
+         * calls hold part of the budget, and returns them on destruction.
+         */
+        class ParseWorkerBudget
+        {
+        private:
+            inline static std::atomic<size_t> s_inUse{0}; // Extra workers running in all calls
+            size_t m_reserved = 0;
+
+        public:
+            explicit ParseWorkerBudget(size_t wanted)
+            {
+                const size_t cap = std::max(1u, std::thread::hardware_concurrency()) - 1;
+                size_t inUse = s_inUse.load();
+                do
+                {
+                    m_reserved = std::min(wanted, cap - std::min(cap, inUse));
+                } while (m_reserved > 0 && !s_inUse.compare_exchange_weak(inUse, inUse + m_reserved));
+            }
+
+            ~ParseWorkerBudget()
+            {
+                s_inUse -= m_reserved;
+            }
+
+            ParseWorkerBudget(const ParseWorkerBudget &) = delete;
+            ParseWorkerBudget &operator=(const ParseWorkerBudget &) = delete;
+
+            /**
+             * @brief Number of extra threads this reservation may start
+             */
+            size_t reserved() const { return m_reserved; }
+
+            /**
+             * @brief Extra workers currently running across all calls
+             */
+            static size_t inUse() { return s_inUse.load(); }
+        };
+
+        /**
+         * @brief Deserialize data file lines on all cores, keeping file order
+         *
+         * The lines are cut into one contiguous chunk per worker. Each chunk
+         * is parsed on its own thread and the results are appended in chunk
+         * order, so the output matches a serial pass line for line. Files
+         * below Constants::PARALLEL_LOAD_MIN_LINES per worker are parsed on
+         * the calling thread.
+         *
+         * Workers live only for the call, so loaders may run concurrently
+         * without waiting on a shared pool. Extra threads come from one
+         * process-wide budget of hardware_concurrency() - 1 (see
+         * ParseWorkerBudget): concurrent loaders split the cores instead of
+         * each starting a thread per core, and a call that finds the budget
+         * spent parses on the calling thread alone.
+         *
+         * @param lines Line views (must stay valid for the call)
+         * @param parse Thread-safe callable returning Result<T> for a line
+         * @return Successfully parsed records in file order
+         */
+        template <typename T, typename Parse>
+        std::vector<T> parseLines(const std::vector<std::string_view> &lines, Parse parse)
+        {
+            size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+            size_t workers = std::min(hardware, lines.size() / Constants::PARALLEL_LOAD_MIN_LINES);
+            workers = std::max<size_t>(workers, 1);
+
+            // The calling thread parses the first chunk; the rest need a reserved thread each
+            ParseWorkerBudget budget(workers - 1);
+            workers = budget.reserved() + 1;
+
+            std::vector<std::vector<T>> chunks(workers);
+            std::vector<std::exception_ptr> errors(workers);
+
+            auto parseChunk = [&](size_t chunk)
+            {
+                try
+                {
+                    size_t begin = lines.size() * chunk / workers;
+                    size_t end = lines.size() * (chunk + 1) / workers;
+                    chunks[chunk].reserve(end - begin);
+
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        auto record = parse(lines[i]);
+                        if (record)
+                        {
+                            chunks[chunk].push_back(std::move(*record));
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    errors[chunk] = std::current_exception();
+                }
+            };
+
+            {
+                std::vector<std::jthread> threads;
+                threads.reserve(workers - 1);
+                for (size_t chunk = 1; chunk < workers; ++chunk)
+                {
+                    threads.emplace_back(parseChunk, chunk);
+                }
+                parseChunk(0);
+            } // joins the workers
+
+            for (const auto &error : errors)
+            {
+                if (error)
+                {
+                    std::rethrow_exception(error);
+                }
+            }
+
+            if (workers == 1)
+            {
+                return std::move(chunks.front());
+            }
+
+            std::vector<T> records;
+            size_t total = 0;
+            for (const auto &chunk : chunks)
+            {
+                total += chunk.size();
+            }
+            records.reserve(total);
+            for (auto &chunk : chunks)
+            {
+                records.insert(records.end(),
+                               std::make_move_iterator(chunk.begin()),
+                               std::make_move_iterator(chunk.end()));
+            }
+            return records;
+        }
+
+    } // namespace DAL
+} // namespace HMS
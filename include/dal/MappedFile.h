@@ -0,0 +1,93 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace HMS
+{
+    namespace DAL
+    {
+
+        /**
+         * @class MappedFile
+         * @brief Read-only memory mapping of a whole file
+         *
+         * Exposes the file content as a std::string_view without copying
+         * it into the heap, so loaders can hand line views straight to the
+         * model deserializers. On platforms without mmap the content is
+         * read into an owned buffer instead; the interface is the same.
+         *
+         * Views obtained from view() are valid until the object is closed
+         * or destroyed. The file must not be truncated while it is mapped.
+         */
+        class MappedFile
+        {
+        public:
+            // ==================== Constructors ====================
+
+            /**
+             * @brief Construct an empty (closed) mapping
+             */
+            MappedFile() = default;
+
+            /**
+             * @brief Map the given file
+             * @param filePath Path to the file
+             */
+            explicit MappedFile(const std::string &filePath);
+
+            /**
+             * @brief Destructor (unmaps the file)
+             */
+            ~MappedFile();
+
+            MappedFile(const MappedFile &) = delete;
+            MappedFile &operator=(const MappedFile &) = delete;
+
+            MappedFile(MappedFile &&other) noexcept;
+            MappedFile &operator=(MappedFile &&other) noexcept;
+
+            // ==================== Operations ====================
+
+            /**
+             * @brief Map a file, closing any previous mapping
+             * @param filePath Path to the file
+             * @return True if the file could be opened (an empty file is valid)
+             */
+            bool open(const std::string &filePath);
+
+            /**
+             * @brief Release the mapping
+             */
+            void close();
+
+            // ==================== Accessors ====================
+
+            /**
+             * @brief Check if a file is open
+             * @return True if open
+             */
+            bool isOpen() const;
+
+            /**
+             * @brief Get the whole file content
+             * @return View over the mapped bytes
+             */
+            std::string_view view() const;
+
+            /**
+             * @brief Get the file size
+             * @return Size in bytes
+             */
+            size_t size() const;
+
+        private:
+            const char *m_data = nullptr;
+            size_t m_size = 0;
+            bool m_isOpen = false;
+            bool m_isMapped = false; // True if m_data must be unmapped
+            std::string m_buffer;    // Fallback storage when mmap is unavailable
+        };
+
+    } // namespace DAL
+} // namespace HMS
@@ -1,11 +1,18 @@
 #pragma once
 
 #include "IRepository.h"
+#include "CowVector.h"
+#include "Journal.h"
+#include "GroupCommit.h"
+#include "IdSequence.h"
+#include "WriteBehindFlusher.h"
 #include "../advance/Medicine.h"
 #include <vector>
 #include <optional>
+#include <unordered_map>
 #include <string>
 #include <mutex>
+#include <shared_mutex>
 #include <memory>
 
 namespace HMS
@@ -28,10 +35,31 @@ namespace HMS
             static std::mutex s_mutex;
 
             // ==================== Data ====================
-            std::vector<Model::Medicine> m_medicines;
+            CowVector<Model::Medicine> m_medicines;
             std::string m_filePath;
             bool m_isLoaded;
-            mutable std::mutex m_dataMutex;
+            mutable std::shared_mutex m_dataMutex;
+
+            // ==================== Primary Key Index ====================
+            std::unordered_map<std::string, size_t> m_idIndex; // ID -> slot in m_medicines
+            IdSequence m_idSequence; // Next medicine ID, seeded at load
+
+            // ==================== Journal ====================
+            Journal m_journal;
+            bool m_journalEnabled;
+
+            // ==================== Write-Behind ====================
+            DurabilityPolicy m_durability;
+            std::vector<Journal::Record> m_pendingRecords; // Deferred journal records (journal mode only)
+            size_t m_pendingChanges;
+            bool m_flushScheduled; // Set once a flush was handed to the WriteBehindFlusher
+            GroupCommit m_groupCommit;
+
+            // Captures several repositories under one set of shared locks
+            friend struct DataSnapshot;
+
+            // Commits staged changes to several repositories under their exclusive locks
+            friend class UnitOfWork;
 
             // ==================== Private Constructor ====================
             MedicineRepository();
@@ -43,6 +71,22 @@ namespace HMS
              */
             void ensureLoaded() const;
 
+            /**
+             * @brief Acquire a shared lock with the data loaded
+             *
+             * Queries share the lock; the first access upgrades to an exclusive
+             * lock once to load the file.
+             */
+            std::shared_lock<std::shared_mutex> lockForRead() const;
+
+            /**
+             * @brief Acquire the exclusive lock with the data loaded and unshared
+             *
+             * Detaches the records from outstanding snapshots, so call it before
+             * looking up anything that will be modified.
+             */
+            std::unique_lock<std::shared_mutex> lockForWrite();
+
             /**
              * @brief Internal load implementation (without lock)
              * @return True if successful
@@ -55,6 +99,77 @@ namespace HMS
              */
             bool saveInternal();
 
+            /**
+             * @brief Persist one inserted/updated medicine (without lock)
+             * @return True if successful
+             *
+             * Appends a journal record in journal mode, rewrites the file otherwise.
+             */
+            bool persistUpsert(const Model::Medicine &medicine);
+
+            /**
+             * @brief Persist one removal (without lock)
+             * @return True if successful
+             */
+            bool persistRemove(const std::string &id);
+
+            /**
+             * @brief Count deferred mutations and schedule a flush (caller holds the lock)
+             * @param changes Number of mutations deferred
+             * @return True if successful
+             *
+             * In GROUP_COMMIT mode waits for the shared write, releasing the lock
+             * meanwhile. In INTERVAL mode flushes at once when maxPendingChanges
+             * is reached.
+             */
+            bool deferWrite(size_t changes);
+
+            /**
+             * @brief Persist deferred mutations (without lock)
+             * @return True if nothing is pending afterwards
+             */
+            bool flushPendingInternal();
+
+            /**
+             * @brief Persist several mutations with one write (without lock)
+             * @param records Journal records describing the mutations
+             * @return True if successful
+             *
+             * Appends all records with one flush in journal mode, rewrites the
+             * file once otherwise.
+             */
+            bool persistRecords(const std::vector<Journal::Record> &records);
+
+            /**
+             * @brief Undo a range operation whose write failed (without lock)
+             * @param oldSize Record count before the batch
+             * @param replaced Slot and previous value of each record the batch replaced, in order
+             * @param recordCount Number of journal records the batch queued
+             */
+            void rollbackRange(size_t oldSize,
+                               const std::vector<std::pair<size_t, Model::Medicine>> &replaced,
+                               size_t recordCount);
+
+            /**
+             * @brief Drop the last records queued by persistRecords() (without lock)
+             * @param count Number of records to drop
+             * @return True if they were still pending, false if already written
+             */
+            bool discardPendingRecords(size_t count);
+
+            /**
+             * @brief Re-index medicines from the given slot onwards (without lock)
+             * @param from First slot whose position changed (0 rebuilds the whole index)
+             */
+            void rebuildIndex(size_t from = 0);
+
+            /**
+             * @brief Find a medicine by primary key via the index (without lock)
+             * @param id Primary key
+             * @return Iterator into m_medicines, or end() if not found
+             */
+            std::vector<Model::Medicine>::iterator findById(const std::string &id);
+
         public:
             // ==================== Singleton Access ====================
 
@@ -92,6 +207,18 @@ namespace HMS
              */
             std::vector<Model::Medicine> getAll() override;
 
+            /**
+             * @brief Get an immutable point-in-time view of all medicines
+             * @return Snapshot sharing the current records (O(1), nothing is copied)
+             */
+            Snapshot<Model::Medicine> getSnapshot() const;
+
+            /**
+             * @brief Borrow all records in place under a shared lock
+             * @return View valid until destroyed; do not modify this repository meanwhile
+             */
+            ReadView<Model::Medicine> view() const override;
+
             /**
              * @brief Get medicine by medicine ID
              * @param id Medicine ID
@@ -120,6 +247,20 @@ namespace HMS
              */
             bool remove(const std::string &id) override;
 
+            /**
+             * @brief Add several medicines with one write
+             * @param medicines Medicines to add
+             * @return True if all were added; false (nothing added) if any ID exists or repeats
+             */
+            bool addRange(const std::vector<Model::Medicine> &medicines) override;
+
+            /**
+             * @brief Add new medicines and replace existing ones with one write
+             * @param medicines Medicines to store (a repeated ID keeps the last one)
+             * @return True if successful
+             */
+            bool upsertRange(const std::vector<Model::Medicine> &medicines) override;
+
             // ==================== Persistence ====================
 
             /**
@@ -134,6 +275,65 @@ namespace HMS
              */
             bool load() override;
 
+            // ==================== Journal Mode ====================
+
+            /**
+             * @brief Enable or disable append-only journal mode
+             * @param enabled True to log each mutation as one journal record
+             *
+             * In journal mode mutations append a single record instead of rewriting
+             * the data file, and a background snapshot is taken once the compaction
+             * thresholds are reached. save() writes a snapshot and truncates the
+             * journal. Disabling folds the journal into a snapshot.
+             */
+            void setJournalEnabled(bool enabled);
+
+            /**
+             * @brief Check if journal mode is enabled
+             * @return True if mutations are journaled
+             */
+            bool isJournalEnabled() const;
+
+            /**
+             * @brief Number of journal records pending since the last snapshot
+             * @return Record count
+             */
+            size_t getJournalRecordCount() const;
+
+            /**
+             * @brief Set the record-count/size thresholds for background compaction
+             * @param policy New thresholds
+             */
+            void setCompactionPolicy(const Journal::CompactionPolicy &policy);
+
+            // ==================== Durability ====================
+
+            /**
+             * @brief Choose when mutations are persisted
+             * @param policy SYNC (default), GROUP_COMMIT or INTERVAL write-behind
+             *
+             * Changes pending under the old policy are flushed first.
+             */
+            void setDurabilityPolicy(const DurabilityPolicy &policy);
+
+            /**
+             * @brief Get the current durability policy
+             * @return Active policy
+             */
+            DurabilityPolicy getDurabilityPolicy() const;
+
+            /**
+             * @brief Persist deferred mutations now
+             * @return True if nothing is pending afterwards
+             */
+            bool flush();
+
+            /**
+             * @brief Number of mutations not yet persisted
+             * @return Pending change count (always 0 in SYNC mode)
+             */
+            size_t getPendingChangeCount() const;
+
             // ==================== Query Operations ====================
 
             /**
@@ -210,11 +410,22 @@ namespace HMS
             std::vector<std::string> getAllManufacturers();
 
             /**
-             * @brief Get the next available medicine ID
-             * @return New medicine ID string (e.g., "MED001")
+             * @brief Get the next available medicine ID without reserving it
+             * @return ID the next allocateId() call returns (e.g., "MED001")
+             *
+             * O(1): read from the ID sequence instead of scanning the records.
+             * Use allocateId() for an ID that is about to be added.
              */
             std::string getNextId();
 
+            /**
+             * @brief Reserve a new medicine ID
+             * @return ID no other caller receives, even concurrently
+             *
+             * IDs are never reused: an ID reserved but not added is skipped.
+             */
+            std::string allocateId();
+
             // ==================== Stock Operations ====================
 
             /**
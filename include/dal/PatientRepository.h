@@ -1,11 +1,19 @@
 #pragma once
 
 #include "IRepository.h"
+#include "CowVector.h"
+#include "Journal.h"
+#include "GroupCommit.h"
+#include "IdSequence.h"
+#include "WriteBehindFlusher.h"
 #include "../model/Patient.h"
 #include <vector>
+#include <functional>
 #include <optional>
+#include <unordered_map>
 #include <string>
 #include <mutex>
+#include <shared_mutex>
 #include <memory>
 
 namespace HMS
@@ -22,16 +30,42 @@ namespace HMS
          */
         class PatientRepository : public IRepository<Model::Patient>
         {
+        public:
+            /**
+             * @brief Key that must not be shared by two stored patients (e.g. the username)
+             *
+             * Empty keys are not checked.
+             */
+            using UniqueKey = std::function<const std::string &(const Model::Patient &)>;
+
         private:
             // ==================== Singleton ====================
             static std::unique_ptr<PatientRepository> s_instance;
             static std::mutex s_mutex;
 
             // ==================== Data ====================
-            std::vector<Model::Patient> m_patients;
+            CowVector<Model::Patient> m_patients;
             std::string m_filePath;
             bool m_isLoaded;
-            mutable std::mutex m_dataMutex;
+            mutable std::shared_mutex m_dataMutex;
+
+            // ==================== Primary Key Index ====================
+            std::unordered_map<std::string, size_t> m_idIndex; // ID -> slot in m_patients
+            IdSequence m_idSequence; // Next patient ID, seeded at load
+
+            // ==================== Journal ====================
+            Journal m_journal;
+            bool m_journalEnabled;
+
+            // ==================== Write-Behind ====================
+            DurabilityPolicy m_durability;
+            std::vector<Journal::Record> m_pendingRecords; // Deferred journal records (journal mode only)
+            size_t m_pendingChanges;
+            bool m_flushScheduled; // Set once a flush was handed to the WriteBehindFlusher
+            GroupCommit m_groupCommit;
+
+            // Captures several repositories under one set of shared locks
+            friend struct DataSnapshot;
 
             // ==================== Private Constructor ====================
             PatientRepository();
@@ -43,6 +77,22 @@ namespace HMS
              */
             void ensureLoaded() const;
 
+            /**
+             * @brief Acquire a shared lock with the data loaded
+             *
+             * Queries share the lock; the first access upgrades to an exclusive
+             * lock once to load the file.
+             */
+            std::shared_lock<std::shared_mutex> lockForRead() const;
+
+            /**
+             * @brief Acquire the exclusive lock with the data loaded and unshared
+             *
+             * Detaches the records from outstanding snapshots, so call it before
+             * looking up anything that will be modified.
+             */
+            std::unique_lock<std::shared_mutex> lockForWrite();
+
             /**
              * @brief Internal load implementation (without lock)
              * @return True if successful
@@ -55,6 +105,78 @@ namespace HMS
              */
             bool saveInternal();
 
+            /**
+             * @brief Persist one inserted/updated patient (without lock)
+             * @return True if successful
+             *
+             * Appends a journal record in journal mode, rewrites the file otherwise.
+             */
+            bool persistUpsert(const Model::Patient &patient);
+
+            /**
+             * @brief Persist one removal (without lock)
+             * @return True if successful
+             */
+            bool persistRemove(const std::string &id);
+
+            /**
+             * @brief Count deferred mutations and schedule a flush (caller holds the lock)
+             * @param changes Number of mutations deferred
+             * @return True if successful
+             *
+             * In GROUP_COMMIT mode waits for the shared write, releasing the lock
+             * meanwhile. In INTERVAL mode flushes at once when maxPendingChanges
+             * is reached.
+             */
+            bool deferWrite(size_t changes);
+
+            /**
+             * @brief Persist deferred mutations (without lock)
+             * @return True if nothing is pending afterwards
+             */
+            bool flushPendingInternal();
+
+            /**
+             * @brief Persist several mutations with one write (without lock)
+             * @param records Journal records describing the mutations
+             * @return True if successful
+             *
+             * Appends all records with one flush in journal mode, rewrites the
+             * file once otherwise.
+             */
+            bool persistRecords(const std::vector<Journal::Record> &records);
+
+            /**
+             * @brief Undo a range operation whose write failed (without lock)
+             * @param oldSize Record count before the batch
+             * @param replaced Slot and previous value of each record the batch replaced, in order
+             * @param recordCount Number of journal records the batch queued
+             */
+            void rollbackRange(size_t oldSize,
+                               const std::vector<std::pair<size_t, Model::Patient>> &replaced,
+                               size_t recordCount);
+
+            /**
+             * @brief Check that a key stays unique once a batch is stored (without lock)
+             * @param patients Batch to add or upsert
+             * @param uniqueKey Key to check
+             * @return True if no two patients would share a non-empty key
+             */
+            bool keepsKeysUnique(const std::vector<Model::Patient> &patients, const UniqueKey &uniqueKey) const;
+
+            /**
+             * @brief Re-index patients from the given slot onwards (without lock)
+             * @param from First slot whose position changed (0 rebuilds the whole index)
+             */
+            void rebuildIndex(size_t from = 0);
+
+            /**
+             * @brief Find a patient by primary key via the index (without lock)
+             * @param id Primary key
+             * @return Iterator into m_patients, or end() if not found
+             */
+            std::vector<Model::Patient>::iterator findById(const std::string &id);
+
         public:
             // ==================== Singleton Access ====================
 
@@ -92,6 +214,18 @@ namespace HMS
              */
             std::vector<Model::Patient> getAll() override;
 
+            /**
+             * @brief Get an immutable point-in-time view of all patients
+             * @return Snapshot sharing the current records (O(1), nothing is copied)
+             */
+            Snapshot<Model::Patient> getSnapshot() const;
+
+            /**
+             * @brief Borrow all records in place under a shared lock
+             * @return View valid until destroyed; do not modify this repository meanwhile
+             */
+            ReadView<Model::Patient> view() const override;
+
             /**
              * @brief Get patient by patient ID
              * @param id Patient ID
@@ -120,6 +254,36 @@ namespace HMS
              */
             bool remove(const std::string &id) override;
 
+            /**
+             * @brief Add several patients with one write
+             * @param patients Patients to add
+             * @return True if all were added; false (nothing added) if any ID exists or repeats
+             */
+            bool addRange(const std::vector<Model::Patient> &patients) override;
+
+            /**
+             * @brief Add new patients and replace existing ones with one write
+             * @param patients Patients to store (a repeated ID keeps the last one)
+             * @return True if successful
+             */
+            bool upsertRange(const std::vector<Model::Patient> &patients) override;
+
+            /**
+             * @brief addRange() that also keeps a key unique, checked under the write lock
+             * @param patients Patients to add
+             * @param uniqueKey Key to keep unique
+             * @return False (nothing added) if any ID or key is taken or repeats
+             */
+            bool addRange(const std::vector<Model::Patient> &patients, const UniqueKey &uniqueKey);
+
+            /**
+             * @brief upsertRange() that also keeps a key unique, checked under the write lock
+             * @param patients Patients to store (a repeated ID keeps the last one)
+             * @param uniqueKey Key to keep unique; a replaced patient no longer holds its old key
+             * @return False (nothing stored) if a key would be held by two patients
+             */
+            bool upsertRange(const std::vector<Model::Patient> &patients, const UniqueKey &uniqueKey);
+
             // ==================== Persistence ====================
 
             /**
@@ -134,6 +298,65 @@ namespace HMS
              */
             bool load() override;
 
+            // ==================== Journal Mode ====================
+
+            /**
+             * @brief Enable or disable append-only journal mode
+             * @param enabled True to log each mutation as one journal record
+             *
+             * In journal mode mutations append a single record instead of rewriting
+             * the data file, and a background snapshot is taken once the compaction
+             * thresholds are reached. save() writes a snapshot and truncates the
+             * journal. Disabling folds the journal into a snapshot.
+             */
+            void setJournalEnabled(bool enabled);
+
+            /**
+             * @brief Check if journal mode is enabled
+             * @return True if mutations are journaled
+             */
+            bool isJournalEnabled() const;
+
+            /**
+             * @brief Number of journal records pending since the last snapshot
+             * @return Record count
+             */
+            size_t getJournalRecordCount() const;
+
+            /**
+             * @brief Set the record-count/size thresholds for background compaction
+             * @param policy New thresholds
+             */
+            void setCompactionPolicy(const Journal::CompactionPolicy &policy);
+
+            // ==================== Durability ====================
+
+            /**
+             * @brief Choose when mutations are persisted
+             * @param policy SYNC (default), GROUP_COMMIT or INTERVAL write-behind
+             *
+             * Changes pending under the old policy are flushed first.
+             */
+            void setDurabilityPolicy(const DurabilityPolicy &policy);
+
+            /**
+             * @brief Get the current durability policy
+             * @return Active policy
+             */
+            DurabilityPolicy getDurabilityPolicy() const;
+
+            /**
+             * @brief Persist deferred mutations now
+             * @return True if nothing is pending afterwards
+             */
+            bool flush();
+
+            /**
+             * @brief Number of mutations not yet persisted
+             * @return Pending change count (always 0 in SYNC mode)
+             */
+            size_t getPendingChangeCount() const;
+
             // ==================== Query Operations ====================
 
             /**
@@ -200,11 +423,22 @@ namespace HMS
             std::vector<Model::Patient> search(const std::string &keyword);
 
             /**
-             * @brief Get the next available patient ID
-             * @return New patient ID string
+             * @brief Get the next available patient ID without reserving it
+             * @return ID the next allocateId() call returns
+             *
+             * O(1): read from the ID sequence instead of scanning the records.
+             * Use allocateId() for an ID that is about to be added.
              */
             std::string getNextId();
 
+            /**
+             * @brief Reserve a new patient ID
+             * @return ID no other caller receives, even concurrently
+             *
+             * IDs are never reused: an ID reserved but not added is skipped.
+             */
+            std::string allocateId();
+
             // ==================== File Path ====================
 
             /**
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <utility>
+
+namespace HMS
+{
+    namespace DAL
+    {
+
+        /**
+         * @class ReadView
+         * @brief Borrowed, read-only span over a repository's records
+         *
+         * Holds the repository's shared lock for as long as it lives, so the
+         * records can be iterated in place without copying them. Other readers
+         * proceed concurrently; writers wait until the view is destroyed.
+         *
+         * Keep views short-lived and never modify the same repository while
+         * holding one: the write would wait on the view's own lock.
+         */
+        template <typename T>
+        class ReadView
+        {
+        public:
+            using value_type = T;
+            using iterator = typename std::span<const T>::iterator;
+
+            // ==================== Constructors ====================
+
+            ReadView(std::shared_lock<std::shared_mutex> lock, std::span<const T> items)
+                : m_lock(std::move(lock)), m_items(items)
+            {
+            }
+
+            ReadView(ReadView &&) noexcept = default;
+            ReadView &operator=(ReadView &&) noexcept = default;
+
+            // ==================== Accessors ====================
+
+            iterator begin() const { return m_items.begin(); }
+            iterator end() const { return m_items.end(); }
+
+            size_t size() const { return m_items.size(); }
+            bool empty() const { return m_items.empty(); }
+
+            const T &operator[](size_t i) const { return m_items[i]; }
+
+            /**
+             * @brief Get the underlying span
+             * @return Span valid for the lifetime of this view
+             */
+            std::span<const T> span() const { return m_items; }
+
+        private:
+            std::shared_lock<std::shared_mutex> m_lock;
+            std::span<const T> m_items;
+        };
+
+    } // namespace DAL
+} // namespace HMS
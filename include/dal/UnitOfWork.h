@@ -0,0 +1,103 @@
+#pragma once
+
+#include "../advance/Medicine.h"
+#include "IdSequence.h"
+
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace HMS
+{
+    namespace DAL
+    {
+
+        /**
+         * @class UnitOfWork
+         * @brief All-or-nothing changes spanning the medicine and prescription repositories
+         *
+         * Changes are staged first and touch nothing. commit() takes the
+         * exclusive locks of the repositories involved in the global lock
+         * order (DataSnapshot::Source: medicines, then prescriptions), so it
+         * must not be called from a repository visitor. It validates every
+         * staged change, applies them and persists each touched repository
+         * with one write.
+         * If validation fails nothing is changed; if a write fails the
+         * in-memory changes are undone and a stock change that already
+         * reached disk is written back.
+         *
+         * Dispensing a prescription with N items therefore costs two writes
+         * instead of N + 1.
+         *
+         * Not thread-safe itself; use one instance per operation.
+         */
+        class UnitOfWork
+        {
+        private:
+            // ==================== Staged Changes ====================
+            std::map<std::string, int, IdLess> m_stockDeltas; // Medicine ID -> summed stock change
+            std::vector<std::string> m_dispensed;     // Prescription IDs to mark dispensed
+
+            // ==================== Commit Result ====================
+            std::vector<std::string> m_failedMedicines;
+            std::vector<std::string> m_failedPrescriptions;
+            std::unordered_map<std::string, Model::Medicine> m_committedMedicines;
+
+        public:
+            // ==================== Staging ====================
+
+            /**
+             * @brief Stage a change to a medicine's stock
+             * @param medicineID Medicine ID
+             * @param delta Units to add (negative to deduct); repeated calls add up
+             */
+            void adjustStock(const std::string &medicineID, int delta);
+
+            /**
+             * @brief Stage marking a prescription as dispensed
+             * @param prescriptionID Prescription ID (must not be dispensed yet)
+             */
+            void markDispensed(const std::string &prescriptionID);
+
+            /**
+             * @brief Check if nothing is staged
+             * @return True if empty
+             */
+            bool isEmpty() const;
+
+            // ==================== Commit ====================
+
+            /**
+             * @brief Validate and apply every staged change atomically
+             * @return True if all changes were applied and persisted
+             *
+             * Fails without changing anything if a medicine is missing or
+             * would go below zero stock, or a prescription is missing or
+             * already dispensed. Staged changes are cleared on success.
+             */
+            bool commit();
+
+            /**
+             * @brief Medicines that failed validation in the last commit
+             * @return Medicine IDs (missing or insufficient stock)
+             */
+            const std::vector<std::string> &getFailedMedicines() const;
+
+            /**
+             * @brief Prescriptions that failed validation in the last commit
+             * @return Prescription IDs (missing or already dispensed)
+             */
+            const std::vector<std::string> &getFailedPrescriptions() const;
+
+            /**
+             * @brief Get a medicine as written by the last successful commit
+             * @param medicineID Medicine ID
+             * @return Committed medicine, or nullopt if it was not part of the commit
+             */
+            std::optional<Model::Medicine> getCommittedMedicine(const std::string &medicineID) const;
+        };
+
+    } // namespace DAL
+} // namespace HMS
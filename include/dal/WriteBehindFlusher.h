@@ -0,0 +1,150 @@
+#pragma once
+
+#include "../common/Constants.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace HMS
+{
+    namespace DAL
+    {
+
+        /**
+         * @struct DurabilityPolicy
+         * @brief When a repository persists its mutations
+         *
+         * SYNC persists every mutation before the call returns. GROUP_COMMIT
+         * also returns only once the mutation is persisted, but concurrent
+         * writers share one write (see GroupCommit). INTERVAL (write-behind)
+         * only marks the repository dirty; the pending changes are written by
+         * the WriteBehindFlusher once `interval` has passed since the first of
+         * them, as soon as `maxPendingChanges` are pending, on save()/flush(),
+         * and at shutdown. Changes made in the last interval before a crash
+         * are lost in INTERVAL mode.
+         */
+        struct DurabilityPolicy
+        {
+            enum class Mode
+            {
+                SYNC,
+                GROUP_COMMIT,
+                INTERVAL
+            };
+
+            Mode mode = Mode::SYNC;
+            std::chrono::milliseconds interval{Constants::WRITE_BEHIND_INTERVAL_MS};
+            size_t maxPendingChanges = Constants::WRITE_BEHIND_MAX_PENDING;
+
+            /**
+             * @brief Persist every mutation immediately (the default)
+             */
+            static DurabilityPolicy sync() { return DurabilityPolicy{}; }
+
+            /**
+             * @brief Persist every mutation, sharing writes among concurrent writers
+             */
+            static DurabilityPolicy groupCommit() { return DurabilityPolicy{Mode::GROUP_COMMIT}; }
+
+            /**
+             * @brief Defer mutations and persist them in batches
+             * @param interval Longest time a change stays unwritten
+             * @param maxPendingChanges Pending changes that trigger an immediate flush
+             */
+            static DurabilityPolicy writeBehind(
+                std::chrono::milliseconds interval = std::chrono::milliseconds(Constants::WRITE_BEHIND_INTERVAL_MS),
+                size_t maxPendingChanges = Constants::WRITE_BEHIND_MAX_PENDING)
+            {
+                return DurabilityPolicy{Mode::INTERVAL, interval, maxPendingChanges};
+            }
+        };
+
+        /**
+         * @class WriteBehindFlusher
+         * @brief Background thread that persists dirty write-behind repositories
+         *
+         * A repository in INTERVAL mode schedules its flush callback when it
+         * becomes dirty; the worker calls it once the delay has passed. A
+         * repository has at most one scheduled flush, and a callback finding
+         * nothing pending does nothing.
+         *
+         * The instance is never destroyed, so repositories can cancel their
+         * flush from their destructors at any time, including at exit.
+         */
+        class WriteBehindFlusher
+        {
+        private:
+            using Clock = std::chrono::steady_clock;
+
+            struct ScheduledFlush
+            {
+                Clock::time_point deadline;
+                std::function<void()> flush;
+            };
+
+            // ==================== Queue ====================
+            std::map<const void *, ScheduledFlush> m_scheduled; // Owner -> pending flush
+            const void *m_running;
+            bool m_flushRequested;
+            mutable std::mutex m_queueMutex;
+            std::condition_variable m_wake;
+            std::condition_variable m_idle;
+            std::thread m_thread;
+
+            // ==================== Private Constructor ====================
+            WriteBehindFlusher();
+
+            // ==================== Private Helpers ====================
+            void run();
+
+        public:
+            // ==================== Singleton Access ====================
+
+            /**
+             * @brief Get the shared instance (starts the thread on first use)
+             * @return Pointer to the instance
+             */
+            static WriteBehindFlusher *getInstance();
+
+            WriteBehindFlusher(const WriteBehindFlusher &) = delete;
+            WriteBehindFlusher &operator=(const WriteBehindFlusher &) = delete;
+
+            // ==================== Scheduling ====================
+
+            /**
+             * @brief Run a flush after a delay
+             * @param owner Repository the flush belongs to
+             * @param delay Time until the flush runs
+             * @param flush Callback persisting the owner's pending changes
+             *
+             * If the owner already has a flush scheduled, the earlier deadline wins.
+             */
+            void schedule(const void *owner, std::chrono::milliseconds delay,
+                          std::function<void()> flush);
+
+            /**
+             * @brief Drop the owner's scheduled flush and wait if it is running
+             * @param owner Repository the flush belongs to
+             *
+             * Must not be called while holding a lock the flush callback takes.
+             */
+            void cancel(const void *owner);
+
+            /**
+             * @brief Run every scheduled flush now and wait until done
+             */
+            void flushAll();
+
+            /**
+             * @brief Number of scheduled or running flushes
+             * @return Flush count
+             */
+            size_t getScheduledCount() const;
+        };
+
+    } // namespace DAL
+} // namespace HMS
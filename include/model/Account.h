@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include "../common/Types.h"
 
 namespace HMS {
@@ -54,13 +55,13 @@ public:
      * @brief Get account username
      * @return Username string
      */
-    std::string getUsername() const;
+    const std::string &getUsername() const;
 
     /**
      * @brief Get password hash
      * @return Password hash string
      */
-    std::string getPasswordHash() const;
+    const std::string &getPasswordHash() const;
 
     /**
      * @brief Get user role
@@ -84,7 +85,7 @@ public:
      * @brief Get account creation date
      * @return Creation date string
      */
-    std::string getCreatedDate() const;
+    const std::string &getCreatedDate() const;
 
     // ==================== Setters ====================
 
@@ -130,7 +131,7 @@ public:
      * @param line Pipe-delimited string from file
      * @return Account object or nullopt if parsing fails
      */
-    static Result<Account> deserialize(const std::string& line);
+    static Result<Account> deserialize(std::string_view line);
 };
 
 } // namespace Model
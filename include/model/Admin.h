@@ -2,6 +2,7 @@
 
 #include "Person.h"
 #include <string>
+#include <string_view>
 
 namespace HMS {
 namespace Model {
@@ -57,19 +58,19 @@ public:
      * @brief Get admin's unique ID
      * @return Admin ID string
      */
-    std::string getID() const override;
+    const std::string &getID() const override;
 
     /**
      * @brief Get admin's unique ID (alias)
      * @return Admin ID string
      */
-    std::string getAdminID() const;
+    const std::string &getAdminID() const;
 
     /**
      * @brief Get admin's account username
      * @return Username string
      */
-    std::string getUsername() const;
+    const std::string &getUsername() const;
 
     // ==================== Override Methods ====================
 
@@ -93,7 +94,7 @@ public:
      * @param line Pipe-delimited string from file
      * @return Admin object or nullopt if parsing fails
      */
-    static Result<Admin> deserialize(const std::string& line);
+    static Result<Admin> deserialize(std::string_view line);
 };
 
 } // namespace Model
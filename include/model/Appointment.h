@@ -1,7 +1,9 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include "../common/Types.h"
+#include "../common/InternTable.h"
 
 namespace HMS {
 namespace Model {
@@ -16,12 +18,14 @@ namespace Model {
 class Appointment {
 private:
     std::string m_appointmentID;
-    std::string m_patientUsername;
-    std::string m_doctorID;
+    InternedString m_patientUsername;
+    InternedString m_doctorID;
     std::string m_appointmentDate;  // YYYY-MM-DD
     std::string m_appointmentTime;  // HH:MM
+    Date m_dateValue;               // Parsed date for range queries (invalid if malformed)
+    TimeOfDay m_timeValue;          // Parsed time for slot queries (invalid if malformed)
     std::string m_disease;
-    double m_price;
+    Money m_price;
     bool m_isPaid;
     AppointmentStatus m_status;
     std::string m_notes;
@@ -76,6 +80,23 @@ public:
                 AppointmentStatus status,
                 const std::string& notes);
 
+    /**
+     * @brief Full parameterized constructor with an exact price
+     * @param price Consultation price (kept as is, no double round trip)
+     *
+     * Other parameters as above.
+     */
+    Appointment(const std::string& appointmentID,
+                const std::string& patientUsername,
+                const std::string& doctorID,
+                const std::string& date,
+                const std::string& time,
+                const std::string& disease,
+                Money price,
+                bool isPaid,
+                AppointmentStatus status,
+                const std::string& notes);
+
     /**
      * @brief Destructor
      */
@@ -87,31 +108,43 @@ public:
      * @brief Get appointment ID
      * @return Appointment ID string
      */
-    std::string getAppointmentID() const;
+    const std::string &getAppointmentID() const;
 
     /**
      * @brief Get patient's username
      * @return Patient username string
      */
-    std::string getPatientUsername() const;
+    const std::string &getPatientUsername() const;
 
     /**
      * @brief Get doctor's ID
      * @return Doctor ID string
      */
-    std::string getDoctorID() const;
+    const std::string &getDoctorID() const;
+
+    /**
+     * @brief Get patient's username as an interned handle
+     * @return Handle that compares by integer identity
+     */
+    const InternedString &getPatientHandle() const;
+
+    /**
+     * @brief Get doctor's ID as an interned handle
+     * @return Handle that compares by integer identity
+     */
+    const InternedString &getDoctorHandle() const;
 
     /**
      * @brief Get appointment date
      * @return Date string (YYYY-MM-DD)
      */
-    std::string getDate() const;
+    const std::string &getDate() const;
 
     /**
      * @brief Get appointment time
      * @return Time string (HH:MM)
      */
-    std::string getTime() const;
+    const std::string &getTime() const;
 
     /**
      * @brief Get datetime combined
@@ -119,11 +152,23 @@ public:
      */
     std::string getDateTime() const;
 
+    /**
+     * @brief Get appointment date in compact form
+     * @return Parsed date (invalid if the stored date is malformed)
+     */
+    Date getDateValue() const;
+
+    /**
+     * @brief Get appointment time in compact form
+     * @return Parsed time (invalid if the stored time is malformed)
+     */
+    TimeOfDay getTimeValue() const;
+
     /**
      * @brief Get disease/symptoms description
      * @return Disease string
      */
-    std::string getDisease() const;
+    const std::string &getDisease() const;
 
     /**
      * @brief Get consultation price
@@ -131,6 +176,12 @@ public:
      */
     double getPrice() const;
 
+    /**
+     * @brief Get consultation price as an exact amount
+     * @return Price amount
+     */
+    Money getPriceValue() const;
+
     /**
      * @brief Check if appointment is paid
      * @return True if paid
@@ -153,7 +204,7 @@ public:
      * @brief Get additional notes
      * @return Notes string
      */
-    std::string getNotes() const;
+    const std::string &getNotes() const;
 
     // ==================== Setters ====================
 
@@ -256,7 +307,7 @@ public:
      * @param line Pipe-delimited string from file
      * @return Appointment object or nullopt if parsing fails
      */
-    static Result<Appointment> deserialize(const std::string& line);
+    static Result<Appointment> deserialize(std::string_view line);
 };
 
 } // namespace Model
@@ -2,6 +2,7 @@
 
 #include "Person.h"
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace HMS {
@@ -20,7 +21,7 @@ private:
     std::string m_doctorID;
     std::string m_username;         // Links to Account
     std::string m_specialization;
-    double m_consultationFee;
+    Money m_consultationFee;
 
 public:
     // ==================== Constructors ====================
@@ -50,6 +51,21 @@ public:
            const std::string& specialization,
            double consultationFee);
 
+    /**
+     * @brief Parameterized constructor with an exact fee
+     * @param consultationFee Fee per consultation (kept as is, no double round trip)
+     *
+     * Other parameters as above.
+     */
+    Doctor(const std::string& doctorID,
+           const std::string& username,
+           const std::string& name,
+           const std::string& phone,
+           Gender gender,
+           const std::string& dateOfBirth,
+           const std::string& specialization,
+           Money consultationFee);
+
     /**
      * @brief Destructor
      */
@@ -61,26 +77,26 @@ public:
      * @brief Get doctor's unique ID
      * @return Doctor ID string
      */
-    std::string getID() const override;
+    const std::string &getID() const override;
 
     /**
      * @brief Get doctor's unique ID (alias)
      * @return Doctor ID string
      */
-    std::string getDoctorID() const;
+    const std::string &getDoctorID() const;
 
     /**
      * @brief Get doctor's account username
      * @return Username string
      */
-    std::string getUsername() const;
+    const std::string &getUsername() const;
 
     /**
      * @brief Get doctor's medical specialization (primary/first or all joined)
      * @return Specialization string
      * @note For backwards compatibility. Returns first specialization or all comma-joined
      */
-    std::string getSpecialization() const;
+    const std::string &getSpecialization() const;
 
     /**
      * @brief Get all doctor's medical specializations
@@ -94,6 +110,12 @@ public:
      */
     double getConsultationFee() const;
 
+    /**
+     * @brief Get doctor's consultation fee as an exact amount
+     * @return Fee amount
+     */
+    Money getConsultationFeeValue() const;
+
     // ==================== Setters ====================
 
     /**
@@ -157,7 +179,7 @@ public:
      * @param line Pipe-delimited string from file
      * @return Doctor object or nullopt if parsing fails
      */
-    static Result<Doctor> deserialize(const std::string& line);
+    static Result<Doctor> deserialize(std::string_view line);
 };
 
 } // namespace Model
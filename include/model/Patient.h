@@ -2,6 +2,7 @@
 
 #include "Person.h"
 #include <string>
+#include <string_view>
 
 namespace HMS {
 namespace Model {
@@ -60,31 +61,31 @@ public:
      * @brief Get patient's unique ID
      * @return Patient ID string
      */
-    std::string getID() const override;
+    const std::string &getID() const override;
 
     /**
      * @brief Get patient's unique ID (alias)
      * @return Patient ID string
      */
-    std::string getPatientID() const;
+    const std::string &getPatientID() const;
 
     /**
      * @brief Get patient's account username
      * @return Username string
      */
-    std::string getUsername() const;
+    const std::string &getUsername() const;
 
     /**
      * @brief Get patient's address
      * @return Address string
      */
-    std::string getAddress() const;
+    const std::string &getAddress() const;
 
     /**
      * @brief Get patient's medical history
      * @return Medical history string
      */
-    std::string getMedicalHistory() const;
+    const std::string &getMedicalHistory() const;
 
     // ==================== Setters ====================
 
@@ -134,7 +135,7 @@ public:
      * @param line Pipe-delimited string from file
      * @return Patient object or nullopt if parsing fails
      */
-    static Result<Patient> deserialize(const std::string& line);
+    static Result<Patient> deserialize(std::string_view line);
 };
 
 } // namespace Model
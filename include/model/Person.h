@@ -51,13 +51,13 @@ public:
      * @brief Get person's name
      * @return Name string
      */
-    std::string getName() const;
+    const std::string &getName() const;
 
     /**
      * @brief Get person's phone number
      * @return Phone string
      */
-    std::string getPhone() const;
+    const std::string &getPhone() const;
 
     /**
      * @brief Get person's gender
@@ -75,7 +75,7 @@ public:
      * @brief Get person's date of birth
      * @return Date string
      */
-    std::string getDateOfBirth() const;
+    const std::string &getDateOfBirth() const;
 
     // ==================== Setters ====================
 
@@ -123,7 +123,7 @@ public:
      * @brief Get the unique identifier (pure virtual)
      * @return ID string
      */
-    virtual std::string getID() const = 0;
+    virtual const std::string &getID() const = 0;
 };
 
 } // namespace Model
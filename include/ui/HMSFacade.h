@@ -22,6 +22,7 @@
 #include <optional>
 #include <mutex>
 #include <memory>
+#include <future>
 
 namespace HMS {
 namespace UI {
@@ -55,10 +56,22 @@ private:
 
     // ==================== State ====================
     bool m_isInitialized;
+    std::vector<std::future<bool>> m_pendingLoads; // Repositories still loading
 
     // ==================== Private Constructor ====================
     HMSFacade();
 
+    // ==================== Private Helpers ====================
+
+    /**
+     * @brief Start loading every repository on its own thread
+     *
+     * All loads except accounts are queued in m_pendingLoads.
+     *
+     * @return Future for the account load, which gates the login prompt
+     */
+    std::future<bool> startDataLoad();
+
 public:
     // ==================== Singleton Access ====================
 
@@ -93,17 +106,27 @@ public:
     /**
      * @brief Initialize the system
      *
-     * Loads all data from files and prepares services.
+     * Loads all data from files and prepares services. The repository
+     * files are independent and are loaded concurrently.
      * Must be called before any other operations.
      *
+     * @param earlyLogin If true, return as soon as accounts are loaded and
+     *                   let the other repositories finish in the background
      * @return True if initialization successful
      */
-    bool initialize();
+    bool initialize(bool earlyLogin = false);
+
+    /**
+     * @brief Wait for repositories still loading in the background
+     * @return True if every background load succeeded
+     */
+    bool waitForDataLoad();
 
     /**
      * @brief Shutdown the system
      *
-     * Saves all data and cleans up resources.
+     * Waits for background loads, flushes write-behind changes, saves all
+     * data and cleans up resources.
      * Should be called before exiting the application.
      */
     void shutdown();
@@ -1,8 +1,10 @@
 #include "bll/AdminService.h"
 #include "common/Utils.h"
 #include "common/Types.h"
+#include "dal/DataSnapshot.h"
 
 #include <algorithm>
+#include <future>
 #include <iomanip>
 #include <sstream>
 #include <unordered_map>
@@ -53,28 +55,36 @@ namespace HMS
             Model::Statistics stats;
             stats.reset();
 
-            auto patients = m_patientService->getAllPatients();
-            auto doctors = m_doctorService->getAllDoctors();
-            auto appointments = m_appointmentService->getAllAppointments();
+            // One consistent view of the three repositories without copying them
+            auto data = DAL::DataSnapshot::capture(DAL::DataSnapshot::PATIENTS |
+                                                   DAL::DataSnapshot::DOCTORS |
+                                                   DAL::DataSnapshot::APPOINTMENTS);
+            const auto &patients = *data.patients;
+            const auto &doctors = *data.doctors;
+            const auto &appointments = *data.appointments;
 
             stats.totalPatients = static_cast<int>(patients.size());
             stats.totalDoctors = static_cast<int>(doctors.size());
             stats.totalAppointments = static_cast<int>(appointments.size());
 
             // Pre-build doctor lookup map to avoid N+1 queries
-            std::unordered_map<std::string, std::string> doctorSpecMap;
+            std::unordered_map<InternedString, std::string> doctorSpecMap;
             for (const auto &doc : doctors)
             {
-                doctorSpecMap[doc.getID()] = doc.getSpecialization();
+                doctorSpecMap[InternedString(doc.getID())] = doc.getSpecialization();
                 stats.doctorsBySpecialization[doc.getSpecialization()]++;
             }
 
-            const std::string today = Utils::getCurrentDate();
-            const std::string currentMonth = today.substr(0, 7);
+            const Date today = Date::parse(Utils::getCurrentDate()).value_or(Date{});
+
+            // Week range (Monday to Sunday) for appointmentsThisWeek calculation
+            const Date weekStart = today.addDays(-today.weekday());
+            const Date weekEnd = weekStart.addDays(6);
+            const Date monthStart = today.addDays(1 - today.day());
+            const Date monthEnd = monthStart.addDays(Date::daysInMonth(today.month(), today.year()) - 1);
 
-            // Get week range for appointmentsThisWeek calculation
-            std::string weekStart, weekEnd;
-            Utils::getWeekRange(today, weekStart, weekEnd);
+            // Revenue is summed exactly, then converted once
+            Money totalRevenue, paidRevenue, unpaidRevenue;
 
             for (const auto &appt : appointments)
             {
@@ -87,12 +97,12 @@ namespace HMS
 
                 case AppointmentStatus::COMPLETED:
                     stats.completedAppointments++;
-                    stats.totalRevenue += appt.getPrice();
+                    totalRevenue += appt.getPriceValue();
 
                     if (appt.isPaid())
-                        stats.paidRevenue += appt.getPrice();
+                        paidRevenue += appt.getPriceValue();
                     else
-                        stats.unpaidRevenue += appt.getPrice();
+                        unpaidRevenue += appt.getPriceValue();
                     break;
 
                 case AppointmentStatus::CANCELLED:
@@ -108,28 +118,32 @@ namespace HMS
                 }
 
                 // ===== Time-based =====
-                const std::string &apptDate = appt.getDate();
-                if (apptDate == today)
-                    stats.appointmentsToday++;
+                const Date apptDate = appt.getDateValue();
+                if (apptDate.isValid())
+                {
+                    if (apptDate == today)
+                        stats.appointmentsToday++;
 
-                if (apptDate.length() >= 7 && apptDate.substr(0, 7) == currentMonth)
-                    stats.appointmentsThisMonth++;
+                    if (apptDate >= monthStart && apptDate <= monthEnd)
+                        stats.appointmentsThisMonth++;
 
-                // Check if appointment is within this week
-                if (Utils::compareDates(apptDate, weekStart) >= 0 &&
-                    Utils::compareDates(apptDate, weekEnd) <= 0)
-                {
-                    stats.appointmentsThisWeek++;
+                    // Check if appointment is within this week
+                    if (apptDate >= weekStart && apptDate <= weekEnd)
+                        stats.appointmentsThisWeek++;
                 }
 
                 // ===== Specialization (using pre-built map) =====
-                auto it = doctorSpecMap.find(appt.getDoctorID());
+                auto it = doctorSpecMap.find(appt.getDoctorHandle());
                 if (it != doctorSpecMap.end())
                 {
                     stats.appointmentsBySpecialization[it->second]++;
                 }
             }
 
+            stats.totalRevenue = totalRevenue.toDouble();
+            stats.paidRevenue = paidRevenue.toDouble();
+            stats.unpaidRevenue = unpaidRevenue.toDouble();
+
             stats.calculate();
             return stats;
         }
@@ -138,17 +152,17 @@ namespace HMS
 
         int AdminService::getTotalPatients()
         {
-            return static_cast<int>(m_patientService->getAllPatients().size());
+            return static_cast<int>(m_patientService->getPatientCount());
         }
 
         int AdminService::getTotalDoctors()
         {
-            return static_cast<int>(m_doctorService->getAllDoctors().size());
+            return static_cast<int>(m_doctorService->getDoctorCount());
         }
 
         int AdminService::getTotalAppointments()
         {
-            return static_cast<int>(m_appointmentService->getAllAppointments().size());
+            return static_cast<int>(m_appointmentService->getAppointmentCount());
         }
 
         double AdminService::getTotalRevenue()
@@ -207,17 +221,18 @@ namespace HMS
 
         List<Model::Appointment> AdminService::getAppointmentsThisMonth()
         {
-            const std::string today = Utils::getCurrentDate();
-            const std::string startDate = today.substr(0, 7) + "-01";
-
-            int year = std::stoi(today.substr(0, 4));
-            int month = std::stoi(today.substr(5, 2));
-            int daysInMonth = Utils::getDaysInMonth(month, year);
+            auto today = Date::parse(Utils::getCurrentDate());
+            if (!today)
+            {
+                return {};
+            }
 
-            std::ostringstream endOss;
-            endOss << today.substr(0, 7) << "-" << std::setfill('0') << std::setw(2) << daysInMonth;
+            int year = today->year();
+            int month = today->month();
+            Date first = Date::fromCivil(year, month, 1);
+            Date last = Date::fromCivil(year, month, Date::daysInMonth(month, year));
 
-            return m_appointmentService->getAppointmentsInRange(startDate, endOss.str());
+            return m_appointmentService->getAppointmentsInRange(first.toString(), last.toString());
         }
 
         List<Model::Appointment> AdminService::getAppointmentsByDateRange(
@@ -274,12 +289,12 @@ namespace HMS
         std::map<std::string, int> AdminService::getDoctorCountBySpecialization()
         {
             std::map<std::string, int> result;
-            auto doctors = m_doctorService->getAllDoctors();
 
-            for (const auto &doc : doctors)
-            {
-                result[doc.getSpecialization()]++;
-            }
+            DAL::DoctorRepository::getInstance()->forEach(
+                [&result](const Model::Doctor &doc)
+                {
+                    result[doc.getSpecialization()]++;
+                });
 
             return result;
         }
@@ -287,25 +302,25 @@ namespace HMS
         std::map<std::string, int> AdminService::getAppointmentCountBySpecialization()
         {
             std::map<std::string, int> result;
-            auto doctors = m_doctorService->getAllDoctors();
-            auto appointments = m_appointmentService->getAllAppointments();
 
             // Build doctor ID -> specialization map
-            std::unordered_map<std::string, std::string> doctorSpecMap;
-            for (const auto &doc : doctors)
-            {
-                doctorSpecMap[doc.getID()] = doc.getSpecialization();
-            }
+            std::unordered_map<InternedString, std::string> doctorSpecMap;
+            DAL::DoctorRepository::getInstance()->forEach(
+                [&doctorSpecMap](const Model::Doctor &doc)
+                {
+                    doctorSpecMap[InternedString(doc.getID())] = doc.getSpecialization();
+                });
 
             // Count appointments by specialization
-            for (const auto &appt : appointments)
-            {
-                auto it = doctorSpecMap.find(appt.getDoctorID());
-                if (it != doctorSpecMap.end())
+            DAL::AppointmentRepository::getInstance()->forEach(
+                [&doctorSpecMap, &result](const Model::Appointment &appt)
                 {
-                    result[it->second]++;
-                }
-            }
+                    auto it = doctorSpecMap.find(appt.getDoctorHandle());
+                    if (it != doctorSpecMap.end())
+                    {
+                        result[it->second]++;
+                    }
+                });
 
             return result;
         }
@@ -328,7 +343,7 @@ namespace HMS
             oss << std::string(50, '=') << "\n\n";
 
             int scheduled = 0, completed = 0, cancelled = 0, noShow = 0;
-            double revenue = 0.0;
+            Money revenue;
 
             for (const auto &appt : appointments)
             {
@@ -339,7 +354,7 @@ namespace HMS
                     break;
                 case AppointmentStatus::COMPLETED:
                     completed++;
-                    revenue += appt.getPrice();
+                    revenue += appt.getPriceValue();
                     break;
                 case AppointmentStatus::CANCELLED:
                     cancelled++;
@@ -372,19 +387,7 @@ namespace HMS
             }
 
             // Calculate end date (6 days after start)
-            int year = std::stoi(startDate.substr(0, 4));
-            int month = std::stoi(startDate.substr(5, 2));
-            int day = std::stoi(startDate.substr(8, 2));
-
-            std::tm tm = {};
-            tm.tm_year = year - 1900;
-            tm.tm_mon = month - 1;
-            tm.tm_mday = day + 6;
-            std::mktime(&tm);
-
-            char endBuffer[11];
-            std::strftime(endBuffer, sizeof(endBuffer), "%Y-%m-%d", &tm);
-            std::string endDate(endBuffer);
+            std::string endDate = Date::parse(startDate)->addDays(6).toString();
 
             auto appointments = m_appointmentService->getAppointmentsInRange(startDate, endDate);
 
@@ -395,7 +398,7 @@ namespace HMS
             oss << std::string(50, '=') << "\n\n";
 
             int scheduled = 0, completed = 0, cancelled = 0, noShow = 0;
-            double revenue = 0.0, paidRevenue = 0.0;
+            Money revenue, paidRevenue;
 
             for (const auto &appt : appointments)
             {
@@ -406,9 +409,9 @@ namespace HMS
                     break;
                 case AppointmentStatus::COMPLETED:
                     completed++;
-                    revenue += appt.getPrice();
+                    revenue += appt.getPriceValue();
                     if (appt.isPaid())
-                        paidRevenue += appt.getPrice();
+                        paidRevenue += appt.getPriceValue();
                     break;
                 case AppointmentStatus::CANCELLED:
                     cancelled++;
@@ -473,7 +476,7 @@ namespace HMS
             oss << std::string(50, '=') << "\n\n";
 
             int scheduled = 0, completed = 0, cancelled = 0, noShow = 0;
-            double revenue = 0.0, paidRevenue = 0.0;
+            Money revenue, paidRevenue;
 
             for (const auto &appt : appointments)
             {
@@ -484,9 +487,9 @@ namespace HMS
                     break;
                 case AppointmentStatus::COMPLETED:
                     completed++;
-                    revenue += appt.getPrice();
+                    revenue += appt.getPriceValue();
                     if (appt.isPaid())
-                        paidRevenue += appt.getPrice();
+                        paidRevenue += appt.getPriceValue();
                     break;
                 case AppointmentStatus::CANCELLED:
                     cancelled++;
@@ -500,7 +503,7 @@ namespace HMS
             }
 
             double completionRate = appointments.empty() ? 0.0 : (static_cast<double>(completed) / appointments.size()) * 100.0;
-            double paymentRate = revenue > 0.0 ? (paidRevenue / revenue) * 100.0 : 0.0;
+            double paymentRate = revenue > Money() ? (paidRevenue.toDouble() / revenue.toDouble()) * 100.0 : 0.0;
 
             oss << "TONG QUAN\n";
             oss << "   - Tong lich hen:   " << appointments.size() << "\n";
@@ -535,10 +538,16 @@ namespace HMS
 
         bool AdminService::loadAllData()
         {
-            bool patientLoaded = m_patientService->loadData();
-            bool doctorLoaded = m_doctorService->loadData();
+            // The repositories are independent, so their files load side by side
+            auto patientLoad = std::async(std::launch::async, [this]
+                                          { return m_patientService->loadData(); });
+            auto doctorLoad = std::async(std::launch::async, [this]
+                                         { return m_doctorService->loadData(); });
             bool appointmentLoaded = m_appointmentService->loadData();
 
+            bool patientLoaded = patientLoad.get();
+            bool doctorLoaded = doctorLoad.get();
+
             return patientLoaded && doctorLoaded && appointmentLoaded;
         }
 
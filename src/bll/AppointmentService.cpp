@@ -18,15 +18,9 @@ namespace HMS
             static const std::vector<std::string> slots = []()
             {
                 std::vector<std::string> result;
-                for (int h = Constants::WORK_START_HOUR; h < Constants::WORK_END_HOUR; ++h)
+                for (int i = 0; i < Constants::SLOTS_PER_DAY; ++i)
                 {
-                    std::stringstream ss1;
-                    ss1 << std::setfill('0') << std::setw(2) << h << ":00";
-                    result.push_back(ss1.str());
-
-                    std::stringstream ss2;
-                    ss2 << std::setfill('0') << std::setw(2) << h << ":30";
-                    result.push_back(ss2.str());
+                    result.push_back(Utils::getSlotTime(i));
                 }
                 return result;
             }();
@@ -273,18 +267,18 @@ namespace HMS
         {
             const std::vector<std::string> &allSlots = getCachedStandardTimeSlots();
 
-            // Get booked slots from Repo
-            std::vector<std::string> bookedSlots = m_appointmentRepo->getBookedSlots(doctorID, date);
-
-            // Note: set_difference requires sorted ranges.
-            // Standard slots are generated in order.
-            // Booked slots returned from Repo might not be sorted. Let's sort them to be safe.
-            std::sort(bookedSlots.begin(), bookedSlots.end());
+            // Bit i of the mask is set when allSlots[i] is booked
+            SlotMask booked = m_appointmentRepo->getBookedSlotMask(doctorID, date);
 
             std::vector<std::string> availableSlots;
-            std::set_difference(allSlots.begin(), allSlots.end(),
-                                bookedSlots.begin(), bookedSlots.end(),
-                                std::back_inserter(availableSlots));
+            availableSlots.reserve(allSlots.size());
+            for (size_t i = 0; i < allSlots.size(); ++i)
+            {
+                if ((booked & (SlotMask{1} << i)) == 0)
+                {
+                    availableSlots.push_back(allSlots[i]);
+                }
+            }
 
             // If query is for today, remove past times
             std::string today = Utils::getCurrentDate();
@@ -480,40 +474,34 @@ namespace HMS
 
         double AppointmentService::getTotalRevenue()
         {
-            double totalRevenue = 0.0;
-            double paidRevenue = 0.0;
-            double unpaidRevenue = 0.0;
-
+            Money totalRevenue, paidRevenue, unpaidRevenue;
             calculateRevenueStatistics(totalRevenue, paidRevenue, unpaidRevenue);
 
-            return totalRevenue;
+            return totalRevenue.toDouble();
         }
 
         double AppointmentService::getPaidRevenue()
         {
-            double totalRevenue = 0.0;
-            double paidRevenue = 0.0;
-            double unpaidRevenue = 0.0;
-
+            Money totalRevenue, paidRevenue, unpaidRevenue;
             calculateRevenueStatistics(totalRevenue, paidRevenue, unpaidRevenue);
 
-            return paidRevenue;
+            return paidRevenue.toDouble();
         }
 
         double AppointmentService::getUnpaidRevenue()
         {
-            double totalRevenue = 0.0;
-            double paidRevenue = 0.0;
-            double unpaidRevenue = 0.0;
-
+            Money totalRevenue, paidRevenue, unpaidRevenue;
             calculateRevenueStatistics(totalRevenue, paidRevenue, unpaidRevenue);
 
-            return unpaidRevenue;
+            return unpaidRevenue.toDouble();
         }
 
         size_t AppointmentService::getCountByStatus(AppointmentStatus status)
         {
-            return m_appointmentRepo->getByStatus(status).size();
+            return m_appointmentRepo->scan(
+                [status](const Model::Appointment &appt)
+                { return appt.getStatus() == status; },
+                [](const Model::Appointment &) {});
         }
 
         // ==================== Data Persistence ====================
@@ -532,7 +520,7 @@ namespace HMS
 
         std::string AppointmentService::generateAppointmentID()
         {
-            return m_appointmentRepo->getNextId();
+            return m_appointmentRepo->allocateId();
         }
 
         double AppointmentService::getDoctorFee(const std::string &doctorID)
@@ -555,36 +543,32 @@ namespace HMS
             return m_doctorRepo->exists(doctorID);
         }
 
-        void AppointmentService::calculateRevenueStatistics(double &totalRevenue,
-                                                            double &paidRevenue,
-                                                            double &unpaidRevenue)
+        void AppointmentService::calculateRevenueStatistics(Money &totalRevenue,
+                                                            Money &paidRevenue,
+                                                            Money &unpaidRevenue)
         {
-            totalRevenue = 0.0;
-            paidRevenue = 0.0;
-            unpaidRevenue = 0.0;
+            totalRevenue = Money();
+            paidRevenue = Money();
+            unpaidRevenue = Money();
 
-            auto allAppts = m_appointmentRepo->getAll();
-
-            for (const auto &appt : allAppts)
-            {
-                // Skip cancelled appointments
-                if (appt.getStatus() == AppointmentStatus::CANCELLED)
+            // Skip cancelled appointments
+            m_appointmentRepo->scan(
+                [](const Model::Appointment &appt)
+                { return appt.getStatus() != AppointmentStatus::CANCELLED; },
+                [&](const Model::Appointment &appt)
                 {
-                    continue;
-                }
-
-                double price = appt.getPrice();
-                totalRevenue += price;
+                    Money price = appt.getPriceValue();
+                    totalRevenue += price;
 
-                if (appt.isPaid())
-                {
-                    paidRevenue += price;
-                }
-                else
-                {
-                    unpaidRevenue += price;
-                }
-            }
+                    if (appt.isPaid())
+                    {
+                        paidRevenue += price;
+                    }
+                    else
+                    {
+                        unpaidRevenue += price;
+                    }
+                });
         }
 
     } // namespace BLL
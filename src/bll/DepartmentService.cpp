@@ -3,6 +3,7 @@
 #include "common/Utils.h"
 
 #include <algorithm>
+#include <unordered_set>
 
 namespace HMS
 {
@@ -86,7 +87,7 @@ namespace HMS
             }
 
             // Generate new ID through repository
-            std::string id = m_departmentRepo->getNextId();
+            std::string id = m_departmentRepo->allocateId();
 
             // Create department with constructor
             Model::Department dep(id, name, description, "");
@@ -380,14 +381,25 @@ namespace HMS
 
         List<Model::Doctor> DepartmentService::getUnassignedDoctors()
         {
-            auto allDoctors = m_doctorRepo->getAll();
             List<Model::Doctor> unassigned;
 
-            std::ranges::copy_if(allDoctors, std::back_inserter(unassigned),
-                                 [this](const auto &doc)
-                                 {
-                                     return !m_departmentRepo->getDepartmentByDoctor(doc.getID()).has_value();
-                                 });
+            // Collected first: the scan below must not call into the department repository
+            std::unordered_set<std::string> assignedIDs;
+            m_departmentRepo->forEach(
+                [&assignedIDs](const Model::Department &dep)
+                {
+                    assignedIDs.insert(dep.getDoctorIDs().begin(), dep.getDoctorIDs().end());
+                });
+
+            m_doctorRepo->scan(
+                [&assignedIDs](const Model::Doctor &doc)
+                {
+                    return !assignedIDs.contains(doc.getID());
+                },
+                [&unassigned](const Model::Doctor &doc)
+                {
+                    unassigned.push_back(doc);
+                });
 
             return unassigned;
         }
@@ -424,45 +436,49 @@ namespace HMS
 
             // Calculate appointment count and revenue from completed AND paid appointments
             auto appRepo = DAL::AppointmentRepository::getInstance();
-            auto allApps = appRepo->getAll();
-
-            for (const auto &app : allApps)
-            {
-                if (dep.hasDoctor(app.getDoctorID()))
+            Money revenue;
+            appRepo->scan(
+                [&dep](const Model::Appointment &app)
                 {
-                    if (app.getStatus() == AppointmentStatus::COMPLETED && app.isPaid())
-                    {
-                        stats.appointmentCount++;
-                        stats.totalRevenue += app.getPrice();
-                    }
-                }
-            }
+                    return dep.hasDoctor(app.getDoctorID()) &&
+                           app.getStatus() == AppointmentStatus::COMPLETED && app.isPaid();
+                },
+                [&stats, &revenue](const Model::Appointment &app)
+                {
+                    stats.appointmentCount++;
+                    revenue += app.getPriceValue();
+                });
+            stats.totalRevenue = revenue.toDouble();
 
             return stats;
         }
 
-        std::map<std::string, DepartmentStats> DepartmentService::getAllDepartmentStats()
+        std::map<std::string, DepartmentStats, DAL::IdLess> DepartmentService::getAllDepartmentStats()
         {
-            std::map<std::string, DepartmentStats> statsMap;
-            auto deps = m_departmentRepo->getAll();
+            std::map<std::string, DepartmentStats, DAL::IdLess> statsMap;
+
+            // getDepartmentStats() reads the repository again, so only collect IDs under the lock
+            std::vector<std::string> departmentIDs;
+            m_departmentRepo->forEach([&departmentIDs](const Model::Department &dep)
+                                      { departmentIDs.push_back(dep.getDepartmentID()); });
 
-            for (const auto &dep : deps)
+            for (const auto &departmentID : departmentIDs)
             {
-                statsMap[dep.getDepartmentID()] = getDepartmentStats(dep.getDepartmentID());
+                statsMap[departmentID] = getDepartmentStats(departmentID);
             }
 
             return statsMap;
         }
 
-        std::map<std::string, int> DepartmentService::getDoctorCountByDepartment()
+        std::map<std::string, int, DAL::IdLess> DepartmentService::getDoctorCountByDepartment()
         {
-            std::map<std::string, int> counts;
-            auto deps = m_departmentRepo->getAll();
+            std::map<std::string, int, DAL::IdLess> counts;
 
-            for (const auto &dep : deps)
-            {
-                counts[dep.getDepartmentID()] = static_cast<int>(dep.getDoctorCount());
-            }
+            m_departmentRepo->forEach(
+                [&counts](const Model::Department &dep)
+                {
+                    counts[dep.getDepartmentID()] = static_cast<int>(dep.getDoctorCount());
+                });
 
             return counts;
         }
@@ -500,7 +516,7 @@ namespace HMS
 
         bool DepartmentService::departmentNameExists(const std::string &name, const std::string &excludeID)
         {
-            auto allDepartments = m_departmentRepo->getAll();
+            auto allDepartments = m_departmentRepo->view();
             std::string normalizedName = Utils::trim(Utils::toLower(name));
 
             return std::ranges::any_of(allDepartments,
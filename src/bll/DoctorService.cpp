@@ -21,16 +21,9 @@ namespace HMS
             static const List<std::string> slots = []()
             {
                 List<std::string> result;
-                for (int h = Constants::WORK_START_HOUR; h < Constants::WORK_END_HOUR;
-                     ++h)
+                for (int i = 0; i < Constants::SLOTS_PER_DAY; ++i)
                 {
-                    std::stringstream ss1;
-                    ss1 << std::setfill('0') << std::setw(2) << h << ":00";
-                    result.push_back(ss1.str());
-
-                    std::stringstream ss2;
-                    ss2 << std::setfill('0') << std::setw(2) << h << ":30";
-                    result.push_back(ss2.str());
+                    result.push_back(Utils::getSlotTime(i));
                 }
                 return result;
             }();
@@ -99,7 +92,7 @@ namespace HMS
             const std::string &specialization,
             double consultationFee)
         {
-            std::string id = m_doctorRepo->getNextId();
+            std::string id = m_doctorRepo->allocateId();
             Model::Doctor newDoc(id,
                                  username,
                                  name,
@@ -291,21 +284,20 @@ namespace HMS
             // Use cached standard time slots (consistent with AppointmentService)
             const List<std::string> &allSlots = getCachedStandardTimeSlots();
 
-            // Get booked slots from repository
-            auto bookedSlots = m_appointmentRepo->getBookedSlots(doctorID, date);
-            std::set<std::string> occupiedTime(bookedSlots.begin(), bookedSlots.end());
+            // Bit i of the mask is set when allSlots[i] is booked
+            SlotMask booked = m_appointmentRepo->getBookedSlotMask(doctorID, date);
 
             List<std::string> availableSlots;
             bool isToday = (date == Utils::getCurrentDate());
             std::string currentTime = isToday ? Utils::getCurrentTime() : "";
 
-            for (const auto &slot : allSlots)
+            for (size_t i = 0; i < allSlots.size(); ++i)
             {
-                if (occupiedTime.find(slot) == occupiedTime.end())
+                if ((booked & (SlotMask{1} << i)) == 0)
                 {
-                    if (!isToday || slot > currentTime)
+                    if (!isToday || allSlots[i] > currentTime)
                     {
-                        availableSlots.push_back(slot);
+                        availableSlots.push_back(allSlots[i]);
                     }
                 }
             }
@@ -331,34 +323,40 @@ namespace HMS
         List<Model::Appointment>
         DoctorService::getDoctorActivity(const std::string &doctorID)
         {
-            auto allAppointments = m_appointmentRepo->getAll();
             List<Model::Appointment> result;
-
-            for (const auto &app : allAppointments)
+            auto doctor = InternedString::lookup(doctorID);
+            if (!doctor)
             {
-                if (app.getDoctorID() == doctorID)
-                {
-                    result.push_back(app);
-                }
+                return result;
             }
 
+            m_appointmentRepo->scan(
+                [&doctor](const Model::Appointment &app)
+                { return app.getDoctorHandle() == *doctor; },
+                [&result](const Model::Appointment &app)
+                { result.push_back(app); });
+
             return result;
         }
 
         List<Model::Appointment>
         DoctorService::getCompletedAppointments(const std::string &doctorID)
         {
-            auto allAppointments = m_appointmentRepo->getAll();
             List<Model::Appointment> result;
-
-            for (const auto &app : allAppointments)
+            auto doctor = InternedString::lookup(doctorID);
+            if (!doctor)
             {
-                if (app.getDoctorID() == doctorID &&
-                    app.getStatus() == AppointmentStatus::COMPLETED)
-                {
-                    result.push_back(app);
-                }
+                return result;
             }
+
+            m_appointmentRepo->scan(
+                [&doctor](const Model::Appointment &app)
+                {
+                    return app.getDoctorHandle() == *doctor &&
+                           app.getStatus() == AppointmentStatus::COMPLETED;
+                },
+                [&result](const Model::Appointment &app)
+                { result.push_back(app); });
             return result;
         }
 
@@ -398,12 +396,12 @@ namespace HMS
         double DoctorService::getDoctorRevenue(const std::string &doctorID)
         {
             auto completed = getCompletedAppointments(doctorID);
-            double total = 0.0;
+            Money total;
             for (const auto &app : completed)
             {
-                total += app.getPrice();
+                total += app.getPriceValue();
             }
-            return total;
+            return total.toDouble();
         }
 
         size_t DoctorService::getDoctorAppointmentCount(const std::string &doctorID)
@@ -69,7 +69,7 @@ namespace HMS
             }
 
             Model::Medicine medicine(
-                m_medicineRepo->getNextId(),
+                m_medicineRepo->allocateId(),
                 name,
                 category,
                 unitPrice,
@@ -109,6 +109,30 @@ namespace HMS
             return m_medicineRepo->remove(medicineID);
         }
 
+        bool MedicineService::createMedicines(const std::vector<Model::Medicine> &medicines)
+        {
+            // Validate the whole batch before anything is stored
+            if (!std::ranges::all_of(medicines, [this](const auto &medicine)
+                                     { return validateMedicine(medicine); }))
+            {
+                return false;
+            }
+
+            // The repository rejects taken or repeated IDs
+            return m_medicineRepo->addRange(medicines);
+        }
+
+        bool MedicineService::upsertMedicines(const std::vector<Model::Medicine> &medicines)
+        {
+            if (!std::ranges::all_of(medicines, [this](const auto &medicine)
+                                     { return validateMedicine(medicine); }))
+            {
+                return false;
+            }
+
+            return m_medicineRepo->upsertRange(medicines);
+        }
+
         // ==================== Query Operations ====================
         Result<Model::Medicine> MedicineService::getMedicineByID(const std::string &medicineID)
         {
@@ -257,14 +281,13 @@ namespace HMS
 
         List<Model::Medicine> MedicineService::getOutOfStock()
         {
-            auto allMedicines = m_medicineRepo->getAll();
             List<Model::Medicine> outOfStock;
 
-            std::ranges::copy_if(allMedicines, std::back_inserter(outOfStock),
-                                 [](const auto &med)
-                                 {
-                                     return med.getQuantityInStock() == 0;
-                                 });
+            m_medicineRepo->scan(
+                [](const Model::Medicine &med)
+                { return med.getQuantityInStock() == 0; },
+                [&outOfStock](const Model::Medicine &med)
+                { outOfStock.push_back(med); });
 
             return outOfStock;
         }
@@ -322,40 +345,45 @@ namespace HMS
         // ==================== Inventory Statistics ====================
         double MedicineService::getTotalInventoryValue() const
         {
-            auto allMedicines = m_medicineRepo->getAll();
-            double total = 0.0;
+            Money total;
 
-            for (const auto &med : allMedicines)
-            {
-                total += med.getUnitPrice() * med.getQuantityInStock();
-            }
+            m_medicineRepo->forEach(
+                [&total](const Model::Medicine &med)
+                {
+                    total += med.getUnitPriceValue() * med.getQuantityInStock();
+                });
 
-            return total;
+            return total.toDouble();
         }
 
         std::map<std::string, double> MedicineService::getInventoryValueByCategory() const
         {
-            std::map<std::string, double> categoryValues;
-            auto allMedicines = m_medicineRepo->getAll();
+            std::map<std::string, Money> categoryTotals;
+
+            m_medicineRepo->forEach(
+                [&categoryTotals](const Model::Medicine &med)
+                {
+                    categoryTotals[med.getCategory()] +=
+                        med.getUnitPriceValue() * med.getQuantityInStock();
+                });
 
-            for (const auto &med : allMedicines)
+            std::map<std::string, double> categoryValues;
+            for (const auto &[category, total] : categoryTotals)
             {
-                categoryValues[med.getCategory()] +=
-                    med.getUnitPrice() * med.getQuantityInStock();
+                categoryValues.emplace(category, total.toDouble());
             }
-
             return categoryValues;
         }
 
         std::map<std::string, int> MedicineService::getStockCountByCategory() const
         {
             std::map<std::string, int> categoryStocks;
-            auto allMedicines = m_medicineRepo->getAll();
 
-            for (const auto &med : allMedicines)
-            {
-                categoryStocks[med.getCategory()] += med.getQuantityInStock();
-            }
+            m_medicineRepo->forEach(
+                [&categoryStocks](const Model::Medicine &med)
+                {
+                    categoryStocks[med.getCategory()] += med.getQuantityInStock();
+                });
 
             return categoryStocks;
         }
@@ -404,7 +432,7 @@ namespace HMS
 
         bool MedicineService::medicineNameExists(const std::string &name, const std::string &excludeID) const
         {
-            auto allMedicines = m_medicineRepo->getAll();
+            auto allMedicines = m_medicineRepo->view();
             std::string normalizedName = Utils::trim(Utils::toLower(name));
 
             return std::ranges::any_of(allMedicines,
@@ -78,7 +78,7 @@ namespace HMS
         {
 
             // Generate unique patient ID
-            std::string patientID = m_patientRepo->getNextId();
+            std::string patientID = m_patientRepo->allocateId();
 
             // Create patient object
             Model::Patient patient(patientID, username, name, phone, gender,
@@ -150,6 +150,32 @@ namespace HMS
             return true;
         }
 
+        bool PatientService::createPatients(const std::vector<Model::Patient> &patients)
+        {
+            // Validate the whole batch before anything is stored
+            if (!std::ranges::all_of(patients, [this](const auto &patient)
+                                     { return validatePatient(patient); }))
+            {
+                return false;
+            }
+
+            // The repository rejects taken or repeated IDs and usernames under
+            // its write lock, so concurrent batches cannot both claim one
+            return m_patientRepo->addRange(patients, &Model::Patient::getUsername);
+        }
+
+        bool PatientService::upsertPatients(const std::vector<Model::Patient> &patients)
+        {
+            if (!std::ranges::all_of(patients, [this](const auto &patient)
+                                     { return validatePatient(patient); }))
+            {
+                return false;
+            }
+
+            // Renamed patients free their old username for the rest of the batch
+            return m_patientRepo->upsertRange(patients, &Model::Patient::getUsername);
+        }
+
         // ==================== Query Operations ====================
         Result<Model::Patient> PatientService::getPatientByID(const std::string &patientID)
         {
@@ -203,31 +229,31 @@ namespace HMS
         double PatientService::calculateTotalBill(const std::string &username)
         {
             auto unpaidAppointments = getUnpaidAppointments(username);
-            double total = 0.0;
+            Money total;
 
             for (const auto &apt : unpaidAppointments)
             {
-                total += apt.getPrice();
+                total += apt.getPriceValue();
             }
 
-            return total;
+            return total.toDouble();
         }
 
         double PatientService::calculateTotalPaid(const std::string &username)
         {
             auto allAppointments = m_appointmentRepo->getByPatient(username);
-            double total = 0.0;
+            Money total;
 
             for (const auto &apt : allAppointments)
             {
                 // Only count paid appointments
                 if (apt.isPaid())
                 {
-                    total += apt.getPrice();
+                    total += apt.getPriceValue();
                 }
             }
 
-            return total;
+            return total.toDouble();
         }
 
         List<Model::Appointment> PatientService::getUnpaidAppointments(const std::string &username)
@@ -324,7 +350,7 @@ namespace HMS
             }
 
             // Validate name
-            std::string name = patient.getName();
+            const std::string &name = patient.getName();
             if (name.empty() || name.length() < 2)
             {
                 return false;
@@ -337,7 +363,7 @@ namespace HMS
             }
 
             // Validate date of birth
-            std::string dob = patient.getDateOfBirth();
+            const std::string &dob = patient.getDateOfBirth();
             if (!Utils::isValidDateInternal(dob))
             {
                 return false;
@@ -1,10 +1,13 @@
 #include "bll/PrescriptionService.h"
 #include "common/Constants.h"
 #include "common/Utils.h"
+#include "dal/IdSequence.h"
+#include "dal/UnitOfWork.h"
 
 #include <algorithm>
 #include <iomanip>
 #include <sstream>
+#include <unordered_map>
 
 namespace HMS
 {
@@ -48,7 +51,7 @@ namespace HMS
 
     std::string PrescriptionService::generateNextID()
     {
-      return m_prescriptionRepo->getNextId();
+      return m_prescriptionRepo->allocateId();
     }
 
     bool PrescriptionService::createPrescription(
@@ -93,7 +96,7 @@ namespace HMS
       }
 
       // Generate new ID
-      std::string newID = m_prescriptionRepo->getNextId();
+      std::string newID = m_prescriptionRepo->allocateId();
       std::string currentDate = Utils::getCurrentDate();
 
       // Create prescription with appointment details
@@ -317,9 +320,14 @@ namespace HMS
     List<PrescriptionSummary> PrescriptionService::getPrescriptionSummaries()
     {
       List<PrescriptionSummary> summaries;
-      auto prescriptions = m_prescriptionRepo->getAll();
 
-      for (const auto &presc : prescriptions)
+      // Pre-load medicine prices: the visitor below runs under the prescription
+      // lock and must not call into the medicine repository
+      std::unordered_map<InternedString, Money> medicinePriceMap;
+      m_medicineRepo->forEach([&medicinePriceMap](const Model::Medicine &med)
+                              { medicinePriceMap[InternedString(med.getMedicineID())] = med.getUnitPriceValue(); });
+
+      m_prescriptionRepo->forEach([&summaries, &medicinePriceMap](const Model::Prescription &presc)
       {
         PrescriptionSummary summary;
         summary.prescriptionID = presc.getPrescriptionID();
@@ -327,7 +335,16 @@ namespace HMS
         summary.diagnosis = presc.getDiagnosis();
         summary.itemCount = static_cast<int>(presc.getItemCount());
         summary.isDispensed = presc.isDispensed();
-        summary.totalCost = calculateItemsCost(presc.getItems());
+        Money totalCost;
+        for (const auto &item : presc.getItems())
+        {
+          auto it = medicinePriceMap.find(item.medicineID);
+          if (it != medicinePriceMap.end())
+          {
+            totalCost += it->second * item.quantity;
+          }
+        }
+        summary.totalCost = totalCost.toDouble();
 
         // Note: Patient and doctor names would require additional lookups
         // For now, we use IDs/usernames
@@ -335,7 +352,7 @@ namespace HMS
         summary.doctorName = presc.getDoctorID();
 
         summaries.push_back(summary);
-      }
+      });
 
       return summaries;
     }
@@ -374,45 +391,46 @@ namespace HMS
         return result;
       }
 
-      // Check stock availability for all items first
+      // Stage every stock deduction and the status change, then commit them
+      // together: nothing changes unless all items are in stock
+      DAL::UnitOfWork work;
       for (const auto &item : items)
       {
-        auto medicine = m_medicineRepo->getById(item.medicineID);
-        if (!medicine)
-        {
-          result.failedItems.push_back(item.medicineID);
-          continue;
-        }
+        work.adjustStock(item.medicineID, -item.quantity);
+      }
+      work.markDispensed(prescriptionID);
 
-        if (medicine->getQuantityInStock() < item.quantity)
+      if (!work.commit())
+      {
+        const auto &failed = work.getFailedMedicines();
+        for (const auto &item : items)
         {
-          result.failedItems.push_back(item.medicineID);
+          if (std::ranges::find(failed, item.medicineID.str()) != failed.end())
+          {
+            result.failedItems.push_back(item.medicineID);
+          }
         }
-      }
 
-      if (!result.failedItems.empty())
-      {
-        result.message = "Insufficient stock for some items";
+        if (!result.failedItems.empty())
+          result.message = "Insufficient stock for some items";
+        else if (!work.getFailedPrescriptions().empty())
+          result.message = "Prescription already dispensed";
+        else
+          result.message = "Failed to save dispensing";
         return result;
       }
 
-      // Deduct stock for all items and calculate total cost
+      // Calculate cost from the medicines as committed
+      Money totalCost;
       for (const auto &item : items)
       {
-        auto medicine = m_medicineRepo->getById(item.medicineID);
+        auto medicine = work.getCommittedMedicine(item.medicineID);
         if (medicine)
         {
-          // Deduct stock
-          int newStock = medicine->getQuantityInStock() - item.quantity;
-          m_medicineRepo->updateStock(item.medicineID, newStock);
-
-          // Calculate cost
-          result.totalCost += medicine->getUnitPrice() * item.quantity;
+          totalCost += medicine->getUnitPriceValue() * item.quantity;
         }
       }
-
-      // Mark as dispensed
-      m_prescriptionRepo->markAsDispensed(prescriptionID);
+      result.totalCost = totalCost.toDouble();
 
       result.success = true;
       result.message = "Prescription dispensed successfully";
@@ -502,18 +520,18 @@ namespace HMS
     double PrescriptionService::calculateItemsCost(
         const List<Model::PrescriptionItem> &items) const
     {
-      double total = 0.0;
+      Money total;
 
       for (const auto &item : items)
       {
         auto medicine = m_medicineRepo->getById(item.medicineID);
         if (medicine)
         {
-          total += medicine->getUnitPrice() * item.quantity;
+          total += medicine->getUnitPriceValue() * item.quantity;
         }
       }
 
-      return total;
+      return total.toDouble();
     }
 
     // ==================== Print/Export ====================
@@ -536,26 +554,25 @@ namespace HMS
     std::map<std::string, int>
     PrescriptionService::getPrescriptionStatistics() const
     {
-      std::map<std::string, int> stats;
-      auto prescriptions = m_prescriptionRepo->getAll();
-
-      stats["total"] = static_cast<int>(prescriptions.size());
-      stats["dispensed"] = 0;
-      stats["undispensed"] = 0;
-      stats["totalItems"] = 0;
+      int total = 0;
+      int dispensed = 0;
+      int totalItems = 0;
 
-      for (const auto &presc : prescriptions)
+      m_prescriptionRepo->forEach([&](const Model::Prescription &presc)
       {
+        ++total;
         if (presc.isDispensed())
         {
-          stats["dispensed"]++;
-        }
-        else
-        {
-          stats["undispensed"]++;
+          ++dispensed;
         }
-        stats["totalItems"] += static_cast<int>(presc.getItemCount());
-      }
+        totalItems += static_cast<int>(presc.getItemCount());
+      });
+
+      std::map<std::string, int> stats;
+      stats["total"] = total;
+      stats["dispensed"] = dispensed;
+      stats["undispensed"] = total - dispensed;
+      stats["totalItems"] = totalItems;
 
       return stats;
     }
@@ -563,23 +580,22 @@ namespace HMS
     List<std::pair<std::string, int>>
     PrescriptionService::getMostPrescribedMedicines(int limit) const
     {
-      std::map<std::string, int> medicineCounts;
-      auto prescriptions = m_prescriptionRepo->getAll();
+      std::map<std::string, int, DAL::IdLess> medicineCounts;
 
       // Count occurrences of each medicine
-      for (const auto &presc : prescriptions)
+      m_prescriptionRepo->forEach([&medicineCounts](const Model::Prescription &presc)
       {
         const auto &items = presc.getItems();
         for (const auto &item : items)
         {
           medicineCounts[item.medicineID] += item.quantity;
         }
-      }
+      });
 
-      // Convert to vector and sort by count
+      // Convert to vector and sort by count (ties stay in ID order)
       List<std::pair<std::string, int>> result(medicineCounts.begin(),
                                                medicineCounts.end());
-      std::ranges::sort(
+      std::ranges::stable_sort(
           result, [](const auto &a, const auto &b)
           { return a.second > b.second; });
 
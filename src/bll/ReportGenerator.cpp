@@ -3,7 +3,9 @@
 #include "common/Types.h"
 #include "common/Utils.h"
 #include "dal/AppointmentRepository.h"
+#include "dal/DataSnapshot.h"
 #include "dal/DoctorRepository.h"
+#include "dal/IdSequence.h"
 #include "dal/MedicineRepository.h"
 #include "dal/PatientRepository.h"
 #include "dal/PrescriptionRepository.h"
@@ -11,6 +13,7 @@
 #include <algorithm>
 #include <atomic>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <map>
@@ -18,6 +21,7 @@
 #include <set>
 #include <sstream>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace HMS
 {
@@ -107,40 +111,22 @@ namespace HMS
       // Helper to calculate end of week (6 days after start)
       std::string calculateWeekEnd(const std::string &startDate)
       {
-        if (!Utils::isValidDateInternal(startDate))
+        auto start = Date::parse(startDate);
+        if (!start)
         {
           return startDate;
         }
 
-        int year = std::stoi(startDate.substr(0, 4));
-        int month = std::stoi(startDate.substr(5, 2));
-        int day = std::stoi(startDate.substr(8, 2));
-
-        std::tm tm = {};
-        tm.tm_year = year - 1900;
-        tm.tm_mon = month - 1;
-        tm.tm_mday = day + 6;
-        std::mktime(&tm);
-
-        char buffer[11];
-        std::strftime(buffer, sizeof(buffer), "%Y-%m-%d", &tm);
-        return std::string(buffer);
+        return start->addDays(6).toString();
       }
 
       // Helper to calculate month date range
       std::pair<std::string, std::string> getMonthRange(int month, int year)
       {
-        std::ostringstream startOss;
-        startOss << year << "-" << std::setfill('0') << std::setw(2) << month
-                 << "-01";
-
-        int daysInMonth = Utils::getDaysInMonth(month, year);
+        Date first = Date::fromCivil(year, month, 1);
+        Date last = Date::fromCivil(year, month, Date::daysInMonth(month, year));
 
-        std::ostringstream endOss;
-        endOss << year << "-" << std::setfill('0') << std::setw(2) << month << "-"
-               << std::setfill('0') << std::setw(2) << daysInMonth;
-
-        return {startOss.str(), endOss.str()};
+        return {first.toString(), last.toString()};
       }
 
       // Safe division helper
@@ -153,16 +139,54 @@ namespace HMS
         return numerator / denominator;
       }
 
+      // Snapshot records matching a predicate, by reference (no copies)
+      template <typename T, typename Pred>
+      std::vector<std::reference_wrapper<const T>>
+      selectFromSnapshot(const DAL::Snapshot<T> &snapshot, Pred pred)
+      {
+        std::vector<std::reference_wrapper<const T>> result;
+        for (const auto &item : *snapshot)
+        {
+          if (pred(item))
+          {
+            result.push_back(std::cref(item));
+          }
+        }
+        return result;
+      }
+
+      // Snapshot appointments dated within [startDate, endDate] (YYYY-MM-DD)
+      std::vector<std::reference_wrapper<const Model::Appointment>>
+      appointmentsInRange(const DAL::Snapshot<Model::Appointment> &appointments,
+                          const std::string &startDate, const std::string &endDate)
+      {
+        auto start = Date::parse(startDate);
+        auto end = Date::parse(endDate);
+        if (!start || !end)
+        {
+          return {};
+        }
+
+        return selectFromSnapshot(appointments, [&](const Model::Appointment &appt)
+                                  {
+                                    Date date = appt.getDateValue();
+                                    return date >= *start && date <= *end;
+                                  });
+      }
+
       // Helper to aggregate appointment statistics
-      Model::Statistics
-      aggregateAppointmentStats(const std::vector<Model::Appointment> &appointments)
+      // (accepts appointments or references to snapshot appointments)
+      template <typename Range>
+      Model::Statistics aggregateAppointmentStats(const Range &appointments)
       {
         Model::Statistics stats;
         stats.reset();
 
         stats.totalAppointments = static_cast<int>(appointments.size());
 
-        for (const auto &appt : appointments)
+        // Revenue is summed exactly, then converted once
+        Money totalRevenue, paidRevenue, unpaidRevenue;
+        for (const Model::Appointment &appt : appointments)
         {
           switch (appt.getStatus())
           {
@@ -171,14 +195,14 @@ namespace HMS
             break;
           case AppointmentStatus::COMPLETED:
             stats.completedAppointments++;
-            stats.totalRevenue += appt.getPrice();
+            totalRevenue += appt.getPriceValue();
             if (appt.isPaid())
             {
-              stats.paidRevenue += appt.getPrice();
+              paidRevenue += appt.getPriceValue();
             }
             else
             {
-              stats.unpaidRevenue += appt.getPrice();
+              unpaidRevenue += appt.getPriceValue();
             }
             break;
           case AppointmentStatus::CANCELLED:
@@ -192,6 +216,10 @@ namespace HMS
           }
         }
 
+        stats.totalRevenue = totalRevenue.toDouble();
+        stats.paidRevenue = paidRevenue.toDouble();
+        stats.unpaidRevenue = unpaidRevenue.toDouble();
+
         stats.calculate();
         return stats;
       }
@@ -224,6 +252,15 @@ namespace HMS
         return oss.str();
       }
 
+      std::string formatStatLine(const std::string &label, Money value,
+                                 int width = 25)
+      {
+        std::ostringstream oss;
+        oss << "  " << Utils::padString(label + ":", width)
+            << Utils::formatMoney(value) << "\n";
+        return oss.str();
+      }
+
       std::string formatStatLine(const std::string &label, const std::string &value,
                                  int width = 25)
       {
@@ -386,25 +423,27 @@ namespace HMS
       report.title = "BÁO CÁO THÁNG - " + std::string(monthNames[month - 1]) +
                      " " + std::to_string(year);
 
-      Repositories repos;
-      auto appointments = repos.appointments->getByDateRange(startDate, endDate);
-      auto allDoctors = repos.doctors->getAll();
+      // Point-in-time view of both repositories; bookings are not blocked meanwhile
+      auto data = DAL::DataSnapshot::capture(DAL::DataSnapshot::DOCTORS |
+                                             DAL::DataSnapshot::APPOINTMENTS);
+      auto appointments = appointmentsInRange(data.appointments, startDate, endDate);
+      const auto &allDoctors = *data.doctors;
 
       // Aggregate statistics
       report.statistics = aggregateAppointmentStats(appointments);
 
-      // Build doctor lookup map to avoid N+1
-      std::unordered_map<std::string, std::string> doctorSpecMap;
+      // Build doctor lookup map to avoid N+1 (keyed by handle, so the join compares integers)
+      std::unordered_map<InternedString, std::string> doctorSpecMap;
       for (const auto &doc : allDoctors)
       {
-        doctorSpecMap[doc.getID()] = doc.getSpecialization();
+        doctorSpecMap[InternedString(doc.getID())] = doc.getSpecialization();
         report.statistics.doctorsBySpecialization[doc.getSpecialization()]++;
       }
 
       // Count appointments by specialization
-      for (const auto &appt : appointments)
+      for (const Model::Appointment &appt : appointments)
       {
-        auto it = doctorSpecMap.find(appt.getDoctorID());
+        auto it = doctorSpecMap.find(appt.getDoctorHandle());
         if (it != doctorSpecMap.end())
         {
           report.statistics.appointmentsBySpecialization[it->second]++;
@@ -479,57 +518,62 @@ namespace HMS
 
       report.title = "BÁO CÁO DOANH THU";
 
-      Repositories repos;
-      auto appointments = repos.appointments->getByDateRange(startDate, endDate);
-      auto allDoctors = repos.doctors->getAll();
-      auto prescriptions = repos.prescriptions->getByDateRange(startDate, endDate);
-      auto dispensedPrescriptions = repos.prescriptions->getDispensed();
+      // Point-in-time view of every repository involved; bookings and
+      // dispensing are not blocked while the report runs
+      auto data = DAL::DataSnapshot::capture(
+          DAL::DataSnapshot::DOCTORS | DAL::DataSnapshot::APPOINTMENTS |
+          DAL::DataSnapshot::MEDICINES | DAL::DataSnapshot::PRESCRIPTIONS);
+      auto appointments = appointmentsInRange(data.appointments, startDate, endDate);
+      const auto &allDoctors = *data.doctors;
+      auto dispensedPrescriptions = selectFromSnapshot(
+          data.prescriptions, [](const Model::Prescription &presc)
+          { return presc.isDispensed(); });
 
       // Build doctor lookup
       std::unordered_map<std::string, std::string> doctorNameMap;
-      std::unordered_map<std::string, double> doctorRevenueMap;
+      std::unordered_map<std::string, Money> doctorRevenueMap;
       for (const auto &doc : allDoctors)
       {
         doctorNameMap[doc.getID()] = doc.getName();
-        doctorRevenueMap[doc.getID()] = 0.0;
+        doctorRevenueMap[doc.getID()] = Money();
       }
 
       // Calculate revenue per doctor
-      double totalRevenue = 0.0;
-      double paidRevenue = 0.0;
+      Money totalRevenue;
+      Money paidRevenue;
       int completedCount = 0;
 
-      for (const auto &appt : appointments)
+      for (const Model::Appointment &appt : appointments)
       {
         if (appt.getStatus() == AppointmentStatus::COMPLETED)
         {
           completedCount++;
-          totalRevenue += appt.getPrice();
-          doctorRevenueMap[appt.getDoctorID()] += appt.getPrice();
+          totalRevenue += appt.getPriceValue();
+          doctorRevenueMap[appt.getDoctorID()] += appt.getPriceValue();
 
           if (appt.isPaid())
           {
-            paidRevenue += appt.getPrice();
+            paidRevenue += appt.getPriceValue();
           }
         }
       }
 
       // Calculate pharmacy revenue from dispensed prescriptions in date range
       // Pre-load all medicines into a lookup map to avoid N+1 queries
-      auto allMedicines = repos.medicines->getAll();
-      std::unordered_map<std::string, double> medicinePriceMap;
-      for (const auto &med : allMedicines)
+      std::unordered_map<InternedString, Money> medicinePriceMap;
+      for (const auto &med : *data.medicines)
       {
-        medicinePriceMap[med.getMedicineID()] = med.getUnitPrice();
+        medicinePriceMap[InternedString(med.getMedicineID())] = med.getUnitPriceValue();
       }
 
-      double pharmacyRevenue = 0.0;
-      for (const auto &presc : dispensedPrescriptions)
+      const Date rangeStart = Date::parse(startDate).value_or(Date{});
+      const Date rangeEnd = Date::parse(endDate).value_or(Date{});
+      Money pharmacyRevenue;
+      for (const Model::Prescription &presc : dispensedPrescriptions)
       {
         // Check if prescription is in date range
-        const std::string &prescDate = presc.getPrescriptionDate();
-        if (Utils::compareDates(prescDate, startDate) >= 0 &&
-            Utils::compareDates(prescDate, endDate) <= 0)
+        Date prescDate = presc.getPrescriptionDateValue();
+        if (prescDate >= rangeStart && prescDate <= rangeEnd)
         {
           // Sum up medicine costs using pre-loaded price map
           for (const auto &item : presc.getItems())
@@ -543,9 +587,9 @@ namespace HMS
         }
       }
 
-      report.statistics.totalRevenue = totalRevenue;
-      report.statistics.paidRevenue = paidRevenue;
-      report.statistics.unpaidRevenue = totalRevenue - paidRevenue;
+      report.statistics.totalRevenue = totalRevenue.toDouble();
+      report.statistics.paidRevenue = paidRevenue.toDouble();
+      report.statistics.unpaidRevenue = (totalRevenue - paidRevenue).toDouble();
 
       // Build content
       std::ostringstream content;
@@ -562,7 +606,7 @@ namespace HMS
       content << formatStatLine("Đã thanh toán", paidRevenue);
       content << formatStatLine("Chưa thanh toán", totalRevenue - paidRevenue);
 
-      double collectionRate = safeDivide(paidRevenue, totalRevenue) * 100.0;
+      double collectionRate = safeDivide(paidRevenue.toDouble(), totalRevenue.toDouble()) * 100.0;
       content << formatStatLine("Tỷ lệ thanh toán",
                                 std::to_string(static_cast<int>(collectionRate)) +
                                     "%");
@@ -576,17 +620,21 @@ namespace HMS
       content << formatStatLine("Doanh thu tổng", totalRevenue + pharmacyRevenue);
 
       // Top Earning Doctors
-      std::vector<std::pair<std::string, double>> sortedDoctors(
+      std::vector<std::pair<std::string, Money>> sortedDoctors(
           doctorRevenueMap.begin(), doctorRevenueMap.end());
       std::sort(sortedDoctors.begin(), sortedDoctors.end(),
                 [](const auto &a, const auto &b)
-                { return a.second > b.second; });
+                {
+                  if (a.second != b.second)
+                    return a.second > b.second;
+                  return DAL::IdLess{}(a.first, b.first);
+                });
 
       content << formatSectionHeader("BÁC SĨ CÓ DOANH THU CAO");
       int rank = 1;
       for (const auto &[doctorID, revenue] : sortedDoctors)
       {
-        if (revenue > 0 && rank <= 5)
+        if (revenue > Money() && rank <= 5)
         {
           std::string doctorName =
               doctorNameMap.count(doctorID) ? doctorNameMap[doctorID] : doctorID;
@@ -609,25 +657,26 @@ namespace HMS
       report.title = "BÁO CÁO THỐNG KÊ BỆNH NHÂN";
 
       Repositories repos;
-      auto patients = repos.patients->getAll();
-      auto appointments = repos.appointments->getAll();
 
       // Count unique patients with appointments
-      std::set<std::string> patientsWithAppointments;
-      std::unordered_map<std::string, int> appointmentsPerPatient;
+      std::unordered_set<InternedString> patientsWithAppointments;
+      std::unordered_map<InternedString, int> appointmentsPerPatient;
+      size_t appointmentCount = 0;
 
-      for (const auto &appt : appointments)
-      {
-        patientsWithAppointments.insert(appt.getPatientUsername());
-        appointmentsPerPatient[appt.getPatientUsername()]++;
-      }
+      repos.appointments->forEach(
+          [&](const Model::Appointment &appt)
+          {
+            patientsWithAppointments.insert(appt.getPatientHandle());
+            appointmentsPerPatient[appt.getPatientHandle()]++;
+            ++appointmentCount;
+          });
 
       // Calculate statistics
-      report.statistics.totalPatients = static_cast<int>(patients.size());
+      report.statistics.totalPatients = static_cast<int>(repos.patients->count());
       int activePatients = static_cast<int>(patientsWithAppointments.size());
 
       double avgAppointmentsPerPatient =
-          safeDivide(static_cast<double>(appointments.size()),
+          safeDivide(static_cast<double>(appointmentCount),
                      static_cast<double>(activePatients));
 
       // Build content
@@ -651,7 +700,7 @@ namespace HMS
 
       content << formatSectionHeader("THỐNG KÊ CUỘC HẸN");
       content << formatStatLine("Tổng số cuộc hẹn",
-                                static_cast<int>(appointments.size()));
+                                static_cast<int>(appointmentCount));
       std::ostringstream avgOss;
       avgOss << std::fixed << std::setprecision(1) << avgAppointmentsPerPatient;
       content << formatStatLine("Trung bình bệnh nhân hoạt động", avgOss.str());
@@ -683,14 +732,13 @@ namespace HMS
       report.title = "BÁO CÁO HIỆU SUẤT BÁC SĨ";
 
       Repositories repos;
-      auto allDoctors = repos.doctors->getAll();
       auto appointments = repos.appointments->getByDateRange(startDate, endDate);
 
       // Filter by doctor if specified
       std::vector<Model::Doctor> targetDoctors;
       if (doctorID.empty())
       {
-        targetDoctors = allDoctors;
+        targetDoctors = repos.doctors->getAll();
       }
       else
       {
@@ -714,11 +762,11 @@ namespace HMS
         int completed = 0;
         int cancelled = 0;
         int noShow = 0;
-        double revenue = 0.0;
-        std::set<std::string> uniquePatients;
+        Money revenue;
+        std::unordered_set<InternedString> uniquePatients;
       };
 
-      std::map<std::string, DoctorStats> doctorStatsMap;
+      std::map<std::string, DoctorStats, DAL::IdLess> doctorStatsMap;
 
       for (const auto &doc : targetDoctors)
       {
@@ -739,8 +787,8 @@ namespace HMS
         {
         case AppointmentStatus::COMPLETED:
           stats.completed++;
-          stats.revenue += appt.getPrice();
-          stats.uniquePatients.insert(appt.getPatientUsername());
+          stats.revenue += appt.getPriceValue();
+          stats.uniquePatients.insert(appt.getPatientHandle());
           break;
         case AppointmentStatus::CANCELLED:
           stats.cancelled++;
@@ -817,10 +865,10 @@ namespace HMS
       report.statistics = aggregateAppointmentStats(appointments);
 
       // Group by date
-      std::map<std::string, int> appointmentsByDate;
+      std::map<Date, int> appointmentsByDate;
       for (const auto &appt : appointments)
       {
-        appointmentsByDate[appt.getDate()]++;
+        appointmentsByDate[appt.getDateValue()]++;
       }
 
       // Find busiest day
@@ -831,7 +879,7 @@ namespace HMS
         if (count > maxCount)
         {
           maxCount = count;
-          busiestDay = date;
+          busiestDay = date.toString();
         }
       }
 
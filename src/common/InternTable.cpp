@@ -0,0 +1,61 @@
+#include "common/InternTable.h"
+
+#include <mutex>
+
+namespace HMS
+{
+
+    // ==================== Construction ====================
+
+    InternTable &InternTable::instance()
+    {
+        // Never destroyed, so handles held by static objects stay valid at exit
+        static InternTable *table = new InternTable();
+        return *table;
+    }
+
+    InternTable::InternTable()
+    {
+        m_entries.push_back({std::string(), 0});
+        m_empty = &m_entries.back();
+        m_lookup.emplace(m_empty->value, m_empty);
+    }
+
+    // ==================== Operations ====================
+
+    const InternTable::Entry *InternTable::intern(std::string_view value)
+    {
+        {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            auto it = m_lookup.find(value);
+            if (it != m_lookup.end())
+                return it->second;
+        }
+
+        std::lock_guard<std::shared_mutex> lock(m_mutex);
+
+        // Another thread may have added it between the two locks
+        auto it = m_lookup.find(value);
+        if (it != m_lookup.end())
+            return it->second;
+
+        m_entries.push_back({std::string(value), static_cast<InternId>(m_entries.size())});
+        const Entry *entry = &m_entries.back();
+        m_lookup.emplace(entry->value, entry);
+        return entry;
+    }
+
+    const InternTable::Entry *InternTable::find(std::string_view value) const
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        auto it = m_lookup.find(value);
+        return it != m_lookup.end() ? it->second : nullptr;
+    }
+
+    size_t InternTable::size() const
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return m_entries.size();
+    }
+
+} // namespace HMS
@@ -1,4 +1,6 @@
 #include "common/Utils.h"
+#include "common/Constants.h"
+#include "common/Types.h"
 #include <ctime>
 #include <sstream>
 #include <algorithm>
@@ -11,24 +13,64 @@ namespace HMS
 
         // ==================== String Utilities ====================
 
-        std::vector<std::string> split(const std::string &str, char delimiter)
+        std::vector<std::string> split(std::string_view str, char delimiter)
         {
             std::vector<std::string> result;
-            std::stringstream ss(str);
-            std::string item;
+            if (str.empty())
+                return result;
 
-            while (std::getline(ss, item, delimiter))
+            // A trailing delimiter yields a final empty field ("a|b|" -> ["a", "b", ""])
+            size_t start = 0;
+            while (true)
             {
-                result.push_back(item);
+                size_t end = str.find(delimiter, start);
+                if (end == std::string_view::npos)
+                {
+                    result.emplace_back(str.substr(start));
+                    break;
+                }
+                result.emplace_back(str.substr(start, end - start));
+                start = end + 1;
             }
 
-            // Handle trailing delimiter (e.g., "a|b|" should return ["a", "b", ""])
-            if (!str.empty() && str.back() == delimiter)
+            return result;
+        }
+
+        FieldTokenizer::FieldTokenizer(std::string_view str, char delimiter)
+            : m_str(str), m_delimiter(delimiter), m_pos(0), m_done(str.empty())
+        {
+        }
+
+        bool FieldTokenizer::next(std::string_view &field)
+        {
+            if (m_done)
+                return false;
+
+            size_t end = m_str.find(m_delimiter, m_pos);
+            if (end == std::string_view::npos)
             {
-                result.push_back("");
+                field = m_str.substr(m_pos);
+                m_done = true;
+                return true;
             }
 
-            return result;
+            field = m_str.substr(m_pos, end - m_pos);
+            m_pos = end + 1;
+            return true;
+        }
+
+        size_t splitView(std::string_view str, char delimiter, std::span<std::string_view> fields)
+        {
+            FieldTokenizer tokenizer(str, delimiter);
+            std::string_view field;
+            size_t count = 0;
+            while (tokenizer.next(field))
+            {
+                if (count < fields.size())
+                    fields[count] = field;
+                ++count;
+            }
+            return count;
         }
 
         std::string join(const std::vector<std::string> &parts, char delimiter)
@@ -45,11 +87,16 @@ namespace HMS
             return result;
         }
 
-        std::string trim(const std::string &str)
+        std::string trim(std::string_view str)
+        {
+            return std::string(trimView(str));
+        }
+
+        std::string_view trimView(std::string_view str)
         {
             size_t start = str.find_first_not_of(" \t\n\r");
-            if (start == std::string::npos)
-                return "";
+            if (start == std::string_view::npos)
+                return {};
 
             size_t end = str.find_last_not_of(" \t\n\r");
             return str.substr(start, end - start + 1);
@@ -73,9 +120,13 @@ namespace HMS
             return result;
         }
 
-        bool containsIgnoreCase(const std::string &str, const std::string &substr)
+        bool containsIgnoreCase(std::string_view str, std::string_view substr)
         {
-            return toLower(str).find(toLower(substr)) != std::string::npos;
+            // Compare in place instead of lowering copies of both strings
+            auto it = std::search(str.begin(), str.end(), substr.begin(), substr.end(),
+                                  [](unsigned char a, unsigned char b)
+                                  { return std::tolower(a) == std::tolower(b); });
+            return it != str.end() || substr.empty();
         }
 
         // ==================== Date/Time Utilities ====================
@@ -140,34 +191,7 @@ namespace HMS
         // Validates YYYY-MM-DD format (internal storage format)
         bool isValidDateInternal(const std::string &date)
         {
-            if (date.length() != 10)
-                return false; // YYYY-MM-DD
-            if (date[4] != '-' || date[7] != '-')
-                return false;
-
-            for (int i = 0; i < 10; ++i)
-            {
-                if (i == 4 || i == 7)
-                    continue;
-                if (!std::isdigit(date[i]))
-                    return false;
-            }
-
-            int year = std::stoi(date.substr(0, 4));
-            int month = std::stoi(date.substr(5, 2));
-            int day = std::stoi(date.substr(8, 2));
-
-            if (year < 1900 || year > 2100)
-                return false;
-            if (month < 1 || month > 12)
-                return false;
-
-            // Validate day is within valid range for the specific month
-            int maxDays = getDaysInMonth(month, year);
-            if (day < 1 || day > maxDays)
-                return false;
-
-            return true;
+            return Date::parse(date).has_value();
         }
 
         // Convert DD-MM-YYYY to YYYY-MM-DD
@@ -198,28 +222,7 @@ namespace HMS
 
         bool isValidTime(const std::string &time)
         {
-            if (time.length() != 5)
-                return false; // HH:MM
-            if (time[2] != ':')
-                return false;
-
-            for (int i = 0; i < 5; ++i)
-            {
-                if (i == 2)
-                    continue;
-                if (!std::isdigit(time[i]))
-                    return false;
-            }
-
-            int hour = std::stoi(time.substr(0, 2));
-            int minute = std::stoi(time.substr(3, 2));
-
-            if (hour < 0 || hour > 23)
-                return false;
-            if (minute < 0 || minute > 59)
-                return false;
-
-            return true;
+            return TimeOfDay::parse(time).has_value();
         }
 
         int compareDates(const std::string &date1, const std::string &date2)
@@ -233,34 +236,14 @@ namespace HMS
 
         int daysBetweenDates(const std::string &futureDate, const std::string &currentDate)
         {
-            if (!isValidDateInternal(futureDate) || !isValidDateInternal(currentDate))
+            auto future = Date::parse(futureDate);
+            auto current = Date::parse(currentDate);
+            if (!future || !current)
             {
                 return 0;
             }
 
-            int year1 = std::stoi(futureDate.substr(0, 4));
-            int month1 = std::stoi(futureDate.substr(5, 2));
-            int day1 = std::stoi(futureDate.substr(8, 2));
-
-            int year2 = std::stoi(currentDate.substr(0, 4));
-            int month2 = std::stoi(currentDate.substr(5, 2));
-            int day2 = std::stoi(currentDate.substr(8, 2));
-
-            std::tm tm1 = {};
-            tm1.tm_year = year1 - 1900;
-            tm1.tm_mon = month1 - 1;
-            tm1.tm_mday = day1;
-
-            std::tm tm2 = {};
-            tm2.tm_year = year2 - 1900;
-            tm2.tm_mon = month2 - 1;
-            tm2.tm_mday = day2;
-
-            std::time_t time1 = std::mktime(&tm1);
-            std::time_t time2 = std::mktime(&tm2);
-
-            double seconds = std::difftime(time1, time2);
-            return static_cast<int>(seconds / 86400);
+            return *future - *current;
         }
 
         bool isFutureDate(const std::string &date)
@@ -275,62 +258,42 @@ namespace HMS
 
         int getDaysInMonth(int month, int year)
         {
-            if (month < 1 || month > 12)
-            {
-                return 0;
-            }
-
-            if (month == 2)
-            {
-                bool isLeap = (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
-                return isLeap ? 29 : 28;
-            }
-
-            if (month == 4 || month == 6 || month == 9 || month == 11)
-            {
-                return 30;
-            }
-
-            return 31;
+            return Date::daysInMonth(month, year);
         }
 
         bool getWeekRange(const std::string &date, std::string &startDate, std::string &endDate)
         {
             // This function expects internal format (YYYY-MM-DD)
-            if (!isValidDateInternal(date))
+            auto day = Date::parse(date);
+            if (!day)
             {
                 return false;
             }
 
-            int year = std::stoi(date.substr(0, 4));
-            int month = std::stoi(date.substr(5, 2));
-            int day = std::stoi(date.substr(8, 2));
-
-            std::tm tm = {};
-            tm.tm_year = year - 1900;
-            tm.tm_mon = month - 1;
-            tm.tm_mday = day;
-            std::mktime(&tm);
-
-            // Calculate days from Monday (Monday = 0, Sunday = 6)
-            int daysFromMonday = (tm.tm_wday == 0) ? 6 : tm.tm_wday - 1;
-
-            // Go to Monday
-            tm.tm_mday -= daysFromMonday;
-            std::mktime(&tm);
+            Date monday = day->addDays(-day->weekday());
+            startDate = monday.toString();
+            endDate = monday.addDays(6).toString();
+            return true;
+        }
 
-            char buffer[11];
-            std::strftime(buffer, sizeof(buffer), "%Y-%m-%d", &tm);
-            startDate = buffer;
+        int getSlotIndex(const std::string &time)
+        {
+            auto parsed = TimeOfDay::parse(time);
+            if (!parsed)
+                return -1;
 
-            // Go to Sunday (add 6 days)
-            tm.tm_mday += 6;
-            std::mktime(&tm);
+            int offset = parsed->minutes() - Constants::WORK_START_HOUR * 60;
+            if (offset < 0 || offset % Constants::SLOT_DURATION_MINUTES != 0)
+                return -1;
 
-            std::strftime(buffer, sizeof(buffer), "%Y-%m-%d", &tm);
-            endDate = buffer;
+            int index = offset / Constants::SLOT_DURATION_MINUTES;
+            return index < Constants::SLOTS_PER_DAY ? index : -1;
+        }
 
-            return true;
+        std::string getSlotTime(int index)
+        {
+            int minutes = Constants::WORK_START_HOUR * 60 + index * Constants::SLOT_DURATION_MINUTES;
+            return TimeOfDay::fromMinutes(minutes).toString();
         }
 
         // ==================== ID Generation ====================
@@ -473,6 +436,11 @@ namespace HMS
             return ss.str();
         }
 
+        std::string formatMoney(Money amount)
+        {
+            return std::to_string(amount.roundedUnits()) + " VND";
+        }
+
         std::string formatDateDisplay(const std::string &date)
         {
             if (!isValidDate(date))
@@ -3,11 +3,14 @@
 #include "common/Types.h"
 #include "common/Utils.h"
 #include "dal/FileHelper.h"
+#include "dal/BackupWorker.h"
+#include "dal/LineParser.h"
 
 #include <algorithm>
 #include <filesystem>
 #include <format>
 #include <sstream>
+#include <unordered_set>
 
 namespace HMS
 {
@@ -20,12 +23,22 @@ namespace HMS
         // ==================== Private Constructor ====================
         AccountRepository::AccountRepository()
             : m_filePath(Constants::ACCOUNT_FILE),
-              m_isLoaded(false)
+              m_isLoaded(false),
+              m_journal(Constants::ACCOUNT_FILE), m_journalEnabled(false),
+              m_pendingChanges(0), m_flushScheduled(false)
         {
         }
 
         // ==================== Destructor ====================
-        AccountRepository::~AccountRepository() = default;
+        AccountRepository::~AccountRepository()
+        {
+            // Write-behind changes must not be lost with the instance
+            if (m_flushScheduled)
+            {
+                WriteBehindFlusher::getInstance()->cancel(this);
+            }
+            flushPendingInternal();
+        }
 
         // ==================== Singleton Access ====================
         AccountRepository *AccountRepository::getInstance()
@@ -53,22 +66,78 @@ namespace HMS
             }
         }
 
+        std::shared_lock<std::shared_mutex> AccountRepository::lockForRead() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            if (!m_isLoaded)
+            {
+                // Loading mutates the repository, so it runs under the exclusive lock
+                lock.unlock();
+                {
+                    std::lock_guard<std::shared_mutex> writeLock(m_dataMutex);
+                    ensureLoaded();
+                }
+                lock.lock();
+            }
+            return lock;
+        }
+
+        std::unique_lock<std::shared_mutex> AccountRepository::lockForWrite()
+        {
+            std::unique_lock<std::shared_mutex> lock(m_dataMutex);
+            ensureLoaded();
+            m_accounts.detach();
+            return lock;
+        }
+
+        void AccountRepository::rebuildIndex(size_t from)
+        {
+            if (from == 0)
+            {
+                m_idIndex.clear();
+                m_idIndex.reserve(m_accounts.size());
+            }
+
+            for (size_t i = from; i < m_accounts.size(); ++i)
+            {
+                m_idIndex[m_accounts[i].getUsername()] = i;
+            }
+        }
+
+        std::vector<Model::Account>::iterator AccountRepository::findById(const std::string &id)
+        {
+            auto it = m_idIndex.find(id);
+            if (it == m_idIndex.end())
+            {
+                return m_accounts.end();
+            }
+            return m_accounts.begin() + static_cast<std::ptrdiff_t>(it->second);
+        }
+
         // ==================== CRUD Operations ====================
         std::vector<Model::Account> AccountRepository::getAll()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
-            return m_accounts;
+            auto lock = lockForRead();
+            return m_accounts.items();
+        }
+
+        Snapshot<Model::Account> AccountRepository::getSnapshot() const
+        {
+            auto lock = lockForRead();
+            return m_accounts.snapshot();
+        }
+
+        ReadView<Model::Account> AccountRepository::view() const
+        {
+            auto lock = lockForRead();
+            return ReadView<Model::Account>(std::move(lock), m_accounts.items());
         }
 
         std::optional<Model::Account> AccountRepository::getById(const std::string &id)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            auto it = std::ranges::find_if(
-                m_accounts, [&id](const auto &acc)
-                { return acc.getUsername() == id; });
+            auto it = findById(id);
 
             if (it != m_accounts.end())
             {
@@ -85,62 +154,163 @@ namespace HMS
 
         bool AccountRepository::add(const Model::Account &account)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
             // Check if username already exists
-            bool exists = std::ranges::any_of(
-                m_accounts, [&account](const auto &acc)
-                { return acc.getUsername() == account.getUsername(); });
+            bool exists = m_idIndex.contains(account.getUsername());
 
             if (exists)
             {
                 return false;
             }
 
+            m_idIndex.emplace(account.getUsername(), m_accounts.size());
             m_accounts.push_back(account);
-            return saveInternal();
+            return persistUpsert(account);
         }
 
         bool AccountRepository::update(const Model::Account &account)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
-            auto it = std::ranges::find_if(
-                m_accounts, [&account](const auto &acc)
-                { return acc.getUsername() == account.getUsername(); });
+            auto it = findById(account.getUsername());
 
             if (it != m_accounts.end())
             {
                 *it = account;
-                return saveInternal();
+                return persistUpsert(account);
             }
             return false;
         }
 
         bool AccountRepository::remove(const std::string &id)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
-            auto it = std::ranges::find_if(
-                m_accounts, [&id](const auto &acc)
-                { return acc.getUsername() == id; });
+            auto it = findById(id);
 
             if (it == m_accounts.end())
             {
                 return false;
             }
 
+            const auto slot = static_cast<size_t>(it - m_accounts.begin());
             m_accounts.erase(it);
-            return saveInternal();
+            m_idIndex.erase(id);
+            rebuildIndex(slot);
+            return persistRemove(id);
+        }
+
+        bool AccountRepository::addRange(const std::vector<Model::Account> &accounts)
+        {
+            auto lock = lockForWrite();
+
+            // All or nothing: reject the batch if any username is taken or repeated
+            std::unordered_set<std::string_view> batchIds;
+            batchIds.reserve(accounts.size());
+            for (const auto &account : accounts)
+            {
+                const std::string &id = account.getUsername();
+                if (m_idIndex.contains(id) || !batchIds.insert(id).second)
+                {
+                    return false;
+                }
+            }
+
+            if (accounts.empty())
+            {
+                return true;
+            }
+
+            const size_t oldSize = m_accounts.size();
+            std::vector<Journal::Record> records;
+            records.reserve(accounts.size());
+            for (const auto &account : accounts)
+            {
+                m_idIndex.emplace(account.getUsername(), m_accounts.size());
+                m_accounts.push_back(account);
+                records.push_back({Journal::Operation::UPSERT, account.serialize()});
+            }
+            if (!persistRecords(records))
+            {
+                rollbackRange(oldSize, {}, records.size());
+                return false;
+            }
+            return true;
+        }
+
+        bool AccountRepository::upsertRange(const std::vector<Model::Account> &accounts)
+        {
+            auto lock = lockForWrite();
+
+            if (accounts.empty())
+            {
+                return true;
+            }
+
+            const size_t oldSize = m_accounts.size();
+            std::vector<std::pair<size_t, Model::Account>> replaced;
+            std::vector<Journal::Record> records;
+            records.reserve(accounts.size());
+            for (const auto &account : accounts)
+            {
+                auto it = findById(account.getUsername());
+                if (it != m_accounts.end())
+                {
+                    replaced.emplace_back(static_cast<size_t>(it - m_accounts.begin()), *it);
+                    *it = account;
+                }
+                else
+                {
+                    m_idIndex.emplace(account.getUsername(), m_accounts.size());
+                    m_accounts.push_back(account);
+                }
+                records.push_back({Journal::Operation::UPSERT, account.serialize()});
+            }
+            if (!persistRecords(records))
+            {
+                rollbackRange(oldSize, replaced, records.size());
+                return false;
+            }
+            return true;
+        }
+
+        void AccountRepository::rollbackRange(size_t oldSize,
+                                              const std::vector<std::pair<size_t, Model::Account>> &replaced,
+                                              size_t recordCount)
+        {
+            // Deferred records of the batch must not reach the file on a later flush
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.erase(m_pendingRecords.end() - static_cast<std::ptrdiff_t>(recordCount),
+                                           m_pendingRecords.end());
+                }
+                m_pendingChanges -= recordCount;
+            }
+
+            // Newest first, so a record replaced twice gets its original value back
+            for (auto it = replaced.rbegin(); it != replaced.rend(); ++it)
+            {
+                m_accounts[it->first] = it->second;
+            }
+
+            auto &items = m_accounts.items();
+            for (size_t slot = oldSize; slot < items.size(); ++slot)
+            {
+                m_idIndex.erase(items[slot].getUsername());
+            }
+            items.erase(items.begin() + static_cast<std::ptrdiff_t>(oldSize), items.end());
         }
 
         // ==================== Persistence ====================
         bool AccountRepository::load()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+
+            // Reloading replaces the records, so deferred changes are written first
+            flushPendingInternal();
             return loadInternal();
         }
 
@@ -159,19 +329,19 @@ namespace HMS
 
                 FileHelper::createFileIfNotExists(m_filePath);
 
-                std::vector<std::string> lines = FileHelper::readLines(m_filePath);
+                m_journal.waitForCompaction();
+                MappedFile file(m_filePath);
+                std::vector<std::string_view> lines = FileHelper::readLineViews(file);
 
-                m_accounts.clear();
+                // Chunks are parsed concurrently and merged back in file order
+                m_accounts = parseLines<Model::Account>(lines, &Model::Account::deserialize);
 
-                for (const auto &line : lines)
-                {
-                    auto account = Model::Account::deserialize(line);
-                    if (account)
-                    {
-                        m_accounts.push_back(account.value());
-                    }
-                }
+                // Replay mutations logged since the last snapshot. The journal is
+                // replayed even when journal mode is off so no logged change is lost.
+                m_journal.replay(m_accounts.items(), [](const auto &item)
+                                 { return item.getUsername(); });
 
+                rebuildIndex();
                 m_isLoaded = true;
                 return true;
             }
@@ -184,7 +354,7 @@ namespace HMS
 
         bool AccountRepository::save()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
             return saveInternal();
         }
 
@@ -192,6 +362,9 @@ namespace HMS
         {
             try
             {
+                // A background snapshot may still be writing the same file
+                m_journal.waitForCompaction();
+
                 std::vector<std::string> lines;
 
                 // Add header
@@ -212,8 +385,17 @@ namespace HMS
                     lines.push_back(acc.serialize());
                 }
 
-                FileHelper::createBackup(m_filePath);
-                return FileHelper::writeLines(m_filePath, lines);
+                if (!FileHelper::writeLines(m_filePath, lines))
+                {
+                    return false;
+                }
+                BackupWorker::getInstance()->submit(m_filePath, std::move(lines));
+
+                // Snapshot now contains every journaled change
+                m_journal.truncate();
+                m_pendingRecords.clear();
+                m_pendingChanges = 0;
+                return true;
             }
             catch (...)
             {
@@ -221,28 +403,195 @@ namespace HMS
             }
         }
 
+        bool AccountRepository::persistUpsert(const Model::Account &account)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.push_back({Journal::Operation::UPSERT, account.serialize()});
+                }
+                return deferWrite(1);
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(Journal::Operation::UPSERT, account.serialize(),
+                                        m_accounts, "Account");
+            }
+            return saveInternal();
+        }
+
+        bool AccountRepository::persistRemove(const std::string &id)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.push_back({Journal::Operation::REMOVE, id});
+                }
+                return deferWrite(1);
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(Journal::Operation::REMOVE, id, m_accounts, "Account");
+            }
+            return saveInternal();
+        }
+
+        bool AccountRepository::persistRecords(const std::vector<Journal::Record> &records)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.insert(m_pendingRecords.end(), records.begin(), records.end());
+                }
+
+                // One write covers the whole batch; no other writer needs to join it
+                if (m_durability.mode == DurabilityPolicy::Mode::GROUP_COMMIT)
+                {
+                    m_pendingChanges += records.size();
+                    return flushPendingInternal();
+                }
+                return deferWrite(records.size());
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(records, m_accounts, "Account");
+            }
+            return saveInternal();
+        }
+
+        bool AccountRepository::deferWrite(size_t changes)
+        {
+            m_pendingChanges += changes;
+            if (m_durability.mode == DurabilityPolicy::Mode::GROUP_COMMIT)
+            {
+                // Releases the lock until a leader has written this change
+                return m_groupCommit.commit(m_dataMutex, [this]
+                                            { return flushPendingInternal(); });
+            }
+
+            if (m_pendingChanges >= m_durability.maxPendingChanges)
+            {
+                return flushPendingInternal();
+            }
+
+            // Keeps the deadline of the first change since the last flush
+            m_flushScheduled = true;
+            WriteBehindFlusher::getInstance()->schedule(this, m_durability.interval, [this]
+                                                        { flush(); });
+            return true;
+        }
+
+        bool AccountRepository::flushPendingInternal()
+        {
+            if (m_pendingChanges == 0)
+            {
+                return true;
+            }
+
+            if (!m_journalEnabled)
+            {
+                return saveInternal();
+            }
+
+            if (!m_journal.append(m_pendingRecords, m_accounts, "Account"))
+            {
+                return false;
+            }
+            m_pendingRecords.clear();
+            m_pendingChanges = 0;
+            return true;
+        }
+
+        // ==================== Journal Mode ====================
+        void AccountRepository::setJournalEnabled(bool enabled)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            if (m_journalEnabled == enabled)
+            {
+                return;
+            }
+
+            // Deferred changes were recorded for the current mode
+            flushPendingInternal();
+
+            if (!enabled && m_isLoaded)
+            {
+                // Fold pending records into the data file before going back to full rewrites
+                saveInternal();
+            }
+
+            m_journalEnabled = enabled;
+        }
+
+        bool AccountRepository::isJournalEnabled() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_journalEnabled;
+        }
+
+        size_t AccountRepository::getJournalRecordCount() const
+        {
+            auto lock = lockForRead();
+            return m_journal.getRecordCount();
+        }
+
+        void AccountRepository::setCompactionPolicy(const Journal::CompactionPolicy &policy)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            m_journal.setCompactionPolicy(policy);
+        }
+
+        // ==================== Durability ====================
+        void AccountRepository::setDurabilityPolicy(const DurabilityPolicy &policy)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            flushPendingInternal();
+            m_durability = policy;
+        }
+
+        DurabilityPolicy AccountRepository::getDurabilityPolicy() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_durability;
+        }
+
+        bool AccountRepository::flush()
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            return flushPendingInternal();
+        }
+
+        size_t AccountRepository::getPendingChangeCount() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_pendingChanges;
+        }
+
         // ==================== Query Operations ====================
         size_t AccountRepository::count() const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
             return m_accounts.size();
         }
 
         bool AccountRepository::exists(const std::string &id) const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            return std::ranges::any_of(
-                m_accounts, [&id](const auto &acc)
-                { return acc.getUsername() == id; });
+            return m_idIndex.contains(id);
         }
 
         bool AccountRepository::clear()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
             m_accounts.clear();
+            m_idIndex.clear();
             m_isLoaded = true;
             return saveInternal();
         }
@@ -250,8 +599,7 @@ namespace HMS
         // ==================== Account-Specific Queries ====================
         std::vector<Model::Account> AccountRepository::getByRole(Role role)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Account> results;
             std::ranges::copy_if(
@@ -264,8 +612,7 @@ namespace HMS
 
         std::vector<Model::Account> AccountRepository::getActiveAccounts()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Account> results;
             std::ranges::copy_if(
@@ -280,12 +627,9 @@ namespace HMS
             const std::string &username,
             const std::string &passwordHash)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            auto it = std::ranges::find_if(
-                m_accounts, [&username](const auto &acc)
-                { return acc.getUsername() == username; });
+            auto it = findById(username);
 
             if (it != m_accounts.end())
             {
@@ -297,14 +641,16 @@ namespace HMS
         // ==================== File Path Management ====================
         void AccountRepository::setFilePath(const std::string &filePath)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            flushPendingInternal();
             m_filePath = filePath;
+            m_journal.setDataFilePath(filePath);
             m_isLoaded = false; // Force reload with new file
         }
 
         std::string AccountRepository::getFilePath() const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
             return m_filePath;
         }
 
@@ -2,24 +2,37 @@
 #include "common/Constants.h"
 #include "common/Utils.h"
 #include "dal/FileHelper.h"
+#include "dal/IdSequence.h"
+#include "dal/BackupWorker.h"
+#include "dal/LineParser.h"
 
 #include <algorithm>
+#include <bit>
 #include <filesystem>
 #include <format>
 #include <sstream>
+#include <unordered_set>
 
 namespace HMS
 {
     namespace DAL
     {
+        static_assert(Constants::SLOTS_PER_DAY <= 64, "Slot grid must fit in a SlotMask");
+
         // ==================== Static Members Initialization ====================
         std::unique_ptr<AppointmentRepository> AppointmentRepository::s_instance = nullptr;
         std::mutex AppointmentRepository::s_mutex;
 
         // ==================== Private Constructor ====================
         AppointmentRepository::AppointmentRepository()
-            : m_filePath(Constants::APPOINTMENT_FILE), m_isLoaded(false)
+            : m_filePath(Constants::APPOINTMENT_FILE), m_isLoaded(false),
+              m_idSequence(Constants::APPOINTMENT_ID_PREFIX),
+              m_journal(Constants::APPOINTMENT_FILE), m_journalEnabled(false),
+              m_pendingChanges(0), m_flushScheduled(false)
         {
+            // Snapshots written in the background must keep the sequence too
+            m_journal.setSnapshotHeader([this]
+                                        { return m_idSequence.getHeaderLine(); });
         }
 
         // ==================== Singleton Access ====================
@@ -40,7 +53,15 @@ namespace HMS
         }
 
         // ==================== Destructor ====================
-        AppointmentRepository::~AppointmentRepository() = default;
+        AppointmentRepository::~AppointmentRepository()
+        {
+            // Write-behind changes must not be lost with the instance
+            if (m_flushScheduled)
+            {
+                WriteBehindFlusher::getInstance()->cancel(this);
+            }
+            flushPendingInternal();
+        }
 
         // ==================== Private Helper ====================
         void AppointmentRepository::ensureLoaded() const
@@ -51,25 +72,270 @@ namespace HMS
             }
         }
 
-        // ==================== CRUD Operations ====================
-        std::vector<Model::Appointment> AppointmentRepository::getAll()
+        std::shared_lock<std::shared_mutex> AppointmentRepository::lockForRead() const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
-            return m_appointments;
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            if (!m_isLoaded)
+            {
+                // Loading mutates the repository, so it runs under the exclusive lock
+                lock.unlock();
+                {
+                    std::lock_guard<std::shared_mutex> writeLock(m_dataMutex);
+                    ensureLoaded();
+                }
+                lock.lock();
+            }
+            return lock;
         }
 
-        std::optional<Model::Appointment> AppointmentRepository::getById(const std::string &id)
+        std::unique_lock<std::shared_mutex> AppointmentRepository::lockForWrite()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::unique_lock<std::shared_mutex> lock(m_dataMutex);
             ensureLoaded();
+            m_appointments.detach();
+            return lock;
+        }
+
+        void AppointmentRepository::rebuildIndex(size_t from)
+        {
+            if (from == 0)
+            {
+                m_idIndex.clear();
+                m_idIndex.reserve(m_appointments.size());
+            }
+
+            for (size_t i = from; i < m_appointments.size(); ++i)
+            {
+                m_idIndex[m_appointments[i].getAppointmentID()] = i;
+            }
+        }
+
+        std::vector<Model::Appointment>::iterator AppointmentRepository::findById(const std::string &id)
+        {
+            auto it = m_idIndex.find(id);
+            if (it == m_idIndex.end())
+            {
+                return m_appointments.end();
+            }
+            return m_appointments.begin() + static_cast<std::ptrdiff_t>(it->second);
+        }
 
-            auto it = std::ranges::find_if(
-                m_appointments, [&id](const auto &a)
+        void AppointmentRepository::rebuildPatientIndex()
+        {
+            m_patientIndex.clear();
+            for (const auto &a : m_appointments)
+            {
+                m_patientIndex[a.getPatientHandle()].push_back(a.getAppointmentID());
+            }
+
+            auto dateTimeOf = [this](const std::string &id)
+            {
+                return m_appointments[m_idIndex.at(id)].getDateTime();
+            };
+            for (auto &[username, ids] : m_patientIndex)
+            {
+                std::ranges::stable_sort(ids, std::less<>{}, dateTimeOf);
+            }
+        }
+
+        void AppointmentRepository::indexByPatient(const Model::Appointment &appointment)
+        {
+            auto &ids = m_patientIndex[appointment.getPatientHandle()];
+
+            // Insert after appointments at the same date/time to keep insertion order
+            auto pos = std::ranges::upper_bound(
+                ids, appointment.getDateTime(), std::less<>{},
+                [this](const std::string &id)
                 {
-                    return a.getAppointmentID() == id;
+                    return m_appointments[m_idIndex.at(id)].getDateTime();
                 }
             );
+            ids.insert(pos, appointment.getAppointmentID());
+        }
+
+        void AppointmentRepository::unindexByPatient(const Model::Appointment &appointment)
+        {
+            auto it = m_patientIndex.find(appointment.getPatientHandle());
+            if (it == m_patientIndex.end())
+            {
+                return;
+            }
+
+            std::erase(it->second, appointment.getAppointmentID());
+            if (it->second.empty())
+            {
+                m_patientIndex.erase(it);
+            }
+        }
+
+        std::vector<Model::Appointment> AppointmentRepository::collectByPatient(
+            const std::string &patientUsername) const
+        {
+            std::vector<Model::Appointment> results;
+
+            auto patient = InternedString::lookup(patientUsername);
+            if (!patient)
+            {
+                return results;
+            }
+
+            auto it = m_patientIndex.find(*patient);
+            if (it == m_patientIndex.end())
+            {
+                return results;
+            }
+
+            results.reserve(it->second.size());
+            for (const auto &id : it->second)
+            {
+                results.push_back(m_appointments[m_idIndex.at(id)]);
+            }
+            return results;
+        }
+
+        void AppointmentRepository::rebuildSlotIndex()
+        {
+            m_slotIndex.clear();
+            for (const auto &a : m_appointments)
+            {
+                bookSlot(a);
+            }
+        }
+
+        void AppointmentRepository::bookSlot(const Model::Appointment &appointment)
+        {
+            if (appointment.getStatus() == AppointmentStatus::CANCELLED)
+            {
+                return;
+            }
+
+            auto &day = m_slotIndex[getSlotKey(appointment.getDoctorID(), appointment.getDate())];
+            int slot = Utils::getSlotIndex(appointment.getTime());
+            if (slot < 0)
+            {
+                day.offGridTimes.push_back(appointment.getTime());
+                return;
+            }
+
+            ++day.bookings[slot];
+            day.booked |= SlotMask{1} << slot;
+        }
+
+        void AppointmentRepository::releaseSlot(const Model::Appointment &appointment)
+        {
+            if (appointment.getStatus() == AppointmentStatus::CANCELLED)
+            {
+                return;
+            }
+
+            auto it = m_slotIndex.find(getSlotKey(appointment.getDoctorID(), appointment.getDate()));
+            if (it == m_slotIndex.end())
+            {
+                return;
+            }
+
+            auto &day = it->second;
+            int slot = Utils::getSlotIndex(appointment.getTime());
+            if (slot < 0)
+            {
+                auto pos = std::ranges::find(day.offGridTimes, appointment.getTime());
+                if (pos != day.offGridTimes.end())
+                {
+                    day.offGridTimes.erase(pos);
+                }
+            }
+            else if (day.bookings[slot] > 0 && --day.bookings[slot] == 0)
+            {
+                day.booked &= ~(SlotMask{1} << slot);
+            }
+
+            if (day.booked == 0 && day.offGridTimes.empty())
+            {
+                m_slotIndex.erase(it);
+            }
+        }
+
+        size_t AppointmentRepository::countBookings(const std::string &doctorID,
+                                                    const std::string &date,
+                                                    const std::string &time) const
+        {
+            auto it = m_slotIndex.find(getSlotKey(doctorID, date));
+            if (it == m_slotIndex.end())
+            {
+                return 0;
+            }
+
+            int slot = Utils::getSlotIndex(time);
+            if (slot < 0)
+            {
+                return static_cast<size_t>(std::ranges::count(it->second.offGridTimes, time));
+            }
+            return it->second.bookings[slot];
+        }
+
+        std::string AppointmentRepository::getSlotKey(const std::string &doctorID, const std::string &date)
+        {
+            return doctorID + Constants::FIELD_DELIMITER + date;
+        }
+
+        void AppointmentRepository::rebuildDateIndex()
+        {
+            m_dateIndex.clear();
+            for (const auto &a : m_appointments)
+            {
+                m_dateIndex.emplace(std::pair{a.getDateValue(), a.getTimeValue()}, a.getAppointmentID());
+            }
+        }
+
+        void AppointmentRepository::unindexByDate(const Model::Appointment &appointment)
+        {
+            auto [first, last] = m_dateIndex.equal_range({appointment.getDateValue(), appointment.getTimeValue()});
+            for (auto it = first; it != last; ++it)
+            {
+                if (it->second == appointment.getAppointmentID())
+                {
+                    m_dateIndex.erase(it);
+                    return;
+                }
+            }
+        }
+
+        std::vector<Model::Appointment> AppointmentRepository::collectByDateRange(
+            Date startDate, Date endDate) const
+        {
+            std::vector<Model::Appointment> results;
+            for (auto it = m_dateIndex.lower_bound({startDate, TimeOfDay::fromMinutes(0)});
+                 it != m_dateIndex.end() && it->first.first <= endDate; ++it)
+            {
+                results.push_back(m_appointments[m_idIndex.at(it->second)]);
+            }
+            return results;
+        }
+
+        // ==================== CRUD Operations ====================
+        std::vector<Model::Appointment> AppointmentRepository::getAll()
+        {
+            auto lock = lockForRead();
+            return m_appointments.items();
+        }
+
+        Snapshot<Model::Appointment> AppointmentRepository::getSnapshot() const
+        {
+            auto lock = lockForRead();
+            return m_appointments.snapshot();
+        }
+
+        ReadView<Model::Appointment> AppointmentRepository::view() const
+        {
+            auto lock = lockForRead();
+            return ReadView<Model::Appointment>(std::move(lock), m_appointments.items());
+        }
+
+        std::optional<Model::Appointment> AppointmentRepository::getById(const std::string &id)
+        {
+            auto lock = lockForRead();
+
+            auto it = findById(id);
 
             if (it != m_appointments.end())
             {
@@ -80,67 +346,202 @@ namespace HMS
 
         bool AppointmentRepository::add(const Model::Appointment &appointment)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
-            // Check if appointment ID already exists (inline for efficiency)
-            for (const auto &a : m_appointments)
+            // Check if appointment ID already exists
+            if (m_idIndex.contains(appointment.getAppointmentID()))
             {
-                if (a.getAppointmentID() == appointment.getAppointmentID())
-                {
-                    return false;
-                }
+                return false;
             }
 
+            m_idIndex.emplace(appointment.getAppointmentID(), m_appointments.size());
             m_appointments.push_back(appointment);
-            return saveInternal();
+            m_idSequence.observe(appointment.getAppointmentID());
+            indexByPatient(appointment);
+            bookSlot(appointment);
+            m_dateIndex.emplace(std::pair{appointment.getDateValue(), appointment.getTimeValue()},
+                                appointment.getAppointmentID());
+            return persistUpsert(appointment);
         }
 
         bool AppointmentRepository::update(const Model::Appointment &appointment)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
-            auto it = std::ranges::find_if(
-                m_appointments, [&appointment](const auto &a)
-                {
-                    return a.getAppointmentID() == appointment.getAppointmentID();
-                }
-            );
+            auto it = findById(appointment.getAppointmentID());
 
             if (it != m_appointments.end())
             {
+                // Patient, doctor, date, time or status may have changed
+                unindexByPatient(*it);
+                releaseSlot(*it);
+                unindexByDate(*it);
                 *it = appointment;
-                return saveInternal();
+                indexByPatient(appointment);
+                bookSlot(appointment);
+                m_dateIndex.emplace(std::pair{appointment.getDateValue(), appointment.getTimeValue()},
+                                    appointment.getAppointmentID());
+                return persistUpsert(appointment);
             }
             return false;
         }
 
         bool AppointmentRepository::remove(const std::string &id)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
-            auto it = std::ranges::find_if(
-                m_appointments, [&id](const auto &a)
-                {
-                    return a.getAppointmentID() == id;
-                }
-            );
+            auto it = findById(id);
 
             if (it == m_appointments.end())
             {
                 return false;
             }
 
+            unindexByPatient(*it);
+            releaseSlot(*it);
+            unindexByDate(*it);
+            const auto slot = static_cast<size_t>(it - m_appointments.begin());
             m_appointments.erase(it);
-            return saveInternal();
+            m_idIndex.erase(id);
+            rebuildIndex(slot);
+            return persistRemove(id);
+        }
+
+        bool AppointmentRepository::addRange(const std::vector<Model::Appointment> &appointments)
+        {
+            auto lock = lockForWrite();
+
+            // All or nothing: reject the batch if any ID is taken or repeated
+            std::unordered_set<std::string_view> batchIds;
+            batchIds.reserve(appointments.size());
+            for (const auto &appointment : appointments)
+            {
+                const std::string &id = appointment.getAppointmentID();
+                if (m_idIndex.contains(id) || !batchIds.insert(id).second)
+                {
+                    return false;
+                }
+            }
+
+            if (appointments.empty())
+            {
+                return true;
+            }
+
+            const size_t oldSize = m_appointments.size();
+            std::vector<Journal::Record> records;
+            records.reserve(appointments.size());
+            for (const auto &appointment : appointments)
+            {
+                m_idIndex.emplace(appointment.getAppointmentID(), m_appointments.size());
+                m_appointments.push_back(appointment);
+                m_idSequence.observe(appointment.getAppointmentID());
+                indexByPatient(appointment);
+                bookSlot(appointment);
+                m_dateIndex.emplace(std::pair{appointment.getDateValue(), appointment.getTimeValue()},
+                                    appointment.getAppointmentID());
+                records.push_back({Journal::Operation::UPSERT, appointment.serialize()});
+            }
+            if (!persistRecords(records))
+            {
+                rollbackRange(oldSize, {}, records.size());
+                return false;
+            }
+            return true;
+        }
+
+        bool AppointmentRepository::upsertRange(const std::vector<Model::Appointment> &appointments)
+        {
+            auto lock = lockForWrite();
+
+            if (appointments.empty())
+            {
+                return true;
+            }
+
+            const size_t oldSize = m_appointments.size();
+            std::vector<std::pair<size_t, Model::Appointment>> replaced;
+            std::vector<Journal::Record> records;
+            records.reserve(appointments.size());
+            for (const auto &appointment : appointments)
+            {
+                auto it = findById(appointment.getAppointmentID());
+                if (it != m_appointments.end())
+                {
+                    replaced.emplace_back(static_cast<size_t>(it - m_appointments.begin()), *it);
+                    unindexByPatient(*it);
+                    releaseSlot(*it);
+                    unindexByDate(*it);
+                    *it = appointment;
+                    indexByPatient(appointment);
+                    bookSlot(appointment);
+                    m_dateIndex.emplace(std::pair{appointment.getDateValue(), appointment.getTimeValue()},
+                                        appointment.getAppointmentID());
+                }
+                else
+                {
+                    m_idIndex.emplace(appointment.getAppointmentID(), m_appointments.size());
+                    m_appointments.push_back(appointment);
+                    m_idSequence.observe(appointment.getAppointmentID());
+                    indexByPatient(appointment);
+                    bookSlot(appointment);
+                    m_dateIndex.emplace(std::pair{appointment.getDateValue(), appointment.getTimeValue()},
+                                        appointment.getAppointmentID());
+                }
+                records.push_back({Journal::Operation::UPSERT, appointment.serialize()});
+            }
+            if (!persistRecords(records))
+            {
+                rollbackRange(oldSize, replaced, records.size());
+                return false;
+            }
+            return true;
+        }
+
+        void AppointmentRepository::rollbackRange(size_t oldSize,
+                                                  const std::vector<std::pair<size_t, Model::Appointment>> &replaced,
+                                                  size_t recordCount)
+        {
+            // Deferred records of the batch must not reach the file on a later flush
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.erase(m_pendingRecords.end() - static_cast<std::ptrdiff_t>(recordCount),
+                                           m_pendingRecords.end());
+                }
+                m_pendingChanges -= recordCount;
+            }
+
+            // Newest first, so a record replaced twice gets its original value back
+            for (auto it = replaced.rbegin(); it != replaced.rend(); ++it)
+            {
+                auto &stored = m_appointments[it->first];
+                unindexByPatient(stored);
+                releaseSlot(stored);
+                unindexByDate(stored);
+                stored = it->second;
+                indexByPatient(stored);
+                bookSlot(stored);
+                m_dateIndex.emplace(std::pair{stored.getDateValue(), stored.getTimeValue()},
+                                    stored.getAppointmentID());
+            }
+
+            auto &items = m_appointments.items();
+            for (size_t slot = oldSize; slot < items.size(); ++slot)
+            {
+                unindexByPatient(items[slot]);
+                releaseSlot(items[slot]);
+                unindexByDate(items[slot]);
+                m_idIndex.erase(items[slot].getAppointmentID());
+            }
+            items.erase(items.begin() + static_cast<std::ptrdiff_t>(oldSize), items.end());
         }
 
         // ==================== Persistence ====================
         bool AppointmentRepository::save()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
             return saveInternal();
         }
 
@@ -148,6 +549,9 @@ namespace HMS
         {
             try
             {
+                // A background snapshot may still be writing the same file
+                m_journal.waitForCompaction();
+
                 std::vector<std::string> lines;
 
                 // Add header
@@ -161,6 +565,7 @@ namespace HMS
                         lines.push_back(headerLine);
                     }
                 }
+                lines.push_back(m_idSequence.getHeaderLine());
 
                 // Add data
                 for (const auto &appointment : m_appointments)
@@ -168,8 +573,17 @@ namespace HMS
                     lines.push_back(appointment.serialize());
                 }
 
-                FileHelper::createBackup(m_filePath);
-                return FileHelper::writeLines(m_filePath, lines);
+                if (!FileHelper::writeLines(m_filePath, lines))
+                {
+                    return false;
+                }
+                BackupWorker::getInstance()->submit(m_filePath, std::move(lines));
+
+                // Snapshot now contains every journaled change
+                m_journal.truncate();
+                m_pendingRecords.clear();
+                m_pendingChanges = 0;
+                return true;
             }
             catch (...)
             {
@@ -177,9 +591,117 @@ namespace HMS
             }
         }
 
+        bool AppointmentRepository::persistUpsert(const Model::Appointment &appointment)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.push_back({Journal::Operation::UPSERT, appointment.serialize()});
+                }
+                return deferWrite(1);
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(Journal::Operation::UPSERT, appointment.serialize(),
+                                        m_appointments, "Appointment");
+            }
+            return saveInternal();
+        }
+
+        bool AppointmentRepository::persistRemove(const std::string &id)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.push_back({Journal::Operation::REMOVE, id});
+                }
+                return deferWrite(1);
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(Journal::Operation::REMOVE, id, m_appointments, "Appointment");
+            }
+            return saveInternal();
+        }
+
+        bool AppointmentRepository::persistRecords(const std::vector<Journal::Record> &records)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.insert(m_pendingRecords.end(), records.begin(), records.end());
+                }
+
+                // One write covers the whole batch; no other writer needs to join it
+                if (m_durability.mode == DurabilityPolicy::Mode::GROUP_COMMIT)
+                {
+                    m_pendingChanges += records.size();
+                    return flushPendingInternal();
+                }
+                return deferWrite(records.size());
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(records, m_appointments, "Appointment");
+            }
+            return saveInternal();
+        }
+
+        bool AppointmentRepository::deferWrite(size_t changes)
+        {
+            m_pendingChanges += changes;
+            if (m_durability.mode == DurabilityPolicy::Mode::GROUP_COMMIT)
+            {
+                // Releases the lock until a leader has written this change
+                return m_groupCommit.commit(m_dataMutex, [this]
+                                            { return flushPendingInternal(); });
+            }
+
+            if (m_pendingChanges >= m_durability.maxPendingChanges)
+            {
+                return flushPendingInternal();
+            }
+
+            // Keeps the deadline of the first change since the last flush
+            m_flushScheduled = true;
+            WriteBehindFlusher::getInstance()->schedule(this, m_durability.interval, [this]
+                                                        { flush(); });
+            return true;
+        }
+
+        bool AppointmentRepository::flushPendingInternal()
+        {
+            if (m_pendingChanges == 0)
+            {
+                return true;
+            }
+
+            if (!m_journalEnabled)
+            {
+                return saveInternal();
+            }
+
+            if (!m_journal.append(m_pendingRecords, m_appointments, "Appointment"))
+            {
+                return false;
+            }
+            m_pendingRecords.clear();
+            m_pendingChanges = 0;
+            return true;
+        }
+
         bool AppointmentRepository::load()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+
+            // Reloading replaces the records, so deferred changes are written first
+            flushPendingInternal();
             return loadInternal();
         }
 
@@ -198,19 +720,37 @@ namespace HMS
 
                 FileHelper::createFileIfNotExists(m_filePath);
 
-                std::vector<std::string> lines = FileHelper::readLines(m_filePath);
+                m_journal.waitForCompaction();
+                MappedFile file(m_filePath);
+                std::vector<std::string_view> lines = FileHelper::readLineViews(file);
 
-                m_appointments.clear();
+                // IDs are seeded once here; removed IDs stay behind the stored mark
+                m_idSequence.reset();
+                for (std::string_view headerLine : FileHelper::readHeaderLines(file))
+                {
+                    m_idSequence.restore(headerLine);
+                }
 
-                for (const auto &line : lines)
+                // Chunks are parsed concurrently and merged back in file order
+                m_appointments = parseLines<Model::Appointment>(lines, &Model::Appointment::deserialize);
+
+                // Replay mutations logged since the last snapshot. The journal is
+                // replayed even when journal mode is off so no logged change is lost.
+                m_journal.replay(
+                    m_appointments.items(), [](const auto &item)
+                    { return item.getAppointmentID(); },
+                    [this](const std::string &id)
+                    { m_idSequence.observe(id); });
+
+                for (const auto &appointment : m_appointments)
                 {
-                    auto appointment = Model::Appointment::deserialize(line);
-                    if (appointment)
-                    {
-                        m_appointments.push_back(appointment.value());
-                    }
+                    m_idSequence.observe(appointment.getAppointmentID());
                 }
 
+                rebuildIndex();
+                rebuildPatientIndex();
+                rebuildSlotIndex();
+                rebuildDateIndex();
                 m_isLoaded = true;
                 return true;
             }
@@ -221,123 +761,148 @@ namespace HMS
             }
         }
 
+        // ==================== Journal Mode ====================
+        void AppointmentRepository::setJournalEnabled(bool enabled)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            if (m_journalEnabled == enabled)
+            {
+                return;
+            }
+
+            // Deferred changes were recorded for the current mode
+            flushPendingInternal();
+
+            if (!enabled && m_isLoaded)
+            {
+                // Fold pending records into the data file before going back to full rewrites
+                saveInternal();
+            }
+
+            m_journalEnabled = enabled;
+        }
+
+        bool AppointmentRepository::isJournalEnabled() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_journalEnabled;
+        }
+
+        size_t AppointmentRepository::getJournalRecordCount() const
+        {
+            auto lock = lockForRead();
+            return m_journal.getRecordCount();
+        }
+
+        void AppointmentRepository::setCompactionPolicy(const Journal::CompactionPolicy &policy)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            m_journal.setCompactionPolicy(policy);
+        }
+
+        // ==================== Durability ====================
+        void AppointmentRepository::setDurabilityPolicy(const DurabilityPolicy &policy)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            flushPendingInternal();
+            m_durability = policy;
+        }
+
+        DurabilityPolicy AppointmentRepository::getDurabilityPolicy() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_durability;
+        }
+
+        bool AppointmentRepository::flush()
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            return flushPendingInternal();
+        }
+
+        size_t AppointmentRepository::getPendingChangeCount() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_pendingChanges;
+        }
+
         // ==================== Query Operations ====================
         size_t AppointmentRepository::count() const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
             return m_appointments.size();
         }
 
         bool AppointmentRepository::exists(const std::string &id) const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            return std::ranges::any_of(
-                m_appointments, [&id](const auto &a)
-                {
-                    return a.getAppointmentID() == id;
-                }
-            );
+            return m_idIndex.contains(id);
         }
 
         bool AppointmentRepository::clear()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
             m_appointments.clear();
+            m_idIndex.clear();
+            m_patientIndex.clear();
+            m_slotIndex.clear();
+            m_dateIndex.clear();
             m_isLoaded = true;
+            m_idSequence.reset();
             return saveInternal();
         }
 
         // ==================== Patient-Related Queries ====================
         std::vector<Model::Appointment> AppointmentRepository::getByPatient(const std::string &patientUsername)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
-
-            std::vector<Model::Appointment> results;
-            std::ranges::copy_if(
-                m_appointments, std::back_inserter(results),
-                [&patientUsername](const auto &a)
-                {
-                    return a.getPatientUsername() == patientUsername;
-                }
-            );
+            auto lock = lockForRead();
 
-            return results;
+            return collectByPatient(patientUsername);
         }
 
         std::vector<Model::Appointment> AppointmentRepository::getUpcomingByPatient(const std::string &patientUsername)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::string today = Utils::getCurrentDate();
-            std::vector<Model::Appointment> results;
 
-            std::ranges::copy_if(
-                m_appointments, std::back_inserter(results),
-                [&patientUsername, &today](const auto &a)
-                {
-                    return a.getPatientUsername() == patientUsername &&
-                           a.getStatus() == AppointmentStatus::SCHEDULED &&
-                           a.getDate() >= today;
-                }
-            );
-
-            // Sort by date and time
-            std::ranges::sort(results, [](const auto &a, const auto &b)
-            {
-                if (a.getDate() != b.getDate())
-                    return a.getDate() < b.getDate();
-                return a.getTime() < b.getTime();
-            });
+            // Patient index is already ordered by date and time
+            auto results = collectByPatient(patientUsername);
+            std::erase_if(results, [&today](const auto &a)
+                          {
+                              return a.getStatus() != AppointmentStatus::SCHEDULED ||
+                                     a.getDate() < today;
+                          });
 
             return results;
         }
 
         std::vector<Model::Appointment> AppointmentRepository::getHistoryByPatient(const std::string &patientUsername)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            std::vector<Model::Appointment> results;
-            std::ranges::copy_if(
-                m_appointments, std::back_inserter(results),
-                [&patientUsername](const auto &a)
-                {
-                    return a.getPatientUsername() == patientUsername &&
-                           (a.getStatus() == AppointmentStatus::COMPLETED ||
-                            a.getStatus() == AppointmentStatus::CANCELLED ||
-                            a.getStatus() == AppointmentStatus::NO_SHOW);
-                }
-            );
+            auto results = collectByPatient(patientUsername);
+            std::erase_if(results, [](const auto &a)
+                          {
+                              return a.getStatus() != AppointmentStatus::COMPLETED &&
+                                     a.getStatus() != AppointmentStatus::CANCELLED &&
+                                     a.getStatus() != AppointmentStatus::NO_SHOW;
+                          });
 
-            // Sort by date descending (most recent first)
-            std::ranges::sort(results, [](const auto &a, const auto &b)
-            {
-                if (a.getDate() != b.getDate())
-                    return a.getDate() > b.getDate();
-                return a.getTime() > b.getTime();
-            });
+            // Most recent first
+            std::ranges::reverse(results);
 
             return results;
         }
 
         std::vector<Model::Appointment> AppointmentRepository::getUnpaidByPatient(const std::string &patientUsername)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            std::vector<Model::Appointment> results;
-            std::ranges::copy_if(
-                m_appointments, std::back_inserter(results),
-                [&patientUsername](const auto &a)
-                {
-                    return a.getPatientUsername() == patientUsername && !a.isPaid();
-                }
-            );
+            auto results = collectByPatient(patientUsername);
+            std::erase_if(results, [](const auto &a)
+                          { return a.isPaid(); });
 
             return results;
         }
@@ -345,15 +910,20 @@ namespace HMS
         // ==================== Doctor-Related Queries ====================
         std::vector<Model::Appointment> AppointmentRepository::getByDoctor(const std::string &doctorID)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Appointment> results;
+            auto doctor = InternedString::lookup(doctorID);
+            if (!doctor)
+            {
+                return results;
+            }
+
             std::ranges::copy_if(
                 m_appointments, std::back_inserter(results),
-                [&doctorID](const auto &a)
+                [&doctor](const auto &a)
                 {
-                    return a.getDoctorID() == doctorID;
+                    return a.getDoctorHandle() == *doctor;
                 }
             );
 
@@ -363,15 +933,20 @@ namespace HMS
         std::vector<Model::Appointment> AppointmentRepository::getByDoctorAndDate(
             const std::string &doctorID, const std::string &date)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Appointment> results;
+            auto doctor = InternedString::lookup(doctorID);
+            if (!doctor)
+            {
+                return results;
+            }
+
             std::ranges::copy_if(
                 m_appointments, std::back_inserter(results),
-                [&doctorID, &date](const auto &a)
+                [&doctor, &date](const auto &a)
                 {
-                    return a.getDoctorID() == doctorID &&
+                    return a.getDoctorHandle() == *doctor &&
                            a.getDate() == date &&
                            a.getStatus() != AppointmentStatus::CANCELLED;
                 }
@@ -388,28 +963,31 @@ namespace HMS
 
         std::vector<Model::Appointment> AppointmentRepository::getUpcomingByDoctor(const std::string &doctorID)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            std::string today = Utils::getCurrentDate();
+            Date today = Date::parse(Utils::getCurrentDate()).value_or(Date{});
             std::vector<Model::Appointment> results;
+            auto doctor = InternedString::lookup(doctorID);
+            if (!doctor)
+            {
+                return results;
+            }
 
             std::ranges::copy_if(
                 m_appointments, std::back_inserter(results),
-                [&doctorID, &today](const auto &a)
+                [&doctor, &today](const auto &a)
                 {
-                    return a.getDoctorID() == doctorID &&
+                    return a.getDoctorHandle() == *doctor &&
                            a.getStatus() == AppointmentStatus::SCHEDULED &&
-                           a.getDate() >= today;
+                           a.getDateValue() >= today;
                 }
             );
 
             // Sort by date and time
             std::ranges::sort(results, [](const auto &a, const auto &b)
             {
-                if (a.getDate() != b.getDate())
-                    return a.getDate() < b.getDate();
-                return a.getTime() < b.getTime();
+                return std::pair{a.getDateValue(), a.getTimeValue()} <
+                       std::pair{b.getDateValue(), b.getTimeValue()};
             });
 
             return results;
@@ -418,51 +996,31 @@ namespace HMS
         // ==================== Date-Based Queries ====================
         std::vector<Model::Appointment> AppointmentRepository::getByDate(const std::string &date)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
-
-            std::vector<Model::Appointment> results;
-            std::ranges::copy_if(
-                m_appointments, std::back_inserter(results),
-                [&date](const auto &a)
-                {
-                    return a.getDate() == date;
-                }
-            );
+            auto lock = lockForRead();
 
-            // Sort by time
-            std::ranges::sort(results, [](const auto &a, const auto &b)
+            auto day = Date::parse(date);
+            if (!day)
             {
-                return a.getTime() < b.getTime();
-            });
+                return {};
+            }
 
-            return results;
+            // Date index is ordered by time within a day
+            return collectByDateRange(*day, *day);
         }
 
         std::vector<Model::Appointment> AppointmentRepository::getByDateRange(
             const std::string &startDate, const std::string &endDate)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            std::vector<Model::Appointment> results;
-            std::ranges::copy_if(
-                m_appointments, std::back_inserter(results),
-                [&startDate, &endDate](const auto &a)
-                {
-                    return a.getDate() >= startDate && a.getDate() <= endDate;
-                }
-            );
-
-            // Sort by date and time
-            std::ranges::sort(results, [](const auto &a, const auto &b)
+            auto start = Date::parse(startDate);
+            auto end = Date::parse(endDate);
+            if (!start || !end)
             {
-                if (a.getDate() != b.getDate())
-                    return a.getDate() < b.getDate();
-                return a.getTime() < b.getTime();
-            });
+                return {};
+            }
 
-            return results;
+            return collectByDateRange(*start, *end);
         }
 
         std::vector<Model::Appointment> AppointmentRepository::getToday()
@@ -473,8 +1031,7 @@ namespace HMS
         // ==================== Status-Based Queries ====================
         std::vector<Model::Appointment> AppointmentRepository::getByStatus(AppointmentStatus status)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Appointment> results;
             std::ranges::copy_if(
@@ -507,116 +1064,99 @@ namespace HMS
         bool AppointmentRepository::isSlotAvailable(
             const std::string &doctorID, const std::string &date, const std::string &time)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            return std::ranges::none_of(
-                m_appointments, [&doctorID, &date, &time](const auto &a)
-                {
-                    return a.getDoctorID() == doctorID &&
-                           a.getDate() == date &&
-                           a.getTime() == time &&
-                           a.getStatus() != AppointmentStatus::CANCELLED;
-                }
-            );
+            return countBookings(doctorID, date, time) == 0;
         }
 
         bool AppointmentRepository::isSlotAvailable(
             const std::string &doctorID, const std::string &date,
             const std::string &time, const std::string &excludeAppointmentID)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            return std::ranges::none_of(
-                m_appointments, [&doctorID, &date, &time, &excludeAppointmentID](const auto &a)
-                {
-                    return a.getDoctorID() == doctorID &&
-                           a.getDate() == date &&
-                           a.getTime() == time &&
-                           a.getAppointmentID() != excludeAppointmentID &&
-                           a.getStatus() != AppointmentStatus::CANCELLED;
-                }
-            );
+            size_t bookings = countBookings(doctorID, date, time);
+            if (bookings == 0)
+            {
+                return true;
+            }
+
+            // The excluded appointment may be the one holding this slot
+            auto it = findById(excludeAppointmentID);
+            if (it != m_appointments.end() &&
+                it->getDoctorID() == doctorID &&
+                it->getDate() == date &&
+                it->getTime() == time &&
+                it->getStatus() != AppointmentStatus::CANCELLED)
+            {
+                --bookings;
+            }
+            return bookings == 0;
         }
 
         std::vector<std::string> AppointmentRepository::getBookedSlots(
             const std::string &doctorID, const std::string &date)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<std::string> slots;
-            for (const auto &a : m_appointments)
+            auto it = m_slotIndex.find(getSlotKey(doctorID, date));
+            if (it == m_slotIndex.end())
             {
-                if (a.getDoctorID() == doctorID &&
-                    a.getDate() == date &&
-                    a.getStatus() != AppointmentStatus::CANCELLED)
-                {
-                    slots.push_back(a.getTime());
-                }
+                return slots;
             }
 
-            // Sort the slots
-            std::ranges::sort(slots);
-            return slots;
-        }
-
-        // ==================== ID Generation ====================
-        std::string AppointmentRepository::getNextId()
-        {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
-
-            if (m_appointments.empty())
+            const auto &day = it->second;
+            for (SlotMask mask = day.booked; mask != 0; mask &= mask - 1)
             {
-                return std::format("{}001", Constants::APPOINTMENT_ID_PREFIX);
+                int slot = std::countr_zero(mask);
+                slots.insert(slots.end(), day.bookings[slot], Utils::getSlotTime(slot));
             }
 
-            // Find max ID number
-            int maxID = 0;
-            const std::string prefix = Constants::APPOINTMENT_ID_PREFIX;
-
-            for (const auto &appointment : m_appointments)
+            if (!day.offGridTimes.empty())
             {
-                const std::string &appointmentID = appointment.getAppointmentID();
+                slots.insert(slots.end(), day.offGridTimes.begin(), day.offGridTimes.end());
+                std::ranges::sort(slots);
+            }
+            return slots;
+        }
 
-                // Only process valid format: prefix + digits
-                if (appointmentID.length() > prefix.length() &&
-                    appointmentID.starts_with(prefix))
-                {
-                    std::string numPart = appointmentID.substr(prefix.length());
+        SlotMask AppointmentRepository::getBookedSlotMask(const std::string &doctorID,
+                                                          const std::string &date)
+        {
+            auto lock = lockForRead();
 
-                    // Validate numeric before parsing
-                    if (Utils::isNumeric(numPart))
-                    {
-                        try
-                        {
-                            int idNum = std::stoi(numPart);
-                            maxID = std::max(maxID, idNum);
-                        }
-                        catch (const std::exception &)
-                        {
-                            // Ignore parse errors
-                        }
-                    }
-                }
-            }
+            auto it = m_slotIndex.find(getSlotKey(doctorID, date));
+            return it == m_slotIndex.end() ? 0 : it->second.booked;
+        }
 
-            return std::format("{}{:03d}", prefix, maxID + 1);
+        // ==================== ID Generation ====================
+        std::string AppointmentRepository::getNextId()
+        {
+            auto lock = lockForRead();
+            return m_idSequence.peek();
+        }
+
+        std::string AppointmentRepository::allocateId()
+        {
+            // Loading needs the lock; allocation itself is atomic
+            auto lock = lockForRead();
+            return m_idSequence.allocate();
         }
 
         // ==================== File Path Management ====================
         void AppointmentRepository::setFilePath(const std::string &filePath)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            flushPendingInternal();
             m_filePath = filePath;
+            m_journal.setDataFilePath(filePath);
             m_isLoaded = false;
         }
 
         std::string AppointmentRepository::getFilePath() const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
             return m_filePath;
         }
 
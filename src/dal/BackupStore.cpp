@@ -0,0 +1,388 @@
+#include "dal/BackupStore.h"
+#include "dal/FileHelper.h"
+#include "common/Constants.h"
+#include "common/Utils.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+#include <format>
+#include <iomanip>
+#include <sstream>
+#include <string_view>
+
+namespace fs = std::filesystem;
+
+namespace HMS
+{
+    namespace DAL
+    {
+        namespace
+        {
+            constexpr std::string_view BACKUP_MARKER = "_backup_";
+            constexpr std::int64_t MS_PER_HOUR = 60LL * 60 * 1000;
+            constexpr std::int64_t MS_PER_DAY = 24 * MS_PER_HOUR;
+
+            // 64-bit FNV-1a
+            std::uint64_t contentHash(std::string_view content)
+            {
+                std::uint64_t hash = 0xcbf29ce484222325ULL;
+                for (unsigned char c : content)
+                {
+                    hash ^= c;
+                    hash *= 0x100000001b3ULL;
+                }
+                return hash;
+            }
+
+            // Bucket number of a timestamp, rounding towards negative infinity
+            std::int64_t bucketOf(std::int64_t timestamp, std::int64_t width)
+            {
+                return timestamp >= 0 ? timestamp / width : (timestamp - width + 1) / width;
+            }
+
+            // Legacy copies are named <stem>_backup_<YYYYMMDD_HHMMSS><ext>, in local time
+            std::optional<std::int64_t> parseLegacyTimestamp(std::string_view stamp)
+            {
+                if (stamp.size() != 15)
+                    return std::nullopt;
+
+                std::tm tm{};
+                std::istringstream ss{std::string(stamp)};
+                ss >> std::get_time(&tm, "%Y%m%d_%H%M%S");
+                if (ss.fail())
+                    return std::nullopt;
+
+                tm.tm_isdst = -1;
+                std::time_t time = std::mktime(&tm);
+                if (time == -1)
+                    return std::nullopt;
+                return static_cast<std::int64_t>(time) * 1000;
+            }
+        }
+
+        // ==================== Constructor ====================
+        BackupStore::BackupStore(std::string directory, RetentionPolicy policy)
+            : m_directory(std::move(directory)), m_policy(policy), m_loaded(false) {}
+
+        // ==================== Singleton Access ====================
+        BackupStore *BackupStore::getInstance()
+        {
+            static BackupStore *store = new BackupStore(Constants::BACKUP_DIR);
+            return store;
+        }
+
+        std::int64_t BackupStore::now()
+        {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::system_clock::now().time_since_epoch())
+                .count();
+        }
+
+        RetentionPolicy BackupStore::defaultPolicy()
+        {
+            return RetentionPolicy{Constants::BACKUP_KEEP_LAST,
+                                   Constants::BACKUP_KEEP_HOURLY,
+                                   Constants::BACKUP_KEEP_DAILY};
+        }
+
+        // ==================== Backup / Restore ====================
+        bool BackupStore::backup(const std::string &filePath)
+        {
+            return backup(filePath, now());
+        }
+
+        bool BackupStore::backup(const std::string &filePath, std::int64_t timestamp)
+        {
+            auto content = FileHelper::readFile(filePath);
+            if (!content)
+                return false;
+
+            return backupContent(filePath, *content, timestamp);
+        }
+
+        bool BackupStore::backupContent(const std::string &filePath, const std::string &content,
+                                        std::int64_t timestamp)
+        {
+            const fs::path path(filePath);
+            const std::string source = path.filename().string();
+            const std::uint64_t hash = contentHash(content);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ensureLoaded();
+
+            // Unchanged since the latest backup: nothing new to record
+            auto latest = std::find_if(m_entries.rbegin(), m_entries.rend(),
+                                       [&source](const BackupEntry &e)
+                                       { return e.source == source; });
+            if (latest != m_entries.rend() && latest->hash == hash &&
+                objectHasContent(latest->object, content))
+                return true;
+
+            if (!FileHelper::createDirectoryIfNotExists(m_directory))
+                return false;
+
+            // Copies are shared by every backup with the same content; a copy
+            // with the same hash but other bytes is a collision, so try the next name
+            const std::string base = std::format("{}{}{:016x}", path.stem().string(), BACKUP_MARKER, hash);
+            const std::string extension = path.extension().string();
+            std::string object = base + extension;
+            for (int n = 1; FileHelper::fileExists(objectPath(object)) &&
+                            !objectHasContent(object, content);
+                 ++n)
+            {
+                object = std::format("{}-{}{}", base, n, extension);
+            }
+            if (!FileHelper::fileExists(objectPath(object)) &&
+                !FileHelper::writeFile(objectPath(object), content))
+            {
+                return false;
+            }
+
+            auto pos = std::upper_bound(m_entries.begin(), m_entries.end(), timestamp,
+                                        [](std::int64_t ts, const BackupEntry &e)
+                                        { return ts < e.timestamp; });
+            m_entries.insert(pos, BackupEntry{timestamp, source, hash, std::move(object)});
+
+            applyRetention(source);
+            return saveIndex();
+        }
+
+        bool BackupStore::restoreLatest(const std::string &filePath)
+        {
+            auto latest = getLatest(filePath);
+            if (!latest)
+                return false;
+
+            return FileHelper::copyFile(getObjectPath(*latest), filePath);
+        }
+
+        // ==================== Queries ====================
+        std::optional<BackupEntry> BackupStore::getLatest(const std::string &filePath)
+        {
+            const std::string source = fs::path(filePath).filename().string();
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ensureLoaded();
+
+            auto it = std::find_if(m_entries.rbegin(), m_entries.rend(),
+                                   [&source](const BackupEntry &e)
+                                   { return e.source == source; });
+            if (it == m_entries.rend())
+                return std::nullopt;
+            return *it;
+        }
+
+        std::vector<BackupEntry> BackupStore::getEntries(const std::string &filePath)
+        {
+            const std::string source = fs::path(filePath).filename().string();
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ensureLoaded();
+
+            std::vector<BackupEntry> result;
+            std::ranges::copy_if(m_entries, std::back_inserter(result),
+                                 [&source](const BackupEntry &e)
+                                 { return e.source == source; });
+            return result;
+        }
+
+        std::string BackupStore::getObjectPath(const BackupEntry &entry) const
+        {
+            return objectPath(entry.object);
+        }
+
+        // ==================== Configuration ====================
+        void BackupStore::setRetentionPolicy(const RetentionPolicy &policy)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_policy = policy;
+        }
+
+        RetentionPolicy BackupStore::getRetentionPolicy() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_policy;
+        }
+
+        // ==================== Private Helpers ====================
+        std::string BackupStore::indexPath() const
+        {
+            return (fs::path(m_directory) / Constants::BACKUP_INDEX_FILE).string();
+        }
+
+        std::string BackupStore::objectPath(const std::string &object) const
+        {
+            return (fs::path(m_directory) / object).string();
+        }
+
+        bool BackupStore::objectHasContent(const std::string &object, const std::string &content) const
+        {
+            // Size first, so a mismatch rarely needs the copy read back
+            std::error_code ec;
+            const auto size = fs::file_size(objectPath(object), ec);
+            if (ec || size != content.size())
+                return false;
+
+            auto stored = FileHelper::readFile(objectPath(object));
+            return stored && *stored == content;
+        }
+
+        void BackupStore::ensureLoaded()
+        {
+            if (m_loaded)
+                return;
+            m_loaded = true;
+
+            if (!FileHelper::fileExists(indexPath()))
+            {
+                adoptLegacyBackups();
+                return;
+            }
+
+            for (const auto &line : FileHelper::readLines(indexPath()))
+            {
+                std::array<std::string_view, 4> fields;
+                if (Utils::splitView(line, Constants::FIELD_DELIMITER, fields) != fields.size())
+                    continue;
+
+                BackupEntry entry{0, std::string(fields[1]), 0, std::string(fields[3])};
+                auto ts = std::from_chars(fields[0].data(), fields[0].data() + fields[0].size(),
+                                          entry.timestamp);
+                auto hash = std::from_chars(fields[2].data(), fields[2].data() + fields[2].size(),
+                                            entry.hash, 16);
+                if (ts.ec != std::errc() || hash.ec != std::errc() || entry.object.empty())
+                    continue;
+
+                m_entries.push_back(std::move(entry));
+            }
+
+            std::ranges::stable_sort(m_entries, {}, &BackupEntry::timestamp);
+        }
+
+        void BackupStore::adoptLegacyBackups()
+        {
+            // One-time scan so timestamped copies made before the index existed stay restorable
+            std::error_code ec;
+            if (!fs::is_directory(m_directory, ec))
+                return;
+
+            std::vector<std::string> sources;
+            for (const auto &file : fs::directory_iterator(m_directory, ec))
+            {
+                if (!file.is_regular_file())
+                    continue;
+
+                const std::string stem = file.path().stem().string();
+                const size_t marker = stem.rfind(BACKUP_MARKER);
+                if (marker == std::string::npos)
+                    continue;
+
+                auto timestamp = parseLegacyTimestamp(
+                    std::string_view(stem).substr(marker + BACKUP_MARKER.size()));
+                auto content = FileHelper::readFile(file.path().string());
+                if (!timestamp || !content)
+                    continue;
+
+                std::string source = stem.substr(0, marker) + file.path().extension().string();
+                sources.push_back(source);
+                m_entries.push_back(BackupEntry{*timestamp, std::move(source), contentHash(*content),
+                                                file.path().filename().string()});
+            }
+
+            if (m_entries.empty())
+                return;
+
+            std::ranges::stable_sort(m_entries, {}, &BackupEntry::timestamp);
+
+            std::ranges::sort(sources);
+            auto duplicates = std::ranges::unique(sources);
+            sources.erase(duplicates.begin(), duplicates.end());
+            for (const auto &source : sources)
+            {
+                applyRetention(source);
+            }
+            saveIndex();
+        }
+
+        bool BackupStore::saveIndex() const
+        {
+            std::vector<std::string> lines;
+            lines.reserve(m_entries.size() + 1);
+            lines.push_back("# Backup index: timestamp_ms|source|content_hash|object");
+            for (const auto &e : m_entries)
+            {
+                lines.push_back(std::format("{}|{}|{:016x}|{}", e.timestamp, e.source, e.hash, e.object));
+            }
+            return FileHelper::writeLines(indexPath(), lines);
+        }
+
+        void BackupStore::applyRetention(const std::string &source)
+        {
+            std::vector<size_t> positions;
+            for (size_t i = 0; i < m_entries.size(); ++i)
+            {
+                if (m_entries[i].source == source)
+                    positions.push_back(i);
+            }
+
+            const size_t count = positions.size();
+            std::vector<bool> keep(count, false);
+
+            for (size_t i = count - std::min(count, m_policy.keepLast); i < count; ++i)
+            {
+                keep[i] = true;
+            }
+
+            // Newest backup of each of the most recent `buckets` time buckets
+            auto keepNewestPerBucket = [&](std::int64_t width, size_t buckets)
+            {
+                size_t seen = 0;
+                std::optional<std::int64_t> current;
+                for (size_t i = count; i-- > 0;)
+                {
+                    std::int64_t bucket = bucketOf(m_entries[positions[i]].timestamp, width);
+                    if (current == bucket)
+                        continue;
+                    if (seen == buckets)
+                        break;
+                    current = bucket;
+                    keep[i] = true;
+                    ++seen;
+                }
+            };
+            keepNewestPerBucket(MS_PER_HOUR, m_policy.keepHourly);
+            keepNewestPerBucket(MS_PER_DAY, m_policy.keepDaily);
+
+            std::vector<std::string> released;
+            for (size_t i = count; i-- > 0;)
+            {
+                if (!keep[i])
+                {
+                    released.push_back(m_entries[positions[i]].object);
+                    m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(positions[i]));
+                }
+            }
+
+            removeUnreferencedObjects(released);
+        }
+
+        void BackupStore::removeUnreferencedObjects(const std::vector<std::string> &candidates)
+        {
+            for (const auto &object : candidates)
+            {
+                bool referenced = std::ranges::any_of(m_entries, [&object](const BackupEntry &e)
+                                                      { return e.object == object; });
+                if (!referenced)
+                {
+                    std::error_code ec;
+                    fs::remove(objectPath(object), ec);
+                }
+            }
+        }
+
+    } // namespace DAL
+} // namespace HMS
@@ -0,0 +1,192 @@
+#include "dal/BackupWorker.h"
+#include "dal/BackupStore.h"
+#include "dal/FileHelper.h"
+#include "common/Constants.h"
+
+#include <algorithm>
+
+namespace HMS
+{
+    namespace DAL
+    {
+        // ==================== Static Members Initialization ====================
+        BackupWorker *BackupWorker::s_instance = nullptr;
+        std::mutex BackupWorker::s_mutex;
+
+        // ==================== Private Constructor ====================
+        BackupWorker::BackupWorker()
+            : m_interval(std::chrono::seconds(Constants::BACKUP_INTERVAL_SECONDS)),
+              m_busy(false), m_flushRequested(false), m_stopping(false)
+        {
+            m_thread = std::thread(&BackupWorker::run, this);
+        }
+
+        // ==================== Singleton Access ====================
+        BackupWorker *BackupWorker::getInstance()
+        {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            if (!s_instance)
+            {
+                s_instance = new BackupWorker();
+            }
+            return s_instance;
+        }
+
+        void BackupWorker::resetInstance()
+        {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            delete s_instance;
+            s_instance = nullptr;
+        }
+
+        // ==================== Destructor ====================
+        BackupWorker::~BackupWorker()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_queueMutex);
+                m_stopping = true;
+            }
+            m_wake.notify_all();
+
+            if (m_thread.joinable())
+            {
+                m_thread.join();
+            }
+        }
+
+        // ==================== Backup Requests ====================
+        void BackupWorker::submit(const std::string &filePath, std::vector<std::string> lines)
+        {
+            if (FileHelper::isTestFixture(filePath))
+            {
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_queueMutex);
+                m_pending[filePath] = PendingBackup{std::move(lines), BackupStore::now()};
+            }
+            m_wake.notify_one();
+        }
+
+        void BackupWorker::flush()
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            if (m_pending.empty() && !m_busy)
+            {
+                return;
+            }
+
+            m_flushRequested = true;
+            m_wake.notify_one();
+            m_idle.wait(lock, [this]
+                        { return m_pending.empty() && !m_busy; });
+        }
+
+        size_t BackupWorker::getPendingCount() const
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            return m_pending.size() + (m_busy ? 1 : 0);
+        }
+
+        // ==================== Configuration ====================
+        void BackupWorker::setInterval(std::chrono::milliseconds interval)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_queueMutex);
+                m_interval = interval;
+            }
+            m_wake.notify_one();
+        }
+
+        std::chrono::milliseconds BackupWorker::getInterval() const
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            return m_interval;
+        }
+
+        // ==================== Worker Loop ====================
+        void BackupWorker::run()
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            while (true)
+            {
+                if (m_pending.empty())
+                {
+                    m_flushRequested = false;
+                    m_idle.notify_all();
+
+                    // Pending backups are written before stopping so none is lost
+                    if (m_stopping)
+                    {
+                        break;
+                    }
+                    m_wake.wait(lock);
+                    continue;
+                }
+
+                // Pick a file whose interval has elapsed, or the time the next one will
+                const auto now = Clock::now();
+                auto due = m_pending.end();
+                auto nextDue = Clock::time_point::max();
+                for (auto it = m_pending.begin(); it != m_pending.end(); ++it)
+                {
+                    auto last = m_lastBackup.find(it->first);
+                    auto ready = last == m_lastBackup.end() ? now : last->second + m_interval;
+                    if (ready <= now || m_flushRequested || m_stopping)
+                    {
+                        due = it;
+                        break;
+                    }
+                    nextDue = std::min(nextDue, ready);
+                }
+
+                if (due == m_pending.end())
+                {
+                    m_wake.wait_until(lock, nextDue);
+                    continue;
+                }
+
+                std::string filePath = due->first;
+                PendingBackup pending = std::move(due->second);
+                m_pending.erase(due);
+                m_lastBackup[filePath] = now;
+                m_busy = true;
+
+                lock.unlock();
+                try
+                {
+                    writeBackup(filePath, pending);
+                }
+                catch (...)
+                {
+                    // A failed backup leaves the data file itself untouched
+                }
+                lock.lock();
+
+                m_busy = false;
+            }
+        }
+
+        void BackupWorker::writeBackup(const std::string &filePath, const PendingBackup &pending)
+        {
+            // Same bytes FileHelper::writeLines put in the data file
+            size_t size = 0;
+            for (const auto &line : pending.lines)
+            {
+                size += line.size() + 1;
+            }
+
+            std::string content;
+            content.reserve(size);
+            for (const auto &line : pending.lines)
+            {
+                content += line;
+                content += '\n';
+            }
+
+            BackupStore::getInstance()->backupContent(filePath, content, pending.timestamp);
+        }
+
+    } // namespace DAL
+} // namespace HMS
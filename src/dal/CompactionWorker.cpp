@@ -0,0 +1,112 @@
+#include "dal/CompactionWorker.h"
+
+namespace HMS
+{
+    namespace DAL
+    {
+        // ==================== Static Members Initialization ====================
+        std::unique_ptr<CompactionWorker> CompactionWorker::s_instance = nullptr;
+        std::mutex CompactionWorker::s_mutex;
+
+        // ==================== Private Constructor ====================
+        CompactionWorker::CompactionWorker()
+            : m_busy(false), m_stopping(false)
+        {
+            m_thread = std::thread(&CompactionWorker::run, this);
+        }
+
+        // ==================== Singleton Access ====================
+        CompactionWorker *CompactionWorker::getInstance()
+        {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            if (!s_instance)
+            {
+                s_instance = std::unique_ptr<CompactionWorker>(new CompactionWorker());
+            }
+            return s_instance.get();
+        }
+
+        void CompactionWorker::resetInstance()
+        {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            s_instance.reset();
+        }
+
+        // ==================== Destructor ====================
+        CompactionWorker::~CompactionWorker()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_queueMutex);
+                m_stopping = true;
+            }
+            m_taskAvailable.notify_all();
+
+            if (m_thread.joinable())
+            {
+                m_thread.join();
+            }
+        }
+
+        // ==================== Task Management ====================
+        void CompactionWorker::submit(std::function<void()> task)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_queueMutex);
+                m_tasks.push_back(std::move(task));
+            }
+            m_taskAvailable.notify_one();
+        }
+
+        void CompactionWorker::waitIdle()
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_idle.wait(lock, [this]
+                        { return m_tasks.empty() && !m_busy; });
+        }
+
+        size_t CompactionWorker::getPendingCount() const
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            return m_tasks.size() + (m_busy ? 1 : 0);
+        }
+
+        // ==================== Worker Loop ====================
+        void CompactionWorker::run()
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            while (true)
+            {
+                m_taskAvailable.wait(lock, [this]
+                                     { return m_stopping || !m_tasks.empty(); });
+
+                // Drain remaining work before stopping so no snapshot is lost
+                if (m_tasks.empty())
+                {
+                    break;
+                }
+
+                auto task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+                m_busy = true;
+
+                lock.unlock();
+                try
+                {
+                    task();
+                }
+                catch (...)
+                {
+                    // A failed compaction leaves the journal in place; replay still works
+                }
+                lock.lock();
+
+                m_busy = false;
+                if (m_tasks.empty())
+                {
+                    m_idle.notify_all();
+                }
+            }
+        }
+
+    } // namespace DAL
+} // namespace HMS
@@ -0,0 +1,70 @@
+#include "dal/DataSnapshot.h"
+#include "dal/AppointmentRepository.h"
+#include "dal/DoctorRepository.h"
+#include "dal/MedicineRepository.h"
+#include "dal/PatientRepository.h"
+#include "dal/PrescriptionRepository.h"
+
+#include <shared_mutex>
+#include <vector>
+
+namespace HMS
+{
+    namespace DAL
+    {
+
+        DataSnapshot DataSnapshot::capture(unsigned sources)
+        {
+            PatientRepository *patientRepo = PatientRepository::getInstance();
+            DoctorRepository *doctorRepo = DoctorRepository::getInstance();
+            AppointmentRepository *appointmentRepo = AppointmentRepository::getInstance();
+            MedicineRepository *medicineRepo = MedicineRepository::getInstance();
+            PrescriptionRepository *prescriptionRepo = PrescriptionRepository::getInstance();
+
+            // Loading needs each repository's exclusive lock, so do it up front
+            if (sources & PATIENTS)
+                patientRepo->lockForRead();
+            if (sources & DOCTORS)
+                doctorRepo->lockForRead();
+            if (sources & APPOINTMENTS)
+                appointmentRepo->lockForRead();
+            if (sources & MEDICINES)
+                medicineRepo->lockForRead();
+            if (sources & PRESCRIPTIONS)
+                prescriptionRepo->lockForRead();
+
+            // Fixed lock order (see Source) keeps this deadlock-free
+            std::vector<std::shared_lock<std::shared_mutex>> locks;
+            DataSnapshot snapshot;
+
+            if (sources & PATIENTS)
+            {
+                locks.emplace_back(patientRepo->m_dataMutex);
+                snapshot.patients = patientRepo->m_patients.snapshot();
+            }
+            if (sources & DOCTORS)
+            {
+                locks.emplace_back(doctorRepo->m_dataMutex);
+                snapshot.doctors = doctorRepo->m_doctors.snapshot();
+            }
+            if (sources & APPOINTMENTS)
+            {
+                locks.emplace_back(appointmentRepo->m_dataMutex);
+                snapshot.appointments = appointmentRepo->m_appointments.snapshot();
+            }
+            if (sources & MEDICINES)
+            {
+                locks.emplace_back(medicineRepo->m_dataMutex);
+                snapshot.medicines = medicineRepo->m_medicines.snapshot();
+            }
+            if (sources & PRESCRIPTIONS)
+            {
+                locks.emplace_back(prescriptionRepo->m_dataMutex);
+                snapshot.prescriptions = prescriptionRepo->m_prescriptions.snapshot();
+            }
+
+            return snapshot;
+        }
+
+    } // namespace DAL
+} // namespace HMS
@@ -2,11 +2,15 @@
 #include "common/Constants.h"
 #include "common/Utils.h"
 #include "dal/FileHelper.h"
+#include "dal/IdSequence.h"
+#include "dal/BackupWorker.h"
+#include "dal/LineParser.h"
 
 #include <algorithm>
 #include <filesystem>
 #include <format>
 #include <sstream>
+#include <unordered_set>
 
 namespace HMS
 {
@@ -19,8 +23,14 @@ namespace HMS
         // ==================== Private Constructor ====================
         DepartmentRepository::DepartmentRepository()
             : m_filePath(Constants::DEPARTMENT_FILE),
-              m_isLoaded(false)
+              m_isLoaded(false),
+              m_idSequence(Constants::DEPARTMENT_ID_PREFIX),
+              m_journal(Constants::DEPARTMENT_FILE), m_journalEnabled(false),
+              m_pendingChanges(0), m_flushScheduled(false)
         {
+            // Snapshots written in the background must keep the sequence too
+            m_journal.setSnapshotHeader([this]
+                                        { return m_idSequence.getHeaderLine(); });
         }
 
         // ==================== Singleton Access ====================
@@ -41,7 +51,15 @@ namespace HMS
         }
 
         // ==================== Destructor ====================
-        DepartmentRepository::~DepartmentRepository() = default;
+        DepartmentRepository::~DepartmentRepository()
+        {
+            // Write-behind changes must not be lost with the instance
+            if (m_flushScheduled)
+            {
+                WriteBehindFlusher::getInstance()->cancel(this);
+            }
+            flushPendingInternal();
+        }
 
         // ==================== Private Helper ====================
         void DepartmentRepository::ensureLoaded() const
@@ -52,22 +70,78 @@ namespace HMS
             }
         }
 
+        std::shared_lock<std::shared_mutex> DepartmentRepository::lockForRead() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            if (!m_isLoaded)
+            {
+                // Loading mutates the repository, so it runs under the exclusive lock
+                lock.unlock();
+                {
+                    std::lock_guard<std::shared_mutex> writeLock(m_dataMutex);
+                    ensureLoaded();
+                }
+                lock.lock();
+            }
+            return lock;
+        }
+
+        std::unique_lock<std::shared_mutex> DepartmentRepository::lockForWrite()
+        {
+            std::unique_lock<std::shared_mutex> lock(m_dataMutex);
+            ensureLoaded();
+            m_departments.detach();
+            return lock;
+        }
+
+        void DepartmentRepository::rebuildIndex(size_t from)
+        {
+            if (from == 0)
+            {
+                m_idIndex.clear();
+                m_idIndex.reserve(m_departments.size());
+            }
+
+            for (size_t i = from; i < m_departments.size(); ++i)
+            {
+                m_idIndex[m_departments[i].getDepartmentID()] = i;
+            }
+        }
+
+        std::vector<Model::Department>::iterator DepartmentRepository::findById(const std::string &id)
+        {
+            auto it = m_idIndex.find(id);
+            if (it == m_idIndex.end())
+            {
+                return m_departments.end();
+            }
+            return m_departments.begin() + static_cast<std::ptrdiff_t>(it->second);
+        }
+
         // ==================== CRUD Operations ====================
         std::vector<Model::Department> DepartmentRepository::getAll()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
-            return m_departments;
+            auto lock = lockForRead();
+            return m_departments.items();
+        }
+
+        Snapshot<Model::Department> DepartmentRepository::getSnapshot() const
+        {
+            auto lock = lockForRead();
+            return m_departments.snapshot();
+        }
+
+        ReadView<Model::Department> DepartmentRepository::view() const
+        {
+            auto lock = lockForRead();
+            return ReadView<Model::Department>(std::move(lock), m_departments.items());
         }
 
         std::optional<Model::Department> DepartmentRepository::getById(const std::string &id)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            auto it = std::ranges::find_if(
-                m_departments, [&id](const auto &d)
-                { return d.getDepartmentID() == id; });
+            auto it = findById(id);
 
             if (it != m_departments.end())
             {
@@ -78,62 +152,163 @@ namespace HMS
 
         bool DepartmentRepository::add(const Model::Department &department)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
             // Check if department ID already exists
-            bool exists = std::ranges::any_of(
-                m_departments, [&department](const auto &d)
-                { return d.getDepartmentID() == department.getDepartmentID(); });
+            bool exists = m_idIndex.contains(department.getDepartmentID());
 
             if (exists)
             {
                 return false;
             }
 
+            m_idIndex.emplace(department.getDepartmentID(), m_departments.size());
             m_departments.push_back(department);
-            return saveInternal();
+            m_idSequence.observe(department.getDepartmentID());
+            return persistUpsert(department);
         }
 
         bool DepartmentRepository::update(const Model::Department &department)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
-            auto it = std::ranges::find_if(
-                m_departments, [&department](const auto &d)
-                { return d.getDepartmentID() == department.getDepartmentID(); });
+            auto it = findById(department.getDepartmentID());
 
             if (it != m_departments.end())
             {
                 *it = department;
-                return saveInternal();
+                return persistUpsert(department);
             }
             return false;
         }
 
         bool DepartmentRepository::remove(const std::string &id)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
-            auto it = std::ranges::find_if(
-                m_departments, [&id](const auto &d)
-                { return d.getDepartmentID() == id; });
+            auto it = findById(id);
 
             if (it == m_departments.end())
             {
                 return false;
             }
 
+            const auto slot = static_cast<size_t>(it - m_departments.begin());
             m_departments.erase(it);
-            return saveInternal();
+            m_idIndex.erase(id);
+            rebuildIndex(slot);
+            return persistRemove(id);
+        }
+
+        bool DepartmentRepository::addRange(const std::vector<Model::Department> &departments)
+        {
+            auto lock = lockForWrite();
+
+            // All or nothing: reject the batch if any ID is taken or repeated
+            std::unordered_set<std::string_view> batchIds;
+            batchIds.reserve(departments.size());
+            for (const auto &department : departments)
+            {
+                const std::string &id = department.getDepartmentID();
+                if (m_idIndex.contains(id) || !batchIds.insert(id).second)
+                {
+                    return false;
+                }
+            }
+
+            if (departments.empty())
+            {
+                return true;
+            }
+
+            const size_t oldSize = m_departments.size();
+            std::vector<Journal::Record> records;
+            records.reserve(departments.size());
+            for (const auto &department : departments)
+            {
+                m_idIndex.emplace(department.getDepartmentID(), m_departments.size());
+                m_departments.push_back(department);
+                m_idSequence.observe(department.getDepartmentID());
+                records.push_back({Journal::Operation::UPSERT, department.serialize()});
+            }
+            if (!persistRecords(records))
+            {
+                rollbackRange(oldSize, {}, records.size());
+                return false;
+            }
+            return true;
+        }
+
+        bool DepartmentRepository::upsertRange(const std::vector<Model::Department> &departments)
+        {
+            auto lock = lockForWrite();
+
+            if (departments.empty())
+            {
+                return true;
+            }
+
+            const size_t oldSize = m_departments.size();
+            std::vector<std::pair<size_t, Model::Department>> replaced;
+            std::vector<Journal::Record> records;
+            records.reserve(departments.size());
+            for (const auto &department : departments)
+            {
+                auto it = findById(department.getDepartmentID());
+                if (it != m_departments.end())
+                {
+                    replaced.emplace_back(static_cast<size_t>(it - m_departments.begin()), *it);
+                    *it = department;
+                }
+                else
+                {
+                    m_idIndex.emplace(department.getDepartmentID(), m_departments.size());
+                    m_departments.push_back(department);
+                    m_idSequence.observe(department.getDepartmentID());
+                }
+                records.push_back({Journal::Operation::UPSERT, department.serialize()});
+            }
+            if (!persistRecords(records))
+            {
+                rollbackRange(oldSize, replaced, records.size());
+                return false;
+            }
+            return true;
+        }
+
+        void DepartmentRepository::rollbackRange(size_t oldSize,
+                                                 const std::vector<std::pair<size_t, Model::Department>> &replaced,
+                                                 size_t recordCount)
+        {
+            // Deferred records of the batch must not reach the file on a later flush
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.erase(m_pendingRecords.end() - static_cast<std::ptrdiff_t>(recordCount),
+                                           m_pendingRecords.end());
+                }
+                m_pendingChanges -= recordCount;
+            }
+
+            // Newest first, so a record replaced twice gets its original value back
+            for (auto it = replaced.rbegin(); it != replaced.rend(); ++it)
+            {
+                m_departments[it->first] = it->second;
+            }
+
+            auto &items = m_departments.items();
+            for (size_t slot = oldSize; slot < items.size(); ++slot)
+            {
+                m_idIndex.erase(items[slot].getDepartmentID());
+            }
+            items.erase(items.begin() + static_cast<std::ptrdiff_t>(oldSize), items.end());
         }
 
         // ==================== Persistence ====================
         bool DepartmentRepository::save()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
             return saveInternal();
         }
 
@@ -141,6 +316,9 @@ namespace HMS
         {
             try
             {
+                // A background snapshot may still be writing the same file
+                m_journal.waitForCompaction();
+
                 std::vector<std::string> lines;
 
                 // Add header
@@ -154,6 +332,7 @@ namespace HMS
                         lines.push_back(headerLine);
                     }
                 }
+                lines.push_back(m_idSequence.getHeaderLine());
 
                 // Add data
                 for (const auto &department : m_departments)
@@ -161,8 +340,17 @@ namespace HMS
                     lines.push_back(department.serialize());
                 }
 
-                FileHelper::createBackup(m_filePath);
-                return FileHelper::writeLines(m_filePath, lines);
+                if (!FileHelper::writeLines(m_filePath, lines))
+                {
+                    return false;
+                }
+                BackupWorker::getInstance()->submit(m_filePath, std::move(lines));
+
+                // Snapshot now contains every journaled change
+                m_journal.truncate();
+                m_pendingRecords.clear();
+                m_pendingChanges = 0;
+                return true;
             }
             catch (...)
             {
@@ -170,9 +358,117 @@ namespace HMS
             }
         }
 
+        bool DepartmentRepository::persistUpsert(const Model::Department &department)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.push_back({Journal::Operation::UPSERT, department.serialize()});
+                }
+                return deferWrite(1);
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(Journal::Operation::UPSERT, department.serialize(),
+                                        m_departments, "Department");
+            }
+            return saveInternal();
+        }
+
+        bool DepartmentRepository::persistRemove(const std::string &id)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.push_back({Journal::Operation::REMOVE, id});
+                }
+                return deferWrite(1);
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(Journal::Operation::REMOVE, id, m_departments, "Department");
+            }
+            return saveInternal();
+        }
+
+        bool DepartmentRepository::persistRecords(const std::vector<Journal::Record> &records)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.insert(m_pendingRecords.end(), records.begin(), records.end());
+                }
+
+                // One write covers the whole batch; no other writer needs to join it
+                if (m_durability.mode == DurabilityPolicy::Mode::GROUP_COMMIT)
+                {
+                    m_pendingChanges += records.size();
+                    return flushPendingInternal();
+                }
+                return deferWrite(records.size());
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(records, m_departments, "Department");
+            }
+            return saveInternal();
+        }
+
+        bool DepartmentRepository::deferWrite(size_t changes)
+        {
+            m_pendingChanges += changes;
+            if (m_durability.mode == DurabilityPolicy::Mode::GROUP_COMMIT)
+            {
+                // Releases the lock until a leader has written this change
+                return m_groupCommit.commit(m_dataMutex, [this]
+                                            { return flushPendingInternal(); });
+            }
+
+            if (m_pendingChanges >= m_durability.maxPendingChanges)
+            {
+                return flushPendingInternal();
+            }
+
+            // Keeps the deadline of the first change since the last flush
+            m_flushScheduled = true;
+            WriteBehindFlusher::getInstance()->schedule(this, m_durability.interval, [this]
+                                                        { flush(); });
+            return true;
+        }
+
+        bool DepartmentRepository::flushPendingInternal()
+        {
+            if (m_pendingChanges == 0)
+            {
+                return true;
+            }
+
+            if (!m_journalEnabled)
+            {
+                return saveInternal();
+            }
+
+            if (!m_journal.append(m_pendingRecords, m_departments, "Department"))
+            {
+                return false;
+            }
+            m_pendingRecords.clear();
+            m_pendingChanges = 0;
+            return true;
+        }
+
         bool DepartmentRepository::load()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+
+            // Reloading replaces the records, so deferred changes are written first
+            flushPendingInternal();
             return loadInternal();
         }
 
@@ -191,19 +487,34 @@ namespace HMS
 
                 FileHelper::createFileIfNotExists(m_filePath);
 
-                std::vector<std::string> lines = FileHelper::readLines(m_filePath);
+                m_journal.waitForCompaction();
+                MappedFile file(m_filePath);
+                std::vector<std::string_view> lines = FileHelper::readLineViews(file);
 
-                m_departments.clear();
+                // IDs are seeded once here; removed IDs stay behind the stored mark
+                m_idSequence.reset();
+                for (std::string_view headerLine : FileHelper::readHeaderLines(file))
+                {
+                    m_idSequence.restore(headerLine);
+                }
+
+                // Chunks are parsed concurrently and merged back in file order
+                m_departments = parseLines<Model::Department>(lines, &Model::Department::deserialize);
+
+                // Replay mutations logged since the last snapshot. The journal is
+                // replayed even when journal mode is off so no logged change is lost.
+                m_journal.replay(
+                    m_departments.items(), [](const auto &item)
+                    { return item.getDepartmentID(); },
+                    [this](const std::string &id)
+                    { m_idSequence.observe(id); });
 
-                for (const auto &line : lines)
+                for (const auto &department : m_departments)
                 {
-                    auto department = Model::Department::deserialize(line);
-                    if (department)
-                    {
-                        m_departments.push_back(department.value());
-                    }
+                    m_idSequence.observe(department.getDepartmentID());
                 }
 
+                rebuildIndex();
                 m_isLoaded = true;
                 return true;
             }
@@ -214,37 +525,99 @@ namespace HMS
             }
         }
 
+        // ==================== Journal Mode ====================
+        void DepartmentRepository::setJournalEnabled(bool enabled)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            if (m_journalEnabled == enabled)
+            {
+                return;
+            }
+
+            // Deferred changes were recorded for the current mode
+            flushPendingInternal();
+
+            if (!enabled && m_isLoaded)
+            {
+                // Fold pending records into the data file before going back to full rewrites
+                saveInternal();
+            }
+
+            m_journalEnabled = enabled;
+        }
+
+        bool DepartmentRepository::isJournalEnabled() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_journalEnabled;
+        }
+
+        size_t DepartmentRepository::getJournalRecordCount() const
+        {
+            auto lock = lockForRead();
+            return m_journal.getRecordCount();
+        }
+
+        void DepartmentRepository::setCompactionPolicy(const Journal::CompactionPolicy &policy)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            m_journal.setCompactionPolicy(policy);
+        }
+
+        // ==================== Durability ====================
+        void DepartmentRepository::setDurabilityPolicy(const DurabilityPolicy &policy)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            flushPendingInternal();
+            m_durability = policy;
+        }
+
+        DurabilityPolicy DepartmentRepository::getDurabilityPolicy() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_durability;
+        }
+
+        bool DepartmentRepository::flush()
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            return flushPendingInternal();
+        }
+
+        size_t DepartmentRepository::getPendingChangeCount() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_pendingChanges;
+        }
+
         // ==================== Query Operations ====================
         size_t DepartmentRepository::count() const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
             return m_departments.size();
         }
 
         bool DepartmentRepository::exists(const std::string &id) const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            return std::ranges::any_of(
-                m_departments, [&id](const auto &d)
-                { return d.getDepartmentID() == id; });
+            return m_idIndex.contains(id);
         }
 
         bool DepartmentRepository::clear()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
             m_departments.clear();
+            m_idIndex.clear();
             m_isLoaded = true;
+            m_idSequence.reset();
             return saveInternal();
         }
 
         // ==================== Department-Specific Queries ====================
         std::optional<Model::Department> DepartmentRepository::getByName(const std::string &name)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             auto it = std::ranges::find_if(
                 m_departments, [&name](const auto &d)
@@ -264,8 +637,7 @@ namespace HMS
 
         std::optional<Model::Department> DepartmentRepository::getByHeadDoctor(const std::string &doctorID)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             auto it = std::ranges::find_if(
                 m_departments, [&doctorID](const auto &d)
@@ -280,8 +652,7 @@ namespace HMS
 
         std::optional<Model::Department> DepartmentRepository::getDepartmentByDoctor(const std::string &doctorID)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             for (const auto &d : m_departments)
             {
@@ -296,8 +667,7 @@ namespace HMS
 
         std::vector<Model::Department> DepartmentRepository::getDepartmentsByDoctor(const std::string &doctorID)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Department> results;
             for (const auto &d : m_departments)
@@ -313,8 +683,7 @@ namespace HMS
 
         std::vector<Model::Department> DepartmentRepository::searchByName(const std::string &name)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Department> results;
             std::ranges::copy_if(
@@ -329,8 +698,7 @@ namespace HMS
 
         std::vector<std::string> DepartmentRepository::getAllNames()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<std::string> names;
             names.reserve(m_departments.size());
@@ -343,58 +711,30 @@ namespace HMS
 
         std::string DepartmentRepository::getNextId()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
-
-            if (m_departments.empty())
-            {
-                return std::format("{}001", Constants::DEPARTMENT_ID_PREFIX);
-            }
-
-            // Find max ID number
-            int maxID = 0;
-            const std::string prefix = Constants::DEPARTMENT_ID_PREFIX;
-
-            for (const auto &department : m_departments)
-            {
-                const std::string &departmentID = department.getDepartmentID();
-
-                // Only process valid format: prefix + digits
-                if (departmentID.length() > prefix.length() &&
-                    departmentID.starts_with(prefix))
-                {
-                    std::string numPart = departmentID.substr(prefix.length());
-
-                    // Validate numeric before parsing
-                    if (Utils::isNumeric(numPart))
-                    {
-                        try
-                        {
-                            int idNum = std::stoi(numPart);
-                            maxID = std::max(maxID, idNum);
-                        }
-                        catch (const std::exception &)
-                        {
-                            // Ignore parse errors
-                        }
-                    }
-                }
-            }
+            auto lock = lockForRead();
+            return m_idSequence.peek();
+        }
 
-            return std::format("{}{:03d}", prefix, maxID + 1);
+        std::string DepartmentRepository::allocateId()
+        {
+            // Loading needs the lock; allocation itself is atomic
+            auto lock = lockForRead();
+            return m_idSequence.allocate();
         }
 
         // ==================== File Path Management ====================
         void DepartmentRepository::setFilePath(const std::string &filePath)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            flushPendingInternal();
             m_filePath = filePath;
+            m_journal.setDataFilePath(filePath);
             m_isLoaded = false;
         }
 
         std::string DepartmentRepository::getFilePath() const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
             return m_filePath;
         }
 
@@ -2,12 +2,16 @@
 #include "common/Constants.h"
 #include "common/Utils.h"
 #include "dal/FileHelper.h"
+#include "dal/IdSequence.h"
+#include "dal/BackupWorker.h"
+#include "dal/LineParser.h"
 
 #include <algorithm>
 #include <filesystem>
 #include <format>
 #include <set>
 #include <sstream>
+#include <unordered_set>
 
 namespace HMS
 {
@@ -19,8 +23,14 @@ namespace HMS
 
         // ==================== Private Constructor ====================
         DoctorRepository::DoctorRepository()
-            : m_filePath(Constants::DOCTOR_FILE), m_isLoaded(false)
+            : m_filePath(Constants::DOCTOR_FILE), m_isLoaded(false),
+              m_idSequence(Constants::DOCTOR_ID_PREFIX),
+              m_journal(Constants::DOCTOR_FILE), m_journalEnabled(false),
+              m_pendingChanges(0), m_flushScheduled(false)
         {
+            // Snapshots written in the background must keep the sequence too
+            m_journal.setSnapshotHeader([this]
+                                        { return m_idSequence.getHeaderLine(); });
         }
 
         // ==================== Singleton Access ====================
@@ -41,7 +51,15 @@ namespace HMS
         }
 
         // ==================== Destructor ====================
-        DoctorRepository::~DoctorRepository() = default;
+        DoctorRepository::~DoctorRepository()
+        {
+            // Write-behind changes must not be lost with the instance
+            if (m_flushScheduled)
+            {
+                WriteBehindFlusher::getInstance()->cancel(this);
+            }
+            flushPendingInternal();
+        }
 
         // ==================== Private Helper ====================
         void DoctorRepository::ensureLoaded() const
@@ -52,25 +70,78 @@ namespace HMS
             }
         }
 
+        std::shared_lock<std::shared_mutex> DoctorRepository::lockForRead() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            if (!m_isLoaded)
+            {
+                // Loading mutates the repository, so it runs under the exclusive lock
+                lock.unlock();
+                {
+                    std::lock_guard<std::shared_mutex> writeLock(m_dataMutex);
+                    ensureLoaded();
+                }
+                lock.lock();
+            }
+            return lock;
+        }
+
+        std::unique_lock<std::shared_mutex> DoctorRepository::lockForWrite()
+        {
+            std::unique_lock<std::shared_mutex> lock(m_dataMutex);
+            ensureLoaded();
+            m_doctors.detach();
+            return lock;
+        }
+
+        void DoctorRepository::rebuildIndex(size_t from)
+        {
+            if (from == 0)
+            {
+                m_idIndex.clear();
+                m_idIndex.reserve(m_doctors.size());
+            }
+
+            for (size_t i = from; i < m_doctors.size(); ++i)
+            {
+                m_idIndex[m_doctors[i].getDoctorID()] = i;
+            }
+        }
+
+        std::vector<Model::Doctor>::iterator DoctorRepository::findById(const std::string &id)
+        {
+            auto it = m_idIndex.find(id);
+            if (it == m_idIndex.end())
+            {
+                return m_doctors.end();
+            }
+            return m_doctors.begin() + static_cast<std::ptrdiff_t>(it->second);
+        }
+
         // ==================== CRUD Operations ====================
         std::vector<Model::Doctor> DoctorRepository::getAll()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
-            return m_doctors;
+            auto lock = lockForRead();
+            return m_doctors.items();
+        }
+
+        Snapshot<Model::Doctor> DoctorRepository::getSnapshot() const
+        {
+            auto lock = lockForRead();
+            return m_doctors.snapshot();
+        }
+
+        ReadView<Model::Doctor> DoctorRepository::view() const
+        {
+            auto lock = lockForRead();
+            return ReadView<Model::Doctor>(std::move(lock), m_doctors.items());
         }
 
         std::optional<Model::Doctor> DoctorRepository::getById(const std::string &id)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            auto it = std::ranges::find_if(
-                m_doctors, [&id](const auto &d)
-                {
-                    return d.getDoctorID() == id;
-                }
-            );
+            auto it = findById(id);
 
             if (it != m_doctors.end())
             {
@@ -81,34 +152,27 @@ namespace HMS
 
         bool DoctorRepository::add(const Model::Doctor &doctor)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
             // Check if doctor ID already exists (primary key check only)
-            bool idExists = std::ranges::any_of(
-                m_doctors, [&doctor](const auto &d)
-                { return d.getDoctorID() == doctor.getDoctorID(); });
+            bool idExists = m_idIndex.contains(doctor.getDoctorID());
 
             if (idExists)
             {
                 return false;
             }
 
+            m_idIndex.emplace(doctor.getDoctorID(), m_doctors.size());
             m_doctors.push_back(doctor);
-            return saveInternal();
+            m_idSequence.observe(doctor.getDoctorID());
+            return persistUpsert(doctor);
         }
 
         bool DoctorRepository::update(const Model::Doctor &doctor)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
-            auto it = std::ranges::find_if(
-                m_doctors, [&doctor](const auto &d)
-                {
-                    return d.getDoctorID() == doctor.getDoctorID();
-                }
-            );
+            auto it = findById(doctor.getDoctorID());
 
             if (it == m_doctors.end())
             {
@@ -116,34 +180,136 @@ namespace HMS
             }
 
             *it = doctor;
-            return saveInternal();
+            return persistUpsert(doctor);
         }
 
         bool DoctorRepository::remove(const std::string &id)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
-            auto it = std::ranges::find_if(
-                m_doctors, [&id](const auto &d)
-                {
-                    return d.getDoctorID() == id;
-                }
-            );
+            auto it = findById(id);
 
             if (it == m_doctors.end())
             {
                 return false;
             }
 
+            const auto slot = static_cast<size_t>(it - m_doctors.begin());
             m_doctors.erase(it);
-            return saveInternal();
+            m_idIndex.erase(id);
+            rebuildIndex(slot);
+            return persistRemove(id);
+        }
+
+        bool DoctorRepository::addRange(const std::vector<Model::Doctor> &doctors)
+        {
+            auto lock = lockForWrite();
+
+            // All or nothing: reject the batch if any ID is taken or repeated
+            std::unordered_set<std::string_view> batchIds;
+            batchIds.reserve(doctors.size());
+            for (const auto &doctor : doctors)
+            {
+                const std::string &id = doctor.getDoctorID();
+                if (m_idIndex.contains(id) || !batchIds.insert(id).second)
+                {
+                    return false;
+                }
+            }
+
+            if (doctors.empty())
+            {
+                return true;
+            }
+
+            const size_t oldSize = m_doctors.size();
+            std::vector<Journal::Record> records;
+            records.reserve(doctors.size());
+            for (const auto &doctor : doctors)
+            {
+                m_idIndex.emplace(doctor.getDoctorID(), m_doctors.size());
+                m_doctors.push_back(doctor);
+                m_idSequence.observe(doctor.getDoctorID());
+                records.push_back({Journal::Operation::UPSERT, doctor.serialize()});
+            }
+            if (!persistRecords(records))
+            {
+                rollbackRange(oldSize, {}, records.size());
+                return false;
+            }
+            return true;
+        }
+
+        bool DoctorRepository::upsertRange(const std::vector<Model::Doctor> &doctors)
+        {
+            auto lock = lockForWrite();
+
+            if (doctors.empty())
+            {
+                return true;
+            }
+
+            const size_t oldSize = m_doctors.size();
+            std::vector<std::pair<size_t, Model::Doctor>> replaced;
+            std::vector<Journal::Record> records;
+            records.reserve(doctors.size());
+            for (const auto &doctor : doctors)
+            {
+                auto it = findById(doctor.getDoctorID());
+                if (it != m_doctors.end())
+                {
+                    replaced.emplace_back(static_cast<size_t>(it - m_doctors.begin()), *it);
+                    *it = doctor;
+                }
+                else
+                {
+                    m_idIndex.emplace(doctor.getDoctorID(), m_doctors.size());
+                    m_doctors.push_back(doctor);
+                    m_idSequence.observe(doctor.getDoctorID());
+                }
+                records.push_back({Journal::Operation::UPSERT, doctor.serialize()});
+            }
+            if (!persistRecords(records))
+            {
+                rollbackRange(oldSize, replaced, records.size());
+                return false;
+            }
+            return true;
+        }
+
+        void DoctorRepository::rollbackRange(size_t oldSize,
+                                             const std::vector<std::pair<size_t, Model::Doctor>> &replaced,
+                                             size_t recordCount)
+        {
+            // Deferred records of the batch must not reach the file on a later flush
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.erase(m_pendingRecords.end() - static_cast<std::ptrdiff_t>(recordCount),
+                                           m_pendingRecords.end());
+                }
+                m_pendingChanges -= recordCount;
+            }
+
+            // Newest first, so a record replaced twice gets its original value back
+            for (auto it = replaced.rbegin(); it != replaced.rend(); ++it)
+            {
+                m_doctors[it->first] = it->second;
+            }
+
+            auto &items = m_doctors.items();
+            for (size_t slot = oldSize; slot < items.size(); ++slot)
+            {
+                m_idIndex.erase(items[slot].getDoctorID());
+            }
+            items.erase(items.begin() + static_cast<std::ptrdiff_t>(oldSize), items.end());
         }
 
         // ==================== Persistence ====================
         bool DoctorRepository::save()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
             return saveInternal();
         }
 
@@ -151,6 +317,9 @@ namespace HMS
         {
             try
             {
+                // A background snapshot may still be writing the same file
+                m_journal.waitForCompaction();
+
                 std::vector<std::string> lines;
 
                 // Add header
@@ -164,6 +333,7 @@ namespace HMS
                         lines.push_back(headerLine);
                     }
                 }
+                lines.push_back(m_idSequence.getHeaderLine());
 
                 // Add data
                 for (const auto &doctor : m_doctors)
@@ -171,8 +341,17 @@ namespace HMS
                     lines.push_back(doctor.serialize());
                 }
 
-                FileHelper::createBackup(m_filePath);
-                return FileHelper::writeLines(m_filePath, lines);
+                if (!FileHelper::writeLines(m_filePath, lines))
+                {
+                    return false;
+                }
+                BackupWorker::getInstance()->submit(m_filePath, std::move(lines));
+
+                // Snapshot now contains every journaled change
+                m_journal.truncate();
+                m_pendingRecords.clear();
+                m_pendingChanges = 0;
+                return true;
             }
             catch (...)
             {
@@ -180,9 +359,117 @@ namespace HMS
             }
         }
 
+        bool DoctorRepository::persistUpsert(const Model::Doctor &doctor)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.push_back({Journal::Operation::UPSERT, doctor.serialize()});
+                }
+                return deferWrite(1);
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(Journal::Operation::UPSERT, doctor.serialize(),
+                                        m_doctors, "Doctor");
+            }
+            return saveInternal();
+        }
+
+        bool DoctorRepository::persistRemove(const std::string &id)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.push_back({Journal::Operation::REMOVE, id});
+                }
+                return deferWrite(1);
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(Journal::Operation::REMOVE, id, m_doctors, "Doctor");
+            }
+            return saveInternal();
+        }
+
+        bool DoctorRepository::persistRecords(const std::vector<Journal::Record> &records)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.insert(m_pendingRecords.end(), records.begin(), records.end());
+                }
+
+                // One write covers the whole batch; no other writer needs to join it
+                if (m_durability.mode == DurabilityPolicy::Mode::GROUP_COMMIT)
+                {
+                    m_pendingChanges += records.size();
+                    return flushPendingInternal();
+                }
+                return deferWrite(records.size());
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(records, m_doctors, "Doctor");
+            }
+            return saveInternal();
+        }
+
+        bool DoctorRepository::deferWrite(size_t changes)
+        {
+            m_pendingChanges += changes;
+            if (m_durability.mode == DurabilityPolicy::Mode::GROUP_COMMIT)
+            {
+                // Releases the lock until a leader has written this change
+                return m_groupCommit.commit(m_dataMutex, [this]
+                                            { return flushPendingInternal(); });
+            }
+
+            if (m_pendingChanges >= m_durability.maxPendingChanges)
+            {
+                return flushPendingInternal();
+            }
+
+            // Keeps the deadline of the first change since the last flush
+            m_flushScheduled = true;
+            WriteBehindFlusher::getInstance()->schedule(this, m_durability.interval, [this]
+                                                        { flush(); });
+            return true;
+        }
+
+        bool DoctorRepository::flushPendingInternal()
+        {
+            if (m_pendingChanges == 0)
+            {
+                return true;
+            }
+
+            if (!m_journalEnabled)
+            {
+                return saveInternal();
+            }
+
+            if (!m_journal.append(m_pendingRecords, m_doctors, "Doctor"))
+            {
+                return false;
+            }
+            m_pendingRecords.clear();
+            m_pendingChanges = 0;
+            return true;
+        }
+
         bool DoctorRepository::load()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+
+            // Reloading replaces the records, so deferred changes are written first
+            flushPendingInternal();
             return loadInternal();
         }
 
@@ -201,19 +488,34 @@ namespace HMS
 
                 FileHelper::createFileIfNotExists(m_filePath);
 
-                std::vector<std::string> lines = FileHelper::readLines(m_filePath);
+                m_journal.waitForCompaction();
+                MappedFile file(m_filePath);
+                std::vector<std::string_view> lines = FileHelper::readLineViews(file);
+
+                // IDs are seeded once here; removed IDs stay behind the stored mark
+                m_idSequence.reset();
+                for (std::string_view headerLine : FileHelper::readHeaderLines(file))
+                {
+                    m_idSequence.restore(headerLine);
+                }
 
-                m_doctors.clear();
+                // Chunks are parsed concurrently and merged back in file order
+                m_doctors = parseLines<Model::Doctor>(lines, &Model::Doctor::deserialize);
 
-                for (const auto &line : lines)
+                // Replay mutations logged since the last snapshot. The journal is
+                // replayed even when journal mode is off so no logged change is lost.
+                m_journal.replay(
+                    m_doctors.items(), [](const auto &item)
+                    { return item.getDoctorID(); },
+                    [this](const std::string &id)
+                    { m_idSequence.observe(id); });
+
+                for (const auto &doctor : m_doctors)
                 {
-                    auto doctor = Model::Doctor::deserialize(line);
-                    if (doctor)
-                    {
-                        m_doctors.push_back(doctor.value());
-                    }
+                    m_idSequence.observe(doctor.getDoctorID());
                 }
 
+                rebuildIndex();
                 m_isLoaded = true;
                 return true;
             }
@@ -224,40 +526,99 @@ namespace HMS
             }
         }
 
+        // ==================== Journal Mode ====================
+        void DoctorRepository::setJournalEnabled(bool enabled)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            if (m_journalEnabled == enabled)
+            {
+                return;
+            }
+
+            // Deferred changes were recorded for the current mode
+            flushPendingInternal();
+
+            if (!enabled && m_isLoaded)
+            {
+                // Fold pending records into the data file before going back to full rewrites
+                saveInternal();
+            }
+
+            m_journalEnabled = enabled;
+        }
+
+        bool DoctorRepository::isJournalEnabled() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_journalEnabled;
+        }
+
+        size_t DoctorRepository::getJournalRecordCount() const
+        {
+            auto lock = lockForRead();
+            return m_journal.getRecordCount();
+        }
+
+        void DoctorRepository::setCompactionPolicy(const Journal::CompactionPolicy &policy)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            m_journal.setCompactionPolicy(policy);
+        }
+
+        // ==================== Durability ====================
+        void DoctorRepository::setDurabilityPolicy(const DurabilityPolicy &policy)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            flushPendingInternal();
+            m_durability = policy;
+        }
+
+        DurabilityPolicy DoctorRepository::getDurabilityPolicy() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_durability;
+        }
+
+        bool DoctorRepository::flush()
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            return flushPendingInternal();
+        }
+
+        size_t DoctorRepository::getPendingChangeCount() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_pendingChanges;
+        }
+
         // ==================== Query Operations ====================
         size_t DoctorRepository::count() const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
             return m_doctors.size();
         }
 
         bool DoctorRepository::exists(const std::string &id) const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            return std::ranges::any_of(
-                m_doctors, [&id](const auto &d)
-                {
-                    return d.getDoctorID() == id;
-                }
-            );
+            return m_idIndex.contains(id);
         }
 
         bool DoctorRepository::clear()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
             m_doctors.clear();
+            m_idIndex.clear();
             m_isLoaded = true;
+            m_idSequence.reset();
             return saveInternal();
         }
 
         // ==================== Doctor-Specific Queries ====================
         std::optional<Model::Doctor> DoctorRepository::getByUsername(const std::string &username)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             auto it = std::ranges::find_if(
                 m_doctors, [&username](const auto &d)
@@ -275,8 +636,7 @@ namespace HMS
 
         std::vector<Model::Doctor> DoctorRepository::getBySpecialization(const std::string &specialization)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Doctor> results;
             std::ranges::copy_if(
@@ -284,11 +644,14 @@ namespace HMS
                 [&specialization](const auto &d)
                 {
                     // Check if doctor has this specialization (supports partial match)
-                    auto specs = d.getSpecializations();
-                    return std::any_of(specs.begin(), specs.end(),
-                        [&specialization](const std::string& spec) {
-                            return Utils::containsIgnoreCase(spec, specialization);
-                        });
+                    Utils::FieldTokenizer specs(d.getSpecialization(), ',');
+                    std::string_view spec;
+                    while (specs.next(spec))
+                    {
+                        if (Utils::containsIgnoreCase(spec, specialization))
+                            return true;
+                    }
+                    return false;
                 }
             );
 
@@ -297,8 +660,7 @@ namespace HMS
 
         std::vector<Model::Doctor> DoctorRepository::searchByName(const std::string &name)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Doctor> results;
             std::ranges::copy_if(
@@ -314,8 +676,7 @@ namespace HMS
 
         std::vector<Model::Doctor> DoctorRepository::search(const std::string &keyword)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Doctor> results;
             std::ranges::copy_if(
@@ -333,20 +694,20 @@ namespace HMS
 
         std::vector<std::string> DoctorRepository::getAllSpecializations()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::set<std::string> uniqueSpecs;
             for (const auto &d : m_doctors)
             {
                 // Get all specializations for each doctor
-                auto specs = d.getSpecializations();
-                for (const auto &spec : specs)
+                Utils::FieldTokenizer specs(d.getSpecialization(), ',');
+                std::string_view spec;
+                while (specs.next(spec))
                 {
-                    std::string trimmedSpec = Utils::trim(spec);
+                    std::string_view trimmedSpec = Utils::trimView(spec);
                     if (!trimmedSpec.empty())
                     {
-                        uniqueSpecs.insert(trimmedSpec);
+                        uniqueSpecs.emplace(trimmedSpec);
                     }
                 }
             }
@@ -356,58 +717,30 @@ namespace HMS
 
         std::string DoctorRepository::getNextId()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
-
-            if (m_doctors.empty())
-            {
-                return std::format("{}001", Constants::DOCTOR_ID_PREFIX);
-            }
-
-            // Find max ID number
-            int maxID = 0;
-            const std::string prefix = Constants::DOCTOR_ID_PREFIX;
-
-            for (const auto &doctor : m_doctors)
-            {
-                const std::string &doctorID = doctor.getDoctorID();
-
-                // Only process valid format: prefix + digits
-                if (doctorID.length() > prefix.length() &&
-                    doctorID.starts_with(prefix))
-                {
-                    std::string numPart = doctorID.substr(prefix.length());
-
-                    // Validate numeric before parsing
-                    if (Utils::isNumeric(numPart))
-                    {
-                        try
-                        {
-                            int idNum = std::stoi(numPart);
-                            maxID = std::max(maxID, idNum);
-                        }
-                        catch (const std::exception &)
-                        {
-                            // Ignore parse errors
-                        }
-                    }
-                }
-            }
+            auto lock = lockForRead();
+            return m_idSequence.peek();
+        }
 
-            return std::format("{}{:03d}", prefix, maxID + 1);
+        std::string DoctorRepository::allocateId()
+        {
+            // Loading needs the lock; allocation itself is atomic
+            auto lock = lockForRead();
+            return m_idSequence.allocate();
         }
 
         // ==================== File Path Management ====================
         void DoctorRepository::setFilePath(const std::string &filePath)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            flushPendingInternal();
             m_filePath = filePath;
+            m_journal.setDataFilePath(filePath);
             m_isLoaded = false;
         }
 
         std::string DoctorRepository::getFilePath() const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
             return m_filePath;
         }
 
@@ -1,19 +1,181 @@
 #include "dal/FileHelper.h"
+#include "dal/BackupStore.h"
 #include "common/Constants.h"
 #include "common/Utils.h"
 
+#include <atomic>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <sstream>
 
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 namespace fs = std::filesystem;
 
 namespace HMS
 {
     namespace DAL
     {
+        namespace
+        {
+            /**
+             * Writes a replacement for a file beside it and renames it into
+             * place on commit(), so readers and crashes only ever see the old
+             * or the new content. Uncommitted temp files are removed.
+             */
+            class AtomicFileWriter
+            {
+            public:
+                explicit AtomicFileWriter(const std::string &filePath)
+                    : m_filePath(filePath), m_tempPath(makeTempPath(filePath))
+                {
+#ifndef _WIN32
+                    m_fd = ::open(m_tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+                    m_ok = m_fd >= 0;
+#else
+                    m_file.open(m_tempPath, std::ios::binary | std::ios::trunc);
+                    m_ok = m_file.is_open();
+#endif
+                }
+
+                ~AtomicFileWriter()
+                {
+                    closeTemp();
+                    if (!m_committed)
+                    {
+                        std::error_code ec;
+                        fs::remove(m_tempPath, ec);
+                    }
+                }
+
+                AtomicFileWriter(const AtomicFileWriter &) = delete;
+                AtomicFileWriter &operator=(const AtomicFileWriter &) = delete;
+
+                void write(std::string_view data)
+                {
+                    if (!m_ok)
+                        return;
+
+                    m_buffer.append(data);
+                    if (m_buffer.size() >= BUFFER_SIZE)
+                        flushBuffer();
+                }
+
+                bool commit()
+                {
+                    flushBuffer();
+#ifndef _WIN32
+                    // Data must be on disk before the rename can publish it
+                    m_ok = m_ok && ::fsync(m_fd) == 0;
+#else
+                    m_ok = m_ok && static_cast<bool>(m_file.flush());
+#endif
+                    m_ok = closeTemp() && m_ok;
+                    if (!m_ok)
+                        return false;
+
+                    std::error_code ec;
+                    fs::rename(m_tempPath, m_filePath, ec);
+                    if (ec)
+                        return false;
+                    m_committed = true;
+
+                    syncParentDirectory();
+                    return true;
+                }
+
+            private:
+                static constexpr size_t BUFFER_SIZE = 64 * 1024;
+
+                std::string m_filePath;
+                std::string m_tempPath;
+                std::string m_buffer;
+                bool m_ok = false;
+                bool m_committed = false;
+#ifndef _WIN32
+                int m_fd = -1;
+#else
+                std::ofstream m_file;
+#endif
+
+                static std::string makeTempPath(const std::string &filePath)
+                {
+                    // Unique per writer so concurrent saves of one file never share a temp
+                    static std::atomic<unsigned> counter{0};
+#ifndef _WIN32
+                    const long pid = static_cast<long>(::getpid());
+#else
+                    const long pid = 0;
+#endif
+                    return filePath + ".tmp." + std::to_string(pid) + "." +
+                           std::to_string(counter.fetch_add(1, std::memory_order_relaxed));
+                }
+
+                void flushBuffer()
+                {
+                    if (!m_ok || m_buffer.empty())
+                        return;
+#ifndef _WIN32
+                    const char *data = m_buffer.data();
+                    size_t remaining = m_buffer.size();
+                    while (remaining > 0)
+                    {
+                        ssize_t written = ::write(m_fd, data, remaining);
+                        if (written < 0)
+                        {
+                            if (errno == EINTR)
+                                continue;
+                            m_ok = false;
+                            break;
+                        }
+                        data += written;
+                        remaining -= static_cast<size_t>(written);
+                    }
+#else
+                    m_ok = static_cast<bool>(m_file.write(m_buffer.data(),
+                                                          static_cast<std::streamsize>(m_buffer.size())));
+#endif
+                    m_buffer.clear();
+                }
+
+                bool closeTemp()
+                {
+#ifndef _WIN32
+                    if (m_fd < 0)
+                        return true;
+                    bool closed = ::close(m_fd) == 0;
+                    m_fd = -1;
+                    return closed;
+#else
+                    if (!m_file.is_open())
+                        return true;
+                    m_file.close();
+                    return !m_file.fail();
+#endif
+                }
+
+                void syncParentDirectory() const
+                {
+#ifndef _WIN32
+                    // Makes the rename itself survive a power loss
+                    fs::path parent = fs::path(m_filePath).parent_path();
+                    const std::string dir = parent.empty() ? "." : parent.string();
+                    int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+                    if (fd >= 0)
+                    {
+                        ::fsync(fd);
+                        ::close(fd);
+                    }
+#endif
+                }
+            };
+        }
 
         // ==================== Read Operations ====================
 
@@ -64,31 +226,78 @@ namespace HMS
             return ss.str();
         }
 
+        std::vector<std::string_view> FileHelper::readLineViews(const MappedFile &file)
+        {
+            std::vector<std::string_view> result;
+            std::string_view content = file.view();
+
+            size_t start = 0;
+            while (start < content.size())
+            {
+                size_t end = content.find('\n', start);
+                if (end == std::string_view::npos)
+                    end = content.size();
+
+                std::string_view line = content.substr(start, end - start);
+                if (!line.empty() && line.back() == '\r')
+                    line.remove_suffix(1);
+
+                if (!isEmpty(line) && !isComment(line))
+                    result.push_back(line);
+
+                start = end + 1;
+            }
+
+            return result;
+        }
+
+        std::vector<std::string_view> FileHelper::readHeaderLines(const MappedFile &file)
+        {
+            std::vector<std::string_view> result;
+            std::string_view content = file.view();
+
+            size_t start = 0;
+            while (start < content.size())
+            {
+                size_t end = content.find('\n', start);
+                if (end == std::string_view::npos)
+                    end = content.size();
+
+                std::string_view line = content.substr(start, end - start);
+                if (!line.empty() && line.back() == '\r')
+                    line.remove_suffix(1);
+
+                if (isComment(line))
+                    result.push_back(line);
+                else if (!isEmpty(line))
+                    break;
+
+                start = end + 1;
+            }
+
+            return result;
+        }
+
         // ==================== Write Operations ====================
 
         bool FileHelper::writeLines(const std::string &filePath,
                                     const std::vector<std::string> &lines)
         {
-            std::ofstream file(filePath, std::ios::trunc);
-            if (!file.is_open())
-                return false;
-
+            AtomicFileWriter file(filePath);
             for (const auto &line : lines)
             {
-                file << line << '\n';
+                file.write(line);
+                file.write("\n");
             }
-            return true;
+            return file.commit();
         }
 
         bool FileHelper::writeFile(const std::string &filePath,
                                    const std::string &content)
         {
-            std::ofstream file(filePath, std::ios::trunc);
-            if (!file.is_open())
-                return false;
-
-            file << content;
-            return true;
+            AtomicFileWriter file(filePath);
+            file.write(content);
+            return file.commit();
         }
 
         bool FileHelper::appendLine(const std::string &filePath,
@@ -197,67 +406,27 @@ namespace HMS
                 return false;
 
             // Skip backup for test fixture files
-            if (filePath.find("test/fixtures/") != std::string::npos ||
-                filePath.find("test\\fixtures\\") != std::string::npos)
+            if (isTestFixture(filePath))
             {
                 return true;
             }
 
-            createDirectoryIfNotExists(HMS::Constants::BACKUP_DIR);
-            return copyFile(filePath, getBackupPath(filePath));
+            return BackupStore::getInstance()->backup(filePath);
         }
 
         bool FileHelper::restoreFromBackup(const std::string &filePath)
         {
-            fs::path backupDir(HMS::Constants::BACKUP_DIR);
-            if (!fs::exists(backupDir))
-                return false;
-
-            std::string originalStem = fs::path(filePath).stem().string();
-
-            fs::path latestBackup;
-            std::time_t latestTime = 0;
-
-            for (const auto &entry : fs::directory_iterator(backupDir))
-            {
-                if (!entry.is_regular_file())
-                    continue;
-
-                std::string backupStem = entry.path().stem().string();
-
-                if (backupStem.rfind(originalStem + "_backup_", 0) != 0)
-                    continue;
-
-                auto ftime = fs::last_write_time(entry);
-
-                auto sctp =
-                    std::chrono::time_point_cast<std::chrono::system_clock::duration>(
-                        ftime - fs::file_time_type::clock::now() +
-                        std::chrono::system_clock::now());
-
-                std::time_t tt = std::chrono::system_clock::to_time_t(sctp);
-
-                if (tt > latestTime)
-                {
-                    latestTime = tt;
-                    latestBackup = entry.path();
-                }
-            }
-
-            if (latestBackup.empty())
-                return false;
-
-            return copyFile(latestBackup.string(), filePath);
+            return BackupStore::getInstance()->restoreLatest(filePath);
         }
 
         // ==================== Utility Methods ====================
 
-        bool FileHelper::isComment(const std::string &line)
+        bool FileHelper::isComment(std::string_view line)
         {
             return !line.empty() && line[0] == HMS::Constants::COMMENT_CHAR;
         }
 
-        bool FileHelper::isEmpty(const std::string &line)
+        bool FileHelper::isEmpty(std::string_view line)
         {
             for (char c : line)
             {
@@ -267,6 +436,12 @@ namespace HMS
             return true;
         }
 
+        bool FileHelper::isTestFixture(const std::string &filePath)
+        {
+            return filePath.find("test/fixtures/") != std::string::npos ||
+                   filePath.find("test\\fixtures\\") != std::string::npos;
+        }
+
         std::string FileHelper::getFileHeader(const std::string &fileType)
         {
             if (fileType == "Account")
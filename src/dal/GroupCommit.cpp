@@ -0,0 +1,68 @@
+#include "dal/GroupCommit.h"
+
+namespace HMS
+{
+    namespace DAL
+    {
+
+        bool GroupCommit::commit(std::shared_mutex &dataMutex, const std::function<bool()> &flush)
+        {
+            // Joined while the change is applied and locked, so whoever closes
+            // this batch under the same lock writes the change too
+            std::shared_ptr<Batch> batch;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_open)
+                {
+                    m_open = std::make_shared<Batch>();
+                }
+                batch = m_open;
+            }
+            dataMutex.unlock();
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while (!batch->done)
+            {
+                if (m_leaderActive)
+                {
+                    m_done.wait(lock);
+                    continue;
+                }
+
+                // No write in progress: our batch is the open one, so lead it
+                m_leaderActive = true;
+                lock.unlock();
+
+                bool ok = false;
+                std::shared_ptr<Batch> closing;
+                dataMutex.lock();
+                {
+                    std::lock_guard<std::mutex> batchLock(m_mutex);
+                    closing = std::move(m_open);
+                }
+                try
+                {
+                    ok = flush();
+                }
+                catch (...)
+                {
+                    ok = false;
+                }
+                dataMutex.unlock();
+
+                lock.lock();
+                closing->ok = ok;
+                closing->done = true;
+                m_leaderActive = false;
+                m_done.notify_all();
+            }
+
+            const bool ok = batch->ok;
+            lock.unlock();
+
+            dataMutex.lock();
+            return ok;
+        }
+
+    } // namespace DAL
+} // namespace HMS
@@ -0,0 +1,147 @@
+#include "dal/IdSequence.h"
+#include "common/Constants.h"
+
+#include <algorithm>
+#include <charconv>
+#include <format>
+
+namespace HMS
+{
+    namespace DAL
+    {
+
+        namespace
+        {
+            constexpr std::string_view HEADER_KEY = "# nextId=";
+
+            std::optional<std::uint64_t> parseNumber(std::string_view digits)
+            {
+                std::uint64_t value = 0;
+                auto [end, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), value);
+                if (digits.empty() || ec != std::errc{} || end != digits.data() + digits.size())
+                {
+                    return std::nullopt;
+                }
+                return value;
+            }
+
+            // Position where the digits of an ID start
+            size_t digitsStart(std::string_view id)
+            {
+                size_t pos = id.size();
+                while (pos > 0 && id[pos - 1] >= '0' && id[pos - 1] <= '9')
+                {
+                    --pos;
+                }
+                return pos;
+            }
+        }
+
+        // ==================== Constructor ====================
+        IdSequence::IdSequence(std::string prefix)
+            : m_prefix(std::move(prefix)), m_next(1)
+        {
+        }
+
+        // ==================== Seeding ====================
+        void IdSequence::reset()
+        {
+            m_next.store(1);
+        }
+
+        void IdSequence::observe(std::string_view id)
+        {
+            auto number = parse(m_prefix, id);
+            if (!number)
+            {
+                return;
+            }
+
+            // Raise only: a concurrent allocation may already be past this ID
+            std::uint64_t current = m_next.load();
+            while (current <= *number && !m_next.compare_exchange_weak(current, *number + 1))
+            {
+            }
+        }
+
+        bool IdSequence::restore(std::string_view line)
+        {
+            if (!line.starts_with(HEADER_KEY))
+            {
+                return false;
+            }
+
+            auto next = parseNumber(line.substr(HEADER_KEY.size()));
+            if (!next || *next == 0)
+            {
+                return false;
+            }
+
+            std::uint64_t current = m_next.load();
+            while (current < *next && !m_next.compare_exchange_weak(current, *next))
+            {
+            }
+            return true;
+        }
+
+        // ==================== Allocation ====================
+        std::string IdSequence::allocate()
+        {
+            return format(m_prefix, m_next.fetch_add(1));
+        }
+
+        std::string IdSequence::peek() const
+        {
+            return format(m_prefix, m_next.load());
+        }
+
+        std::string IdSequence::getHeaderLine() const
+        {
+            return std::format("{}{}", HEADER_KEY, m_next.load());
+        }
+
+        // ==================== Utility Methods ====================
+        std::optional<std::uint64_t> IdSequence::parse(std::string_view prefix, std::string_view id)
+        {
+            if (id.size() <= prefix.size() || !id.starts_with(prefix))
+            {
+                return std::nullopt;
+            }
+            return parseNumber(id.substr(prefix.size()));
+        }
+
+        std::string IdSequence::format(std::string_view prefix, std::uint64_t number)
+        {
+            return std::format("{}{:0{}}", prefix, number, Constants::ID_MIN_DIGITS);
+        }
+
+        int IdSequence::compare(std::string_view a, std::string_view b)
+        {
+            const size_t splitA = digitsStart(a);
+            const size_t splitB = digitsStart(b);
+
+            if (int byPrefix = a.substr(0, splitA).compare(b.substr(0, splitB)); byPrefix != 0)
+            {
+                return byPrefix;
+            }
+
+            // Same prefix: the number with more significant digits is larger
+            std::string_view digitsA = a.substr(splitA);
+            std::string_view digitsB = b.substr(splitB);
+            digitsA.remove_prefix(std::min(digitsA.find_first_not_of('0'), digitsA.size()));
+            digitsB.remove_prefix(std::min(digitsB.find_first_not_of('0'), digitsB.size()));
+
+            if (digitsA.size() != digitsB.size())
+            {
+                return digitsA.size() < digitsB.size() ? -1 : 1;
+            }
+            if (int byNumber = digitsA.compare(digitsB); byNumber != 0)
+            {
+                return byNumber;
+            }
+            // Equal numbers: fall back to the full text so "D01" and "D001" stay distinct
+            return a.compare(b);
+        }
+
+    } // namespace DAL
+} // namespace HMS
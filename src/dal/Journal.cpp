@@ -0,0 +1,419 @@
+#include "dal/Journal.h"
+#include "dal/CompactionWorker.h"
+#include "dal/FileHelper.h"
+
+#include <filesystem>
+#include <sstream>
+#include <string_view>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace HMS
+{
+    namespace DAL
+    {
+        namespace
+        {
+            constexpr char UPSERT_TAG = 'U';
+            constexpr char REMOVE_TAG = 'D';
+
+            /**
+             * Forces appended journal data from the page cache to disk, plus
+             * the directory entry of a journal that was just created.
+             */
+            bool syncToDisk(const std::string &path, bool created)
+            {
+#ifndef _WIN32
+                int fd = ::open(path.c_str(), O_WRONLY | O_CLOEXEC);
+                if (fd < 0)
+                    return false;
+                bool synced = ::fdatasync(fd) == 0;
+                synced = ::close(fd) == 0 && synced;
+
+                if (synced && created)
+                {
+                    fs::path parent = fs::path(path).parent_path();
+                    const std::string dir = parent.empty() ? "." : parent.string();
+                    int dirFd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+                    if (dirFd >= 0)
+                    {
+                        ::fsync(dirFd);
+                        ::close(dirFd);
+                    }
+                }
+                return synced;
+#else
+                (void)path;
+                (void)created;
+                return true;
+#endif
+            }
+        }
+
+        // ==================== Constructors ====================
+
+        Journal::Journal(const std::string &dataFilePath)
+            : m_dataFilePath(dataFilePath),
+              m_filePath(dataFilePath.empty() ? "" : getJournalPath(dataFilePath)),
+              m_recordCount(0),
+              m_sizeBytes(0),
+              m_compaction(std::make_shared<CompactionState>())
+        {
+        }
+
+        Journal::~Journal()
+        {
+            waitForCompaction();
+            closeStream();
+        }
+
+        // ==================== Configuration ====================
+
+        void Journal::setDataFilePath(const std::string &dataFilePath)
+        {
+            waitForCompaction();
+            closeStream();
+            m_dataFilePath = dataFilePath;
+            m_filePath = getJournalPath(dataFilePath);
+            m_recordCount = 0;
+            m_sizeBytes = 0;
+        }
+
+        std::string Journal::getFilePath() const
+        {
+            return m_filePath;
+        }
+
+        void Journal::setCompactionPolicy(const CompactionPolicy &policy)
+        {
+            m_policy = policy;
+        }
+
+        Journal::CompactionPolicy Journal::getCompactionPolicy() const
+        {
+            return m_policy;
+        }
+
+        void Journal::setSnapshotHeader(std::function<std::string()> header)
+        {
+            m_snapshotHeader = std::move(header);
+        }
+
+        // ==================== Write Operations ====================
+
+        bool Journal::append(Operation operation, const std::string &payload)
+        {
+            if (m_filePath.empty())
+                return false;
+
+            if (!m_stream.is_open())
+            {
+                m_stream.open(m_filePath, std::ios::app);
+                if (!m_stream.is_open())
+                    return false;
+            }
+
+            std::error_code ec;
+            const std::uintmax_t sizeBefore = fs::file_size(m_filePath, ec);
+            if (ec)
+                return false;
+
+            m_stream << (operation == Operation::UPSERT ? UPSERT_TAG : REMOVE_TAG)
+                     << Constants::FIELD_DELIMITER << payload << '\n';
+            m_stream.flush();
+
+            // On disk, not just in the page cache, before success is reported
+            if (!m_stream || !syncToDisk(m_filePath, sizeBefore == 0))
+            {
+                discardTail(sizeBefore);
+                return false;
+            }
+
+            ++m_recordCount;
+            m_sizeBytes += payload.size() + 3; // tag + delimiter + newline
+            return true;
+        }
+
+        bool Journal::append(const std::vector<Record> &records)
+        {
+            if (m_filePath.empty())
+                return false;
+            if (records.empty())
+                return true;
+
+            if (!m_stream.is_open())
+            {
+                m_stream.open(m_filePath, std::ios::app);
+                if (!m_stream.is_open())
+                    return false;
+            }
+
+            std::error_code ec;
+            const std::uintmax_t sizeBefore = fs::file_size(m_filePath, ec);
+            if (ec)
+                return false;
+
+            std::uintmax_t bytes = 0;
+            for (const auto &record : records)
+            {
+                m_stream << (record.operation == Operation::UPSERT ? UPSERT_TAG : REMOVE_TAG)
+                         << Constants::FIELD_DELIMITER << record.payload << '\n';
+                bytes += record.payload.size() + 3;
+            }
+            m_stream.flush();
+
+            // One sync per call, so a batch costs a single disk flush
+            if (!m_stream || !syncToDisk(m_filePath, sizeBefore == 0))
+            {
+                discardTail(sizeBefore);
+                return false;
+            }
+
+            m_recordCount += records.size();
+            m_sizeBytes += bytes;
+            return true;
+        }
+
+        bool Journal::truncate()
+        {
+            waitForCompaction();
+            closeStream();
+            m_recordCount = 0;
+            m_sizeBytes = 0;
+
+            std::error_code ec;
+            fs::remove(getCompactingPath(), ec);
+            fs::remove(m_filePath, ec);
+            return !ec;
+        }
+
+        // ==================== Compaction ====================
+
+        bool Journal::needsCompaction() const
+        {
+            if (isCompactionPending())
+                return false;
+
+            return (m_policy.maxRecords > 0 && m_recordCount >= m_policy.maxRecords) ||
+                   (m_policy.maxBytes > 0 && m_sizeBytes >= m_policy.maxBytes);
+        }
+
+        bool Journal::isCompactionPending() const
+        {
+            std::lock_guard<std::mutex> lock(m_compaction->mutex);
+            return m_compaction->pending;
+        }
+
+        void Journal::waitForCompaction() const
+        {
+            std::unique_lock<std::mutex> lock(m_compaction->mutex);
+            m_compaction->done.wait(lock, [this]
+                                    { return !m_compaction->pending; });
+        }
+
+        bool Journal::rotate()
+        {
+            closeStream();
+
+            const std::string compactingPath = getCompactingPath();
+            std::error_code ec;
+
+            if (!fs::exists(m_filePath, ec))
+            {
+                // Nothing logged since the last snapshot
+            }
+            else if (!fs::exists(compactingPath, ec))
+            {
+                fs::rename(m_filePath, compactingPath, ec);
+                if (ec)
+                    return false;
+            }
+            else
+            {
+                // A previous compaction failed: keep its records ahead of the new ones
+                auto content = FileHelper::readFile(m_filePath);
+                if (!content)
+                    return false;
+
+                std::ofstream segment(compactingPath, std::ios::app | std::ios::binary);
+                if (!segment.is_open())
+                    return false;
+                segment << *content;
+                segment.close();
+                if (!segment)
+                    return false;
+
+                fs::remove(m_filePath, ec);
+            }
+
+            m_recordCount = 0;
+            m_sizeBytes = 0;
+            return true;
+        }
+
+        bool Journal::scheduleCompaction(const std::string &fileType,
+                                         std::function<std::vector<std::string>()> serialize)
+        {
+            if (m_dataFilePath.empty() || isCompactionPending())
+                return false;
+
+            if (!rotate())
+                return false;
+
+            {
+                std::lock_guard<std::mutex> lock(m_compaction->mutex);
+                m_compaction->pending = true;
+            }
+
+            CompactionWorker::getInstance()->submit(
+                [state = m_compaction,
+                 dataFilePath = m_dataFilePath,
+                 compactingPath = getCompactingPath(),
+                 fileType,
+                 extraHeader = m_snapshotHeader ? m_snapshotHeader() : std::string(),
+                 serialize = std::move(serialize)]()
+                {
+                    bool written = false;
+                    try
+                    {
+                        std::vector<std::string> lines;
+                        lines.push_back(FileHelper::getFileHeader(fileType));
+                        if (!extraHeader.empty())
+                        {
+                            lines.push_back(extraHeader);
+                        }
+                        auto data = serialize();
+                        lines.insert(lines.end(),
+                                     std::make_move_iterator(data.begin()),
+                                     std::make_move_iterator(data.end()));
+
+                        // Replaced atomically, so a crash never leaves a
+                        // half-written snapshot without its journal
+                        written = FileHelper::writeLines(dataFilePath, lines);
+                    }
+                    catch (...)
+                    {
+                        written = false;
+                    }
+
+                    if (written)
+                    {
+                        std::error_code ec;
+                        fs::remove(compactingPath, ec);
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> lock(state->mutex);
+                        state->pending = false;
+                    }
+                    state->done.notify_all();
+                });
+
+            return true;
+        }
+
+        // ==================== Read Operations ====================
+
+        std::vector<Journal::Record> Journal::readRecords()
+        {
+            std::vector<Record> records;
+            waitForCompaction();
+            closeStream();
+
+            // Segment left by an interrupted compaction comes first
+            readSegment(getCompactingPath(), records);
+            size_t compactingCount = records.size();
+            readSegment(m_filePath, records);
+
+            m_recordCount = records.size() - compactingCount;
+
+            std::error_code ec;
+            auto size = fs::file_size(m_filePath, ec);
+            m_sizeBytes = ec ? 0 : size;
+            return records;
+        }
+
+        void Journal::readSegment(const std::string &path, std::vector<Record> &records)
+        {
+            std::ifstream file(path, std::ios::binary);
+            if (!file.is_open())
+                return;
+
+            std::ostringstream ss;
+            ss << file.rdbuf();
+            file.close();
+            const std::string content = ss.str();
+
+            size_t start = 0;
+            while (start < content.size())
+            {
+                size_t end = content.find('\n', start);
+                if (end == std::string::npos)
+                {
+                    // Torn trailing record: cut it so the next append starts on a fresh line
+                    std::error_code ec;
+                    fs::resize_file(path, start, ec);
+                    break;
+                }
+
+                std::string_view line(content.data() + start, end - start);
+                if (!line.empty() && line.back() == '\r')
+                    line.remove_suffix(1);
+
+                if (line.size() >= 2 && line[1] == Constants::FIELD_DELIMITER)
+                {
+                    if (line[0] == UPSERT_TAG)
+                        records.push_back({Operation::UPSERT, std::string(line.substr(2))});
+                    else if (line[0] == REMOVE_TAG)
+                        records.push_back({Operation::REMOVE, std::string(line.substr(2))});
+                }
+
+                start = end + 1;
+            }
+        }
+
+        size_t Journal::getRecordCount() const
+        {
+            return m_recordCount;
+        }
+
+        std::uintmax_t Journal::getSizeBytes() const
+        {
+            return m_sizeBytes;
+        }
+
+        // ==================== Utility Methods ====================
+
+        std::string Journal::getJournalPath(const std::string &dataFilePath)
+        {
+            return dataFilePath + Constants::JOURNAL_FILE_SUFFIX;
+        }
+
+        std::string Journal::getCompactingPath() const
+        {
+            return m_filePath + Constants::JOURNAL_COMPACTING_SUFFIX;
+        }
+
+        void Journal::discardTail(std::uintmax_t size)
+        {
+            closeStream();
+
+            // Drop the partial write so it neither corrupts the next record nor replays
+            std::error_code ec;
+            fs::resize_file(m_filePath, size, ec);
+        }
+
+        void Journal::closeStream()
+        {
+            if (m_stream.is_open())
+                m_stream.close();
+            m_stream.clear();
+        }
+
+    } // namespace DAL
+} // namespace HMS
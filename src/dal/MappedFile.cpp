@@ -0,0 +1,140 @@
+#include "dal/MappedFile.h"
+
+#include <utility>
+
+#ifdef _WIN32
+#include <fstream>
+#include <sstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace HMS
+{
+    namespace DAL
+    {
+        // ==================== Constructors ====================
+
+        MappedFile::MappedFile(const std::string &filePath)
+        {
+            open(filePath);
+        }
+
+        MappedFile::~MappedFile()
+        {
+            close();
+        }
+
+        MappedFile::MappedFile(MappedFile &&other) noexcept
+        {
+            *this = std::move(other);
+        }
+
+        MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+        {
+            if (this != &other)
+            {
+                close();
+
+                m_isOpen = std::exchange(other.m_isOpen, false);
+                m_isMapped = std::exchange(other.m_isMapped, false);
+                m_size = std::exchange(other.m_size, 0);
+                m_buffer = std::move(other.m_buffer);
+
+                // A fallback view must point into our own buffer after the move
+                const char *data = std::exchange(other.m_data, nullptr);
+                m_data = m_isMapped ? data : m_buffer.data();
+            }
+            return *this;
+        }
+
+        // ==================== Operations ====================
+
+        bool MappedFile::open(const std::string &filePath)
+        {
+            close();
+
+#ifndef _WIN32
+            int fd = ::open(filePath.c_str(), O_RDONLY);
+            if (fd < 0)
+                return false;
+
+            struct stat st{};
+            if (::fstat(fd, &st) != 0)
+            {
+                ::close(fd);
+                return false;
+            }
+
+            m_size = static_cast<size_t>(st.st_size);
+            if (m_size > 0)
+            {
+                void *addr = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (addr == MAP_FAILED)
+                {
+                    ::close(fd);
+                    m_size = 0;
+                    return false;
+                }
+
+                // Loaders read front to back once
+                ::madvise(addr, m_size, MADV_SEQUENTIAL);
+                m_data = static_cast<const char *>(addr);
+                m_isMapped = true;
+            }
+
+            // The mapping stays valid after the descriptor is closed
+            ::close(fd);
+#else
+            std::ifstream file(filePath, std::ios::binary);
+            if (!file.is_open())
+                return false;
+
+            std::ostringstream ss;
+            ss << file.rdbuf();
+            m_buffer = ss.str();
+            m_data = m_buffer.data();
+            m_size = m_buffer.size();
+#endif
+
+            m_isOpen = true;
+            return true;
+        }
+
+        void MappedFile::close()
+        {
+#ifndef _WIN32
+            if (m_isMapped)
+            {
+                ::munmap(const_cast<char *>(m_data), m_size);
+            }
+#endif
+            m_data = nullptr;
+            m_size = 0;
+            m_isOpen = false;
+            m_isMapped = false;
+            m_buffer.clear();
+        }
+
+        // ==================== Accessors ====================
+
+        bool MappedFile::isOpen() const
+        {
+            return m_isOpen;
+        }
+
+        std::string_view MappedFile::view() const
+        {
+            return m_data ? std::string_view(m_data, m_size) : std::string_view();
+        }
+
+        size_t MappedFile::size() const
+        {
+            return m_size;
+        }
+
+    } // namespace DAL
+} // namespace HMS
@@ -2,11 +2,15 @@
 #include "common/Constants.h"
 #include "common/Utils.h"
 #include "dal/FileHelper.h"
+#include "dal/IdSequence.h"
+#include "dal/BackupWorker.h"
+#include "dal/LineParser.h"
 
 #include <algorithm>
 #include <filesystem>
 #include <format>
 #include <sstream>
+#include <unordered_set>
 
 namespace HMS
 {
@@ -18,8 +22,14 @@ namespace HMS
 
         // ==================== Private Constructor ====================
         MedicineRepository::MedicineRepository()
-            : m_filePath(Constants::MEDICINE_FILE), m_isLoaded(false)
+            : m_filePath(Constants::MEDICINE_FILE), m_isLoaded(false),
+              m_idSequence(Constants::MEDICINE_ID_PREFIX),
+              m_journal(Constants::MEDICINE_FILE), m_journalEnabled(false),
+              m_pendingChanges(0), m_flushScheduled(false)
         {
+            // Snapshots written in the background must keep the sequence too
+            m_journal.setSnapshotHeader([this]
+                                        { return m_idSequence.getHeaderLine(); });
         }
 
         // ==================== Singleton Access ====================
@@ -41,7 +51,15 @@ namespace HMS
         }
 
         // ==================== Destructor ====================
-        MedicineRepository::~MedicineRepository() = default;
+        MedicineRepository::~MedicineRepository()
+        {
+            // Write-behind changes must not be lost with the instance
+            if (m_flushScheduled)
+            {
+                WriteBehindFlusher::getInstance()->cancel(this);
+            }
+            flushPendingInternal();
+        }
 
         // ==================== Private Helper ====================
         void MedicineRepository::ensureLoaded() const
@@ -52,24 +70,78 @@ namespace HMS
             }
         }
 
+        std::shared_lock<std::shared_mutex> MedicineRepository::lockForRead() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            if (!m_isLoaded)
+            {
+                // Loading mutates the repository, so it runs under the exclusive lock
+                lock.unlock();
+                {
+                    std::lock_guard<std::shared_mutex> writeLock(m_dataMutex);
+                    ensureLoaded();
+                }
+                lock.lock();
+            }
+            return lock;
+        }
+
+        std::unique_lock<std::shared_mutex> MedicineRepository::lockForWrite()
+        {
+            std::unique_lock<std::shared_mutex> lock(m_dataMutex);
+            ensureLoaded();
+            m_medicines.detach();
+            return lock;
+        }
+
+        void MedicineRepository::rebuildIndex(size_t from)
+        {
+            if (from == 0)
+            {
+                m_idIndex.clear();
+                m_idIndex.reserve(m_medicines.size());
+            }
+
+            for (size_t i = from; i < m_medicines.size(); ++i)
+            {
+                m_idIndex[m_medicines[i].getMedicineID()] = i;
+            }
+        }
+
+        std::vector<Model::Medicine>::iterator MedicineRepository::findById(const std::string &id)
+        {
+            auto it = m_idIndex.find(id);
+            if (it == m_idIndex.end())
+            {
+                return m_medicines.end();
+            }
+            return m_medicines.begin() + static_cast<std::ptrdiff_t>(it->second);
+        }
+
         // ==================== CRUD Operations ====================
         std::vector<Model::Medicine> MedicineRepository::getAll()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
-            return m_medicines;
+            auto lock = lockForRead();
+            return m_medicines.items();
+        }
+
+        Snapshot<Model::Medicine> MedicineRepository::getSnapshot() const
+        {
+            auto lock = lockForRead();
+            return m_medicines.snapshot();
+        }
+
+        ReadView<Model::Medicine> MedicineRepository::view() const
+        {
+            auto lock = lockForRead();
+            return ReadView<Model::Medicine>(std::move(lock), m_medicines.items());
         }
 
         std::optional<Model::Medicine> MedicineRepository::getById(const std::string &id)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            auto it = std::ranges::find_if(
-                m_medicines, [&id](const auto &med) {
-                    return med.getMedicineID() == id;
-                }
-            );
+            auto it = findById(id);
 
             if (it != m_medicines.end())
             {
@@ -81,32 +153,28 @@ namespace HMS
 
         bool MedicineRepository::add(const Model::Medicine &medicine)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
             // DAL only checks for duplicate ID - business rules are in BLL
-            bool idExists = std::ranges::any_of(
-                m_medicines, [&medicine](const auto &med)
-                { return med.getMedicineID() == medicine.getMedicineID(); });
+            bool idExists = m_idIndex.contains(medicine.getMedicineID());
 
             if (idExists)
             {
                 return false;
             }
 
+            m_idIndex.emplace(medicine.getMedicineID(), m_medicines.size());
             m_medicines.push_back(medicine);
-            return saveInternal();
+            m_idSequence.observe(medicine.getMedicineID());
+            return persistUpsert(medicine);
         }
 
         bool MedicineRepository::update(const Model::Medicine &medicine)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
             // DAL only does CRUD - business rules are in BLL
-            auto it = std::ranges::find_if(
-                m_medicines, [&medicine](const auto &med)
-                { return med.getMedicineID() == medicine.getMedicineID(); });
+            auto it = findById(medicine.getMedicineID());
 
             if (it == m_medicines.end())
             {
@@ -114,33 +182,145 @@ namespace HMS
             }
 
             *it = medicine;
-            return saveInternal();
+            return persistUpsert(medicine);
         }
 
         bool MedicineRepository::remove(const std::string &id)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
-            auto it = std::ranges::find_if(
-                m_medicines, [&id](const auto &med) {
-                    return med.getMedicineID() == id;
-                }
-            );
+            auto it = findById(id);
 
             if (it == m_medicines.end())
             {
                 return false;
             }
 
+            const auto slot = static_cast<size_t>(it - m_medicines.begin());
             m_medicines.erase(it);
-            return saveInternal();
+            m_idIndex.erase(id);
+            rebuildIndex(slot);
+            return persistRemove(id);
+        }
+
+        bool MedicineRepository::addRange(const std::vector<Model::Medicine> &medicines)
+        {
+            auto lock = lockForWrite();
+
+            // All or nothing: reject the batch if any ID is taken or repeated
+            std::unordered_set<std::string_view> batchIds;
+            batchIds.reserve(medicines.size());
+            for (const auto &medicine : medicines)
+            {
+                const std::string &id = medicine.getMedicineID();
+                if (m_idIndex.contains(id) || !batchIds.insert(id).second)
+                {
+                    return false;
+                }
+            }
+
+            if (medicines.empty())
+            {
+                return true;
+            }
+
+            const size_t oldSize = m_medicines.size();
+            std::vector<Journal::Record> records;
+            records.reserve(medicines.size());
+            for (const auto &medicine : medicines)
+            {
+                m_idIndex.emplace(medicine.getMedicineID(), m_medicines.size());
+                m_medicines.push_back(medicine);
+                m_idSequence.observe(medicine.getMedicineID());
+                records.push_back({Journal::Operation::UPSERT, medicine.serialize()});
+            }
+            if (!persistRecords(records))
+            {
+                rollbackRange(oldSize, {}, records.size());
+                return false;
+            }
+            return true;
+        }
+
+        bool MedicineRepository::upsertRange(const std::vector<Model::Medicine> &medicines)
+        {
+            auto lock = lockForWrite();
+
+            if (medicines.empty())
+            {
+                return true;
+            }
+
+            const size_t oldSize = m_medicines.size();
+            std::vector<std::pair<size_t, Model::Medicine>> replaced;
+            std::vector<Journal::Record> records;
+            records.reserve(medicines.size());
+            for (const auto &medicine : medicines)
+            {
+                auto it = findById(medicine.getMedicineID());
+                if (it != m_medicines.end())
+                {
+                    replaced.emplace_back(static_cast<size_t>(it - m_medicines.begin()), *it);
+                    *it = medicine;
+                }
+                else
+                {
+                    m_idIndex.emplace(medicine.getMedicineID(), m_medicines.size());
+                    m_medicines.push_back(medicine);
+                    m_idSequence.observe(medicine.getMedicineID());
+                }
+                records.push_back({Journal::Operation::UPSERT, medicine.serialize()});
+            }
+            if (!persistRecords(records))
+            {
+                rollbackRange(oldSize, replaced, records.size());
+                return false;
+            }
+            return true;
+        }
+
+        void MedicineRepository::rollbackRange(size_t oldSize,
+                                               const std::vector<std::pair<size_t, Model::Medicine>> &replaced,
+                                               size_t recordCount)
+        {
+            // Deferred records of the batch must not reach the file on a later flush
+            discardPendingRecords(recordCount);
+
+            // Newest first, so a record replaced twice gets its original value back
+            for (auto it = replaced.rbegin(); it != replaced.rend(); ++it)
+            {
+                m_medicines[it->first] = it->second;
+            }
+
+            auto &items = m_medicines.items();
+            for (size_t slot = oldSize; slot < items.size(); ++slot)
+            {
+                m_idIndex.erase(items[slot].getMedicineID());
+            }
+            items.erase(items.begin() + static_cast<std::ptrdiff_t>(oldSize), items.end());
+        }
+
+        bool MedicineRepository::discardPendingRecords(size_t count)
+        {
+            // Already flushed (or never deferred) records cannot be taken back
+            if (m_durability.mode == DurabilityPolicy::Mode::SYNC || m_pendingChanges < count)
+            {
+                return false;
+            }
+
+            if (m_journalEnabled)
+            {
+                m_pendingRecords.erase(m_pendingRecords.end() - static_cast<std::ptrdiff_t>(count),
+                                       m_pendingRecords.end());
+            }
+            m_pendingChanges -= count;
+            return true;
         }
 
         // ==================== Persistence ====================
         bool MedicineRepository::save()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
             return saveInternal();
         }
 
@@ -148,6 +328,9 @@ namespace HMS
         {
             try
             {
+                // A background snapshot may still be writing the same file
+                m_journal.waitForCompaction();
+
                 std::vector<std::string> lines;
 
                 // Add header
@@ -161,6 +344,7 @@ namespace HMS
                         lines.push_back(headerLine);
                     }
                 }
+                lines.push_back(m_idSequence.getHeaderLine());
 
                 // Add data
                 for (const auto &medicine : m_medicines)
@@ -168,8 +352,17 @@ namespace HMS
                     lines.push_back(medicine.serialize());
                 }
 
-                FileHelper::createBackup(m_filePath);
-                return FileHelper::writeLines(m_filePath, lines);
+                if (!FileHelper::writeLines(m_filePath, lines))
+                {
+                    return false;
+                }
+                BackupWorker::getInstance()->submit(m_filePath, std::move(lines));
+
+                // Snapshot now contains every journaled change
+                m_journal.truncate();
+                m_pendingRecords.clear();
+                m_pendingChanges = 0;
+                return true;
             }
             catch (...)
             {
@@ -177,9 +370,117 @@ namespace HMS
             }
         }
 
+        bool MedicineRepository::persistUpsert(const Model::Medicine &medicine)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.push_back({Journal::Operation::UPSERT, medicine.serialize()});
+                }
+                return deferWrite(1);
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(Journal::Operation::UPSERT, medicine.serialize(),
+                                        m_medicines, "Medicine");
+            }
+            return saveInternal();
+        }
+
+        bool MedicineRepository::persistRemove(const std::string &id)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.push_back({Journal::Operation::REMOVE, id});
+                }
+                return deferWrite(1);
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(Journal::Operation::REMOVE, id, m_medicines, "Medicine");
+            }
+            return saveInternal();
+        }
+
+        bool MedicineRepository::persistRecords(const std::vector<Journal::Record> &records)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.insert(m_pendingRecords.end(), records.begin(), records.end());
+                }
+
+                // Callers may hold other repositories' locks, so this cannot wait for a batch
+                if (m_durability.mode == DurabilityPolicy::Mode::GROUP_COMMIT)
+                {
+                    m_pendingChanges += records.size();
+                    return flushPendingInternal();
+                }
+                return deferWrite(records.size());
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(records, m_medicines, "Medicine");
+            }
+            return saveInternal();
+        }
+
+        bool MedicineRepository::deferWrite(size_t changes)
+        {
+            m_pendingChanges += changes;
+            if (m_durability.mode == DurabilityPolicy::Mode::GROUP_COMMIT)
+            {
+                // Releases the lock until a leader has written this change
+                return m_groupCommit.commit(m_dataMutex, [this]
+                                            { return flushPendingInternal(); });
+            }
+
+            if (m_pendingChanges >= m_durability.maxPendingChanges)
+            {
+                return flushPendingInternal();
+            }
+
+            // Keeps the deadline of the first change since the last flush
+            m_flushScheduled = true;
+            WriteBehindFlusher::getInstance()->schedule(this, m_durability.interval, [this]
+                                                        { flush(); });
+            return true;
+        }
+
+        bool MedicineRepository::flushPendingInternal()
+        {
+            if (m_pendingChanges == 0)
+            {
+                return true;
+            }
+
+            if (!m_journalEnabled)
+            {
+                return saveInternal();
+            }
+
+            if (!m_journal.append(m_pendingRecords, m_medicines, "Medicine"))
+            {
+                return false;
+            }
+            m_pendingRecords.clear();
+            m_pendingChanges = 0;
+            return true;
+        }
+
         bool MedicineRepository::load()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+
+            // Reloading replaces the records, so deferred changes are written first
+            flushPendingInternal();
             return loadInternal();
         }
 
@@ -198,19 +499,34 @@ namespace HMS
 
                 FileHelper::createFileIfNotExists(m_filePath);
 
-                std::vector<std::string> lines = FileHelper::readLines(m_filePath);
+                m_journal.waitForCompaction();
+                MappedFile file(m_filePath);
+                std::vector<std::string_view> lines = FileHelper::readLineViews(file);
+
+                // IDs are seeded once here; removed IDs stay behind the stored mark
+                m_idSequence.reset();
+                for (std::string_view headerLine : FileHelper::readHeaderLines(file))
+                {
+                    m_idSequence.restore(headerLine);
+                }
 
-                m_medicines.clear();
+                // Chunks are parsed concurrently and merged back in file order
+                m_medicines = parseLines<Model::Medicine>(lines, &Model::Medicine::deserialize);
 
-                for (const auto &line : lines)
+                // Replay mutations logged since the last snapshot. The journal is
+                // replayed even when journal mode is off so no logged change is lost.
+                m_journal.replay(
+                    m_medicines.items(), [](const auto &item)
+                    { return item.getMedicineID(); },
+                    [this](const std::string &id)
+                    { m_idSequence.observe(id); });
+
+                for (const auto &medicine : m_medicines)
                 {
-                    auto medicine = Model::Medicine::deserialize(line);
-                    if (medicine)
-                    {
-                        m_medicines.push_back(medicine.value());
-                    }
+                    m_idSequence.observe(medicine.getMedicineID());
                 }
 
+                rebuildIndex();
                 m_isLoaded = true;
                 return true;
             }
@@ -221,39 +537,99 @@ namespace HMS
             }
         }
 
+        // ==================== Journal Mode ====================
+        void MedicineRepository::setJournalEnabled(bool enabled)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            if (m_journalEnabled == enabled)
+            {
+                return;
+            }
+
+            // Deferred changes were recorded for the current mode
+            flushPendingInternal();
+
+            if (!enabled && m_isLoaded)
+            {
+                // Fold pending records into the data file before going back to full rewrites
+                saveInternal();
+            }
+
+            m_journalEnabled = enabled;
+        }
+
+        bool MedicineRepository::isJournalEnabled() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_journalEnabled;
+        }
+
+        size_t MedicineRepository::getJournalRecordCount() const
+        {
+            auto lock = lockForRead();
+            return m_journal.getRecordCount();
+        }
+
+        void MedicineRepository::setCompactionPolicy(const Journal::CompactionPolicy &policy)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            m_journal.setCompactionPolicy(policy);
+        }
+
+        // ==================== Durability ====================
+        void MedicineRepository::setDurabilityPolicy(const DurabilityPolicy &policy)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            flushPendingInternal();
+            m_durability = policy;
+        }
+
+        DurabilityPolicy MedicineRepository::getDurabilityPolicy() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_durability;
+        }
+
+        bool MedicineRepository::flush()
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            return flushPendingInternal();
+        }
+
+        size_t MedicineRepository::getPendingChangeCount() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_pendingChanges;
+        }
+
         // ==================== Query Operations ====================
         size_t MedicineRepository::count() const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
             return m_medicines.size();
         }
 
         bool MedicineRepository::exists(const std::string &id) const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            return std::ranges::any_of(
-                m_medicines, [&id](const auto &med) {
-                    return med.getMedicineID() == id;
-                }
-            );
+            return m_idIndex.contains(id);
         }
 
         bool MedicineRepository::clear()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
             m_medicines.clear();
+            m_idIndex.clear();
             m_isLoaded = true;
+            m_idSequence.reset();
             return saveInternal();
         }
 
         // ==================== Medicine-Specific Queries ====================
         std::vector<Model::Medicine> MedicineRepository::getByCategory(const std::string &category)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Medicine> result;
             std::ranges::copy_if(
@@ -269,8 +645,7 @@ namespace HMS
 
         std::vector<Model::Medicine> MedicineRepository::getLowStock()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Medicine> result;
             std::ranges::copy_if(
@@ -286,8 +661,7 @@ namespace HMS
 
         std::vector<Model::Medicine> MedicineRepository::getExpired()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Medicine> result;
             std::ranges::copy_if(
@@ -303,8 +677,7 @@ namespace HMS
 
         std::vector<Model::Medicine> MedicineRepository::getExpiringSoon(int days)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Medicine> result;
             std::ranges::copy_if(
@@ -320,8 +693,7 @@ namespace HMS
 
         std::vector<Model::Medicine> MedicineRepository::searchByName(const std::string &name)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Medicine> result;
             std::ranges::copy_if(
@@ -338,8 +710,7 @@ namespace HMS
 
         std::vector<Model::Medicine> MedicineRepository::search(const std::string &keyword)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Medicine> result;
             std::ranges::copy_if(
@@ -359,8 +730,7 @@ namespace HMS
 
         std::vector<std::string> MedicineRepository::getAllCategories()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<std::string> categories;
             for (const auto &med : m_medicines)
@@ -379,8 +749,7 @@ namespace HMS
 
         std::vector<std::string> MedicineRepository::getAllManufacturers()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<std::string> manufacturers;
             for (const auto &med : m_medicines)
@@ -399,64 +768,28 @@ namespace HMS
 
         std::string MedicineRepository::getNextId()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
-
-            if (m_medicines.empty())
-            {
-                return std::format("{}001", Constants::MEDICINE_ID_PREFIX);
-            }
-
-            // Find max ID number
-            int maxNum = 0;
-            const std::string prefix = Constants::MEDICINE_ID_PREFIX;
-
-            for (const auto &med : m_medicines)
-            {
-                const auto &id = med.getMedicineID();
-
-                // Only process valid format: prefix + digits
-                if (id.length() > prefix.length() &&
-                    id.starts_with(prefix))
-                {
-                    std::string numPart = id.substr(prefix.length());
-
-                    // Validate numeric before parsing
-                    if (Utils::isNumeric(numPart))
-                    {
-                        try
-                        {
-                            int num = std::stoi(numPart);
-                            maxNum = std::max(maxNum, num);
-                        }
-                        catch (const std::exception &)
-                        {
-                            // Skip invalid IDs
-                        }
-                    }
-                }
-            }
+            auto lock = lockForRead();
+            return m_idSequence.peek();
+        }
 
-            return std::format("{}{:03d}", Constants::MEDICINE_ID_PREFIX, maxNum + 1);
+        std::string MedicineRepository::allocateId()
+        {
+            // Loading needs the lock; allocation itself is atomic
+            auto lock = lockForRead();
+            return m_idSequence.allocate();
         }
 
         // ==================== Stock Operations ====================
         bool MedicineRepository::updateStock(const std::string &id, int quantity)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
             if (quantity < 0)
             {
                 return false;  // The quantity must be non-negative
             }
 
-            auto it = std::ranges::find_if(
-                m_medicines,
-                [&id](const auto &med) {
-                    return med.getMedicineID() == id;
-                }
-            );
+            auto it = findById(id);
 
             if (it == m_medicines.end())
             {
@@ -464,20 +797,22 @@ namespace HMS
             }
 
             it->setQuantityInStock(quantity);
-            return saveInternal();
+            return persistUpsert(*it);
         }
 
         // ==================== File Path Management ====================
         void MedicineRepository::setFilePath(const std::string &filePath)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            flushPendingInternal();
             m_filePath = filePath;
+            m_journal.setDataFilePath(filePath);
             m_isLoaded = false; // Force reload with new file
         }
 
         std::string MedicineRepository::getFilePath() const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
             return m_filePath;
         }
 
@@ -2,11 +2,15 @@
 #include "common/Constants.h"
 #include "common/Utils.h"
 #include "dal/FileHelper.h"
+#include "dal/IdSequence.h"
+#include "dal/BackupWorker.h"
+#include "dal/LineParser.h"
 
 #include <algorithm>
 #include <filesystem>
 #include <format>
 #include <sstream>
+#include <unordered_set>
 
 namespace HMS
 {
@@ -19,8 +23,14 @@ namespace HMS
         // ==================== Private Constructor ====================
         PatientRepository::PatientRepository()
             : m_filePath(Constants::PATIENT_FILE),
-              m_isLoaded(false)
+              m_isLoaded(false),
+              m_idSequence(Constants::PATIENT_ID_PREFIX),
+              m_journal(Constants::PATIENT_FILE), m_journalEnabled(false),
+              m_pendingChanges(0), m_flushScheduled(false)
         {
+            // Snapshots written in the background must keep the sequence too
+            m_journal.setSnapshotHeader([this]
+                                        { return m_idSequence.getHeaderLine(); });
         }
 
         // ==================== Singleton Access ====================
@@ -41,7 +51,15 @@ namespace HMS
         }
 
         // ==================== Destructor ====================
-        PatientRepository::~PatientRepository() = default;
+        PatientRepository::~PatientRepository()
+        {
+            // Write-behind changes must not be lost with the instance
+            if (m_flushScheduled)
+            {
+                WriteBehindFlusher::getInstance()->cancel(this);
+            }
+            flushPendingInternal();
+        }
 
         // ==================== Private Helper ====================
         void PatientRepository::ensureLoaded() const
@@ -52,25 +70,78 @@ namespace HMS
             }
         }
 
+        std::shared_lock<std::shared_mutex> PatientRepository::lockForRead() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            if (!m_isLoaded)
+            {
+                // Loading mutates the repository, so it runs under the exclusive lock
+                lock.unlock();
+                {
+                    std::lock_guard<std::shared_mutex> writeLock(m_dataMutex);
+                    ensureLoaded();
+                }
+                lock.lock();
+            }
+            return lock;
+        }
+
+        std::unique_lock<std::shared_mutex> PatientRepository::lockForWrite()
+        {
+            std::unique_lock<std::shared_mutex> lock(m_dataMutex);
+            ensureLoaded();
+            m_patients.detach();
+            return lock;
+        }
+
+        void PatientRepository::rebuildIndex(size_t from)
+        {
+            if (from == 0)
+            {
+                m_idIndex.clear();
+                m_idIndex.reserve(m_patients.size());
+            }
+
+            for (size_t i = from; i < m_patients.size(); ++i)
+            {
+                m_idIndex[m_patients[i].getPatientID()] = i;
+            }
+        }
+
+        std::vector<Model::Patient>::iterator PatientRepository::findById(const std::string &id)
+        {
+            auto it = m_idIndex.find(id);
+            if (it == m_idIndex.end())
+            {
+                return m_patients.end();
+            }
+            return m_patients.begin() + static_cast<std::ptrdiff_t>(it->second);
+        }
+
         // ==================== CRUD Operations ====================
         std::vector<Model::Patient> PatientRepository::getAll()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
-            return m_patients;
+            auto lock = lockForRead();
+            return m_patients.items();
+        }
+
+        Snapshot<Model::Patient> PatientRepository::getSnapshot() const
+        {
+            auto lock = lockForRead();
+            return m_patients.snapshot();
+        }
+
+        ReadView<Model::Patient> PatientRepository::view() const
+        {
+            auto lock = lockForRead();
+            return ReadView<Model::Patient>(std::move(lock), m_patients.items());
         }
 
         std::optional<Model::Patient> PatientRepository::getById(const std::string &id)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            auto it = std::ranges::find_if(
-                m_patients, [&id](const auto &p)
-                {
-                    return p.getPatientID() == id;
-                }
-            );
+            auto it = findById(id);
 
             if (it != m_patients.end())
             {
@@ -81,68 +152,215 @@ namespace HMS
 
         bool PatientRepository::add(const Model::Patient &patient)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
             // Check if patient ID already exists (primary key check only)
-            bool idExists = std::ranges::any_of(
-                m_patients, [&patient](const auto &p)
-                { return p.getPatientID() == patient.getPatientID(); });
+            bool idExists = m_idIndex.contains(patient.getPatientID());
 
             if (idExists)
             {
                 return false;
             }
 
+            m_idIndex.emplace(patient.getPatientID(), m_patients.size());
             m_patients.push_back(patient);
-            return saveInternal();
+            m_idSequence.observe(patient.getPatientID());
+            return persistUpsert(patient);
         }
 
         bool PatientRepository::update(const Model::Patient &patient)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
-            auto it = std::ranges::find_if(
-                m_patients, [&patient](const auto &p)
-                {
-                    return p.getPatientID() == patient.getPatientID();
-                }
-            );
+            auto it = findById(patient.getPatientID());
 
             if (it != m_patients.end())
             {
                 *it = patient;
-                return saveInternal();
+                return persistUpsert(patient);
             }
             return false;
         }
 
         bool PatientRepository::remove(const std::string &id)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
-            auto it = std::ranges::find_if(
-                m_patients, [&id](const auto &p)
-                {
-                    return p.getPatientID() == id;
-                }
-            );
+            auto it = findById(id);
 
             if (it == m_patients.end())
             {
                 return false; // Not found
             }
 
+            const auto slot = static_cast<size_t>(it - m_patients.begin());
             m_patients.erase(it);
-            return saveInternal();
+            m_idIndex.erase(id);
+            rebuildIndex(slot);
+            return persistRemove(id);
+        }
+
+        bool PatientRepository::addRange(const std::vector<Model::Patient> &patients)
+        {
+            return addRange(patients, nullptr);
+        }
+
+        bool PatientRepository::addRange(const std::vector<Model::Patient> &patients, const UniqueKey &uniqueKey)
+        {
+            auto lock = lockForWrite();
+
+            // All or nothing: reject the batch if any ID is taken or repeated
+            std::unordered_set<std::string_view> batchIds;
+            batchIds.reserve(patients.size());
+            for (const auto &patient : patients)
+            {
+                const std::string &id = patient.getPatientID();
+                if (m_idIndex.contains(id) || !batchIds.insert(id).second)
+                {
+                    return false;
+                }
+            }
+
+            if (uniqueKey && !keepsKeysUnique(patients, uniqueKey))
+            {
+                return false;
+            }
+
+            if (patients.empty())
+            {
+                return true;
+            }
+
+            const size_t oldSize = m_patients.size();
+            std::vector<Journal::Record> records;
+            records.reserve(patients.size());
+            for (const auto &patient : patients)
+            {
+                m_idIndex.emplace(patient.getPatientID(), m_patients.size());
+                m_patients.push_back(patient);
+                m_idSequence.observe(patient.getPatientID());
+                records.push_back({Journal::Operation::UPSERT, patient.serialize()});
+            }
+            if (!persistRecords(records))
+            {
+                rollbackRange(oldSize, {}, records.size());
+                return false;
+            }
+            return true;
+        }
+
+        bool PatientRepository::upsertRange(const std::vector<Model::Patient> &patients)
+        {
+            return upsertRange(patients, nullptr);
+        }
+
+        bool PatientRepository::upsertRange(const std::vector<Model::Patient> &patients, const UniqueKey &uniqueKey)
+        {
+            auto lock = lockForWrite();
+
+            if (patients.empty())
+            {
+                return true;
+            }
+
+            if (uniqueKey && !keepsKeysUnique(patients, uniqueKey))
+            {
+                return false;
+            }
+
+            const size_t oldSize = m_patients.size();
+            std::vector<std::pair<size_t, Model::Patient>> replaced;
+            std::vector<Journal::Record> records;
+            records.reserve(patients.size());
+            for (const auto &patient : patients)
+            {
+                auto it = findById(patient.getPatientID());
+                if (it != m_patients.end())
+                {
+                    replaced.emplace_back(static_cast<size_t>(it - m_patients.begin()), *it);
+                    *it = patient;
+                }
+                else
+                {
+                    m_idIndex.emplace(patient.getPatientID(), m_patients.size());
+                    m_patients.push_back(patient);
+                    m_idSequence.observe(patient.getPatientID());
+                }
+                records.push_back({Journal::Operation::UPSERT, patient.serialize()});
+            }
+            if (!persistRecords(records))
+            {
+                rollbackRange(oldSize, replaced, records.size());
+                return false;
+            }
+            return true;
+        }
+
+        void PatientRepository::rollbackRange(size_t oldSize,
+                                              const std::vector<std::pair<size_t, Model::Patient>> &replaced,
+                                              size_t recordCount)
+        {
+            // Deferred records of the batch must not reach the file on a later flush
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.erase(m_pendingRecords.end() - static_cast<std::ptrdiff_t>(recordCount),
+                                           m_pendingRecords.end());
+                }
+                m_pendingChanges -= recordCount;
+            }
+
+            // Newest first, so a record replaced twice gets its original value back
+            for (auto it = replaced.rbegin(); it != replaced.rend(); ++it)
+            {
+                m_patients[it->first] = it->second;
+            }
+
+            auto &items = m_patients.items();
+            for (size_t slot = oldSize; slot < items.size(); ++slot)
+            {
+                m_idIndex.erase(items[slot].getPatientID());
+            }
+            items.erase(items.begin() + static_cast<std::ptrdiff_t>(oldSize), items.end());
+        }
+
+        bool PatientRepository::keepsKeysUnique(const std::vector<Model::Patient> &patients,
+                                                const UniqueKey &uniqueKey) const
+        {
+            // What each ID holds once the batch is stored: its last record in the batch
+            std::unordered_map<std::string_view, const Model::Patient *> batchById;
+            for (const auto &patient : patients)
+            {
+                batchById[patient.getPatientID()] = &patient;
+            }
+
+            // Key -> ID holding it; replaced patients give up their old key first
+            std::unordered_map<std::string_view, std::string_view> owners;
+            for (const auto &patient : m_patients)
+            {
+                const std::string &key = uniqueKey(patient);
+                if (!key.empty() && !batchById.contains(patient.getPatientID()))
+                {
+                    owners.emplace(key, patient.getPatientID());
+                }
+            }
+
+            for (const auto &[id, patient] : batchById)
+            {
+                const std::string &key = uniqueKey(*patient);
+                if (!key.empty() && !owners.emplace(key, id).second)
+                {
+                    return false;
+                }
+            }
+            return true;
         }
 
         // ==================== Persistence ====================
         bool PatientRepository::save()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
             return saveInternal();
         }
 
@@ -150,6 +368,9 @@ namespace HMS
         {
             try
             {
+                // A background snapshot may still be writing the same file
+                m_journal.waitForCompaction();
+
                 std::vector<std::string> lines;
 
                 // Add header
@@ -163,6 +384,7 @@ namespace HMS
                         lines.push_back(headerLine);
                     }
                 }
+                lines.push_back(m_idSequence.getHeaderLine());
 
                 // Add data
                 for (const auto &patient : m_patients)
@@ -170,8 +392,17 @@ namespace HMS
                     lines.push_back(patient.serialize());
                 }
 
-                FileHelper::createBackup(m_filePath);
-                return FileHelper::writeLines(m_filePath, lines);
+                if (!FileHelper::writeLines(m_filePath, lines))
+                {
+                    return false;
+                }
+                BackupWorker::getInstance()->submit(m_filePath, std::move(lines));
+
+                // Snapshot now contains every journaled change
+                m_journal.truncate();
+                m_pendingRecords.clear();
+                m_pendingChanges = 0;
+                return true;
             }
             catch (...)
             {
@@ -179,9 +410,117 @@ namespace HMS
             }
         }
 
+        bool PatientRepository::persistUpsert(const Model::Patient &patient)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.push_back({Journal::Operation::UPSERT, patient.serialize()});
+                }
+                return deferWrite(1);
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(Journal::Operation::UPSERT, patient.serialize(),
+                                        m_patients, "Patient");
+            }
+            return saveInternal();
+        }
+
+        bool PatientRepository::persistRemove(const std::string &id)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.push_back({Journal::Operation::REMOVE, id});
+                }
+                return deferWrite(1);
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(Journal::Operation::REMOVE, id, m_patients, "Patient");
+            }
+            return saveInternal();
+        }
+
+        bool PatientRepository::persistRecords(const std::vector<Journal::Record> &records)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.insert(m_pendingRecords.end(), records.begin(), records.end());
+                }
+
+                // One write covers the whole batch; no other writer needs to join it
+                if (m_durability.mode == DurabilityPolicy::Mode::GROUP_COMMIT)
+                {
+                    m_pendingChanges += records.size();
+                    return flushPendingInternal();
+                }
+                return deferWrite(records.size());
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(records, m_patients, "Patient");
+            }
+            return saveInternal();
+        }
+
+        bool PatientRepository::deferWrite(size_t changes)
+        {
+            m_pendingChanges += changes;
+            if (m_durability.mode == DurabilityPolicy::Mode::GROUP_COMMIT)
+            {
+                // Releases the lock until a leader has written this change
+                return m_groupCommit.commit(m_dataMutex, [this]
+                                            { return flushPendingInternal(); });
+            }
+
+            if (m_pendingChanges >= m_durability.maxPendingChanges)
+            {
+                return flushPendingInternal();
+            }
+
+            // Keeps the deadline of the first change since the last flush
+            m_flushScheduled = true;
+            WriteBehindFlusher::getInstance()->schedule(this, m_durability.interval, [this]
+                                                        { flush(); });
+            return true;
+        }
+
+        bool PatientRepository::flushPendingInternal()
+        {
+            if (m_pendingChanges == 0)
+            {
+                return true;
+            }
+
+            if (!m_journalEnabled)
+            {
+                return saveInternal();
+            }
+
+            if (!m_journal.append(m_pendingRecords, m_patients, "Patient"))
+            {
+                return false;
+            }
+            m_pendingRecords.clear();
+            m_pendingChanges = 0;
+            return true;
+        }
+
         bool PatientRepository::load()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+
+            // Reloading replaces the records, so deferred changes are written first
+            flushPendingInternal();
             return loadInternal();
         }
 
@@ -200,19 +539,34 @@ namespace HMS
 
                 FileHelper::createFileIfNotExists(m_filePath);
 
-                std::vector<std::string> lines = FileHelper::readLines(m_filePath);
+                m_journal.waitForCompaction();
+                MappedFile file(m_filePath);
+                std::vector<std::string_view> lines = FileHelper::readLineViews(file);
 
-                m_patients.clear();
+                // IDs are seeded once here; removed IDs stay behind the stored mark
+                m_idSequence.reset();
+                for (std::string_view headerLine : FileHelper::readHeaderLines(file))
+                {
+                    m_idSequence.restore(headerLine);
+                }
+
+                // Chunks are parsed concurrently and merged back in file order
+                m_patients = parseLines<Model::Patient>(lines, &Model::Patient::deserialize);
 
-                for (const auto &line : lines)
+                // Replay mutations logged since the last snapshot. The journal is
+                // replayed even when journal mode is off so no logged change is lost.
+                m_journal.replay(
+                    m_patients.items(), [](const auto &item)
+                    { return item.getPatientID(); },
+                    [this](const std::string &id)
+                    { m_idSequence.observe(id); });
+
+                for (const auto &patient : m_patients)
                 {
-                    auto patient = Model::Patient::deserialize(line);
-                    if (patient)
-                    {
-                        m_patients.push_back(patient.value());
-                    }
+                    m_idSequence.observe(patient.getPatientID());
                 }
 
+                rebuildIndex();
                 m_isLoaded = true;
                 return true;
             }
@@ -223,40 +577,99 @@ namespace HMS
             }
         }
 
+        // ==================== Journal Mode ====================
+        void PatientRepository::setJournalEnabled(bool enabled)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            if (m_journalEnabled == enabled)
+            {
+                return;
+            }
+
+            // Deferred changes were recorded for the current mode
+            flushPendingInternal();
+
+            if (!enabled && m_isLoaded)
+            {
+                // Fold pending records into the data file before going back to full rewrites
+                saveInternal();
+            }
+
+            m_journalEnabled = enabled;
+        }
+
+        bool PatientRepository::isJournalEnabled() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_journalEnabled;
+        }
+
+        size_t PatientRepository::getJournalRecordCount() const
+        {
+            auto lock = lockForRead();
+            return m_journal.getRecordCount();
+        }
+
+        void PatientRepository::setCompactionPolicy(const Journal::CompactionPolicy &policy)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            m_journal.setCompactionPolicy(policy);
+        }
+
+        // ==================== Durability ====================
+        void PatientRepository::setDurabilityPolicy(const DurabilityPolicy &policy)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            flushPendingInternal();
+            m_durability = policy;
+        }
+
+        DurabilityPolicy PatientRepository::getDurabilityPolicy() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_durability;
+        }
+
+        bool PatientRepository::flush()
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            return flushPendingInternal();
+        }
+
+        size_t PatientRepository::getPendingChangeCount() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_pendingChanges;
+        }
+
         // ==================== Query Operations ====================
         size_t PatientRepository::count() const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
             return m_patients.size();
         }
 
         bool PatientRepository::exists(const std::string &id) const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            return std::ranges::any_of(
-                m_patients, [&id](const auto &p)
-                {
-                    return p.getPatientID() == id;
-                }
-            );
+            return m_idIndex.contains(id);
         }
 
         bool PatientRepository::clear()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
             m_patients.clear();
+            m_idIndex.clear();
             m_isLoaded = true;
+            m_idSequence.reset();
             return saveInternal();
         }
 
         // ==================== Patient-Specific Queries ====================
         std::optional<Model::Patient> PatientRepository::getByUsername(const std::string &username)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             auto it = std::ranges::find_if(
                 m_patients, [&username](const auto &p)
@@ -274,8 +687,7 @@ namespace HMS
 
         std::vector<Model::Patient> PatientRepository::searchByName(const std::string &name)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Patient> results;
             std::ranges::copy_if(
@@ -291,8 +703,7 @@ namespace HMS
 
         std::vector<Model::Patient> PatientRepository::searchByPhone(const std::string &phone)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Patient> results;
             std::ranges::copy_if(
@@ -308,8 +719,7 @@ namespace HMS
 
         std::vector<Model::Patient> PatientRepository::search(const std::string &keyword)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Patient> results;
             std::ranges::copy_if(
@@ -332,8 +742,7 @@ namespace HMS
             const std::string &dateOfBirth,
             Gender gender)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             // Find patient without account (empty username) matching all identity fields
             for (const auto &p : m_patients)
@@ -354,58 +763,30 @@ namespace HMS
 
         std::string PatientRepository::getNextId()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
-
-            if (m_patients.empty())
-            {
-                return std::format("{}001", Constants::PATIENT_ID_PREFIX);
-            }
-
-            // Find max ID number
-            int maxID = 0;
-            const std::string prefix = Constants::PATIENT_ID_PREFIX;
-
-            for (const auto &patient : m_patients)
-            {
-                const std::string &patientID = patient.getPatientID();
-
-                // Only process valid format: prefix + digits
-                if (patientID.length() > prefix.length() &&
-                    patientID.starts_with(prefix))
-                {
-                    std::string numPart = patientID.substr(prefix.length());
-
-                    // Validate numeric before parsing
-                    if (Utils::isNumeric(numPart))
-                    {
-                        try
-                        {
-                            int idNum = std::stoi(numPart);
-                            maxID = std::max(maxID, idNum);
-                        }
-                        catch (const std::exception &)
-                        {
-                            // Ignore parse errors
-                        }
-                    }
-                }
-            }
+            auto lock = lockForRead();
+            return m_idSequence.peek();
+        }
 
-            return std::format("{}{:03d}", prefix, maxID + 1);
+        std::string PatientRepository::allocateId()
+        {
+            // Loading needs the lock; allocation itself is atomic
+            auto lock = lockForRead();
+            return m_idSequence.allocate();
         }
 
         // ==================== File Path Management ====================
         void PatientRepository::setFilePath(const std::string &filePath)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            flushPendingInternal();
             m_filePath = filePath;
+            m_journal.setDataFilePath(filePath);
             m_isLoaded = false; // Force reload with new file
         }
 
         std::string PatientRepository::getFilePath() const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
             return m_filePath;
         }
 
@@ -2,11 +2,15 @@
 #include "common/Constants.h"
 #include "common/Utils.h"
 #include "dal/FileHelper.h"
+#include "dal/IdSequence.h"
+#include "dal/BackupWorker.h"
+#include "dal/LineParser.h"
 
 #include <algorithm>
 #include <filesystem>
 #include <format>
 #include <sstream>
+#include <unordered_set>
 
 namespace HMS
 {
@@ -19,7 +23,15 @@ namespace HMS
 
         // ==================== Private Constructor ====================
         PrescriptionRepository::PrescriptionRepository()
-            : m_filePath(Constants::PRESCRIPTION_FILE), m_isLoaded(false) {}
+            : m_filePath(Constants::PRESCRIPTION_FILE), m_isLoaded(false),
+              m_idSequence(Constants::PRESCRIPTION_ID_PREFIX),
+              m_journal(Constants::PRESCRIPTION_FILE), m_journalEnabled(false),
+              m_pendingChanges(0), m_flushScheduled(false)
+        {
+            // Snapshots written in the background must keep the sequence too
+            m_journal.setSnapshotHeader([this]
+                                        { return m_idSequence.getHeaderLine(); });
+        }
 
         // ==================== Singleton Access ====================
         PrescriptionRepository *PrescriptionRepository::getInstance()
@@ -40,7 +52,15 @@ namespace HMS
         }
 
         // ==================== Destructor ====================
-        PrescriptionRepository::~PrescriptionRepository() = default;
+        PrescriptionRepository::~PrescriptionRepository()
+        {
+            // Write-behind changes must not be lost with the instance
+            if (m_flushScheduled)
+            {
+                WriteBehindFlusher::getInstance()->cancel(this);
+            }
+            flushPendingInternal();
+        }
 
         // ==================== Private Helper ====================
         void PrescriptionRepository::ensureLoaded() const
@@ -51,22 +71,101 @@ namespace HMS
             }
         }
 
+        std::shared_lock<std::shared_mutex> PrescriptionRepository::lockForRead() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            if (!m_isLoaded)
+            {
+                // Loading mutates the repository, so it runs under the exclusive lock
+                lock.unlock();
+                {
+                    std::lock_guard<std::shared_mutex> writeLock(m_dataMutex);
+                    ensureLoaded();
+                }
+                lock.lock();
+            }
+            return lock;
+        }
+
+        std::unique_lock<std::shared_mutex> PrescriptionRepository::lockForWrite()
+        {
+            std::unique_lock<std::shared_mutex> lock(m_dataMutex);
+            ensureLoaded();
+            m_prescriptions.detach();
+            return lock;
+        }
+
+        void PrescriptionRepository::rebuildIndex(size_t from)
+        {
+            if (from == 0)
+            {
+                m_idIndex.clear();
+                m_idIndex.reserve(m_prescriptions.size());
+            }
+
+            for (size_t i = from; i < m_prescriptions.size(); ++i)
+            {
+                m_idIndex[m_prescriptions[i].getPrescriptionID()] = i;
+            }
+        }
+
+        std::vector<Model::Prescription>::iterator PrescriptionRepository::findById(const std::string &id)
+        {
+            auto it = m_idIndex.find(id);
+            if (it == m_idIndex.end())
+            {
+                return m_prescriptions.end();
+            }
+            return m_prescriptions.begin() + static_cast<std::ptrdiff_t>(it->second);
+        }
+
+        void PrescriptionRepository::rebuildDateIndex()
+        {
+            m_dateIndex.clear();
+            for (const auto &p : m_prescriptions)
+            {
+                m_dateIndex.emplace(p.getPrescriptionDateValue(), p.getPrescriptionID());
+            }
+        }
+
+        void PrescriptionRepository::unindexByDate(const Model::Prescription &prescription)
+        {
+            auto [first, last] = m_dateIndex.equal_range(prescription.getPrescriptionDateValue());
+            for (auto it = first; it != last; ++it)
+            {
+                if (it->second == prescription.getPrescriptionID())
+                {
+                    m_dateIndex.erase(it);
+                    return;
+                }
+            }
+        }
+
         // ==================== CRUD Operations ====================
         std::vector<Model::Prescription> PrescriptionRepository::getAll()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
-            return m_prescriptions;
+            auto lock = lockForRead();
+            return m_prescriptions.items();
+        }
+
+        Snapshot<Model::Prescription> PrescriptionRepository::getSnapshot() const
+        {
+            auto lock = lockForRead();
+            return m_prescriptions.snapshot();
+        }
+
+        ReadView<Model::Prescription> PrescriptionRepository::view() const
+        {
+            auto lock = lockForRead();
+            return ReadView<Model::Prescription>(std::move(lock), m_prescriptions.items());
         }
 
         std::optional<Model::Prescription>
         PrescriptionRepository::getById(const std::string &id)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            auto it = std::ranges::find_if(m_prescriptions, [&id](const auto &p)
-                                           { return p.getPrescriptionID() == id; });
+            auto it = findById(id);
 
             if (it != m_prescriptions.end())
             {
@@ -77,61 +176,185 @@ namespace HMS
 
         bool PrescriptionRepository::add(const Model::Prescription &prescription)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
             // Check if prescription ID already exists (primary key check only)
-            bool idExists = std::ranges::any_of(
-                m_prescriptions, [&prescription](const auto &p)
-                { return p.getPrescriptionID() == prescription.getPrescriptionID(); });
+            bool idExists = m_idIndex.contains(prescription.getPrescriptionID());
 
             if (idExists)
             {
                 return false;
             }
 
+            m_idIndex.emplace(prescription.getPrescriptionID(), m_prescriptions.size());
             m_prescriptions.push_back(prescription);
-            return saveInternal();
+            m_idSequence.observe(prescription.getPrescriptionID());
+            m_dateIndex.emplace(prescription.getPrescriptionDateValue(), prescription.getPrescriptionID());
+            return persistUpsert(prescription);
         }
 
         bool PrescriptionRepository::update(const Model::Prescription &prescription)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
-            auto it =
-                std::ranges::find_if(m_prescriptions, [&prescription](const auto &p)
-                                     { return p.getPrescriptionID() == prescription.getPrescriptionID(); });
+            auto it = findById(prescription.getPrescriptionID());
 
             if (it != m_prescriptions.end())
             {
+                // Prescription date may have changed
+                unindexByDate(*it);
                 *it = prescription;
-                return saveInternal();
+                m_dateIndex.emplace(prescription.getPrescriptionDateValue(), prescription.getPrescriptionID());
+                return persistUpsert(prescription);
             }
             return false;
         }
 
         bool PrescriptionRepository::remove(const std::string &id)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
-            auto it = std::ranges::find_if(m_prescriptions, [&id](const auto &p)
-                                           { return p.getPrescriptionID() == id; });
+            auto it = findById(id);
 
             if (it == m_prescriptions.end())
             {
                 return false;
             }
 
+            unindexByDate(*it);
+            const auto slot = static_cast<size_t>(it - m_prescriptions.begin());
             m_prescriptions.erase(it);
-            return saveInternal();
+            m_idIndex.erase(id);
+            rebuildIndex(slot);
+            return persistRemove(id);
+        }
+
+        bool PrescriptionRepository::addRange(const std::vector<Model::Prescription> &prescriptions)
+        {
+            auto lock = lockForWrite();
+
+            // All or nothing: reject the batch if any ID is taken or repeated
+            std::unordered_set<std::string_view> batchIds;
+            batchIds.reserve(prescriptions.size());
+            for (const auto &prescription : prescriptions)
+            {
+                const std::string &id = prescription.getPrescriptionID();
+                if (m_idIndex.contains(id) || !batchIds.insert(id).second)
+                {
+                    return false;
+                }
+            }
+
+            if (prescriptions.empty())
+            {
+                return true;
+            }
+
+            const size_t oldSize = m_prescriptions.size();
+            std::vector<Journal::Record> records;
+            records.reserve(prescriptions.size());
+            for (const auto &prescription : prescriptions)
+            {
+                m_idIndex.emplace(prescription.getPrescriptionID(), m_prescriptions.size());
+                m_prescriptions.push_back(prescription);
+                m_idSequence.observe(prescription.getPrescriptionID());
+                m_dateIndex.emplace(prescription.getPrescriptionDateValue(), prescription.getPrescriptionID());
+                records.push_back({Journal::Operation::UPSERT, prescription.serialize()});
+            }
+            if (!persistRecords(records))
+            {
+                rollbackRange(oldSize, {}, records.size());
+                return false;
+            }
+            return true;
+        }
+
+        bool PrescriptionRepository::upsertRange(const std::vector<Model::Prescription> &prescriptions)
+        {
+            auto lock = lockForWrite();
+
+            if (prescriptions.empty())
+            {
+                return true;
+            }
+
+            const size_t oldSize = m_prescriptions.size();
+            std::vector<std::pair<size_t, Model::Prescription>> replaced;
+            std::vector<Journal::Record> records;
+            records.reserve(prescriptions.size());
+            for (const auto &prescription : prescriptions)
+            {
+                auto it = findById(prescription.getPrescriptionID());
+                if (it != m_prescriptions.end())
+                {
+                    replaced.emplace_back(static_cast<size_t>(it - m_prescriptions.begin()), *it);
+                    unindexByDate(*it);
+                    *it = prescription;
+                    m_dateIndex.emplace(prescription.getPrescriptionDateValue(), prescription.getPrescriptionID());
+                }
+                else
+                {
+                    m_idIndex.emplace(prescription.getPrescriptionID(), m_prescriptions.size());
+                    m_prescriptions.push_back(prescription);
+                    m_idSequence.observe(prescription.getPrescriptionID());
+                    m_dateIndex.emplace(prescription.getPrescriptionDateValue(), prescription.getPrescriptionID());
+                }
+                records.push_back({Journal::Operation::UPSERT, prescription.serialize()});
+            }
+            if (!persistRecords(records))
+            {
+                rollbackRange(oldSize, replaced, records.size());
+                return false;
+            }
+            return true;
+        }
+
+        void PrescriptionRepository::rollbackRange(size_t oldSize,
+                                                   const std::vector<std::pair<size_t, Model::Prescription>> &replaced,
+                                                   size_t recordCount)
+        {
+            // Deferred records of the batch must not reach the file on a later flush
+            discardPendingRecords(recordCount);
+
+            // Newest first, so a record replaced twice gets its original value back
+            for (auto it = replaced.rbegin(); it != replaced.rend(); ++it)
+            {
+                auto &stored = m_prescriptions[it->first];
+                unindexByDate(stored);
+                stored = it->second;
+                m_dateIndex.emplace(stored.getPrescriptionDateValue(), stored.getPrescriptionID());
+            }
+
+            auto &items = m_prescriptions.items();
+            for (size_t slot = oldSize; slot < items.size(); ++slot)
+            {
+                unindexByDate(items[slot]);
+                m_idIndex.erase(items[slot].getPrescriptionID());
+            }
+            items.erase(items.begin() + static_cast<std::ptrdiff_t>(oldSize), items.end());
+        }
+
+        bool PrescriptionRepository::discardPendingRecords(size_t count)
+        {
+            // Already flushed (or never deferred) records cannot be taken back
+            if (m_durability.mode == DurabilityPolicy::Mode::SYNC || m_pendingChanges < count)
+            {
+                return false;
+            }
+
+            if (m_journalEnabled)
+            {
+                m_pendingRecords.erase(m_pendingRecords.end() - static_cast<std::ptrdiff_t>(count),
+                                       m_pendingRecords.end());
+            }
+            m_pendingChanges -= count;
+            return true;
         }
 
         // ==================== Persistence ====================
         bool PrescriptionRepository::save()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
             return saveInternal();
         }
 
@@ -139,6 +362,9 @@ namespace HMS
         {
             try
             {
+                // A background snapshot may still be writing the same file
+                m_journal.waitForCompaction();
+
                 std::vector<std::string> lines;
 
                 // Add header
@@ -152,6 +378,7 @@ namespace HMS
                         lines.push_back(headerLine);
                     }
                 }
+                lines.push_back(m_idSequence.getHeaderLine());
 
                 // Add data - complex items serialization is handled by
                 // Prescription::serialize()
@@ -160,8 +387,17 @@ namespace HMS
                     lines.push_back(prescription.serialize());
                 }
 
-                FileHelper::createBackup(m_filePath);
-                return FileHelper::writeLines(m_filePath, lines);
+                if (!FileHelper::writeLines(m_filePath, lines))
+                {
+                    return false;
+                }
+                BackupWorker::getInstance()->submit(m_filePath, std::move(lines));
+
+                // Snapshot now contains every journaled change
+                m_journal.truncate();
+                m_pendingRecords.clear();
+                m_pendingChanges = 0;
+                return true;
             }
             catch (...)
             {
@@ -169,9 +405,117 @@ namespace HMS
             }
         }
 
+        bool PrescriptionRepository::persistUpsert(const Model::Prescription &prescription)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.push_back({Journal::Operation::UPSERT, prescription.serialize()});
+                }
+                return deferWrite(1);
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(Journal::Operation::UPSERT, prescription.serialize(),
+                                        m_prescriptions, "Prescription");
+            }
+            return saveInternal();
+        }
+
+        bool PrescriptionRepository::persistRemove(const std::string &id)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.push_back({Journal::Operation::REMOVE, id});
+                }
+                return deferWrite(1);
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(Journal::Operation::REMOVE, id, m_prescriptions, "Prescription");
+            }
+            return saveInternal();
+        }
+
+        bool PrescriptionRepository::persistRecords(const std::vector<Journal::Record> &records)
+        {
+            if (m_durability.mode != DurabilityPolicy::Mode::SYNC)
+            {
+                if (m_journalEnabled)
+                {
+                    m_pendingRecords.insert(m_pendingRecords.end(), records.begin(), records.end());
+                }
+
+                // Callers may hold other repositories' locks, so this cannot wait for a batch
+                if (m_durability.mode == DurabilityPolicy::Mode::GROUP_COMMIT)
+                {
+                    m_pendingChanges += records.size();
+                    return flushPendingInternal();
+                }
+                return deferWrite(records.size());
+            }
+
+            if (m_journalEnabled)
+            {
+                return m_journal.append(records, m_prescriptions, "Prescription");
+            }
+            return saveInternal();
+        }
+
+        bool PrescriptionRepository::deferWrite(size_t changes)
+        {
+            m_pendingChanges += changes;
+            if (m_durability.mode == DurabilityPolicy::Mode::GROUP_COMMIT)
+            {
+                // Releases the lock until a leader has written this change
+                return m_groupCommit.commit(m_dataMutex, [this]
+                                            { return flushPendingInternal(); });
+            }
+
+            if (m_pendingChanges >= m_durability.maxPendingChanges)
+            {
+                return flushPendingInternal();
+            }
+
+            // Keeps the deadline of the first change since the last flush
+            m_flushScheduled = true;
+            WriteBehindFlusher::getInstance()->schedule(this, m_durability.interval, [this]
+                                                        { flush(); });
+            return true;
+        }
+
+        bool PrescriptionRepository::flushPendingInternal()
+        {
+            if (m_pendingChanges == 0)
+            {
+                return true;
+            }
+
+            if (!m_journalEnabled)
+            {
+                return saveInternal();
+            }
+
+            if (!m_journal.append(m_pendingRecords, m_prescriptions, "Prescription"))
+            {
+                return false;
+            }
+            m_pendingRecords.clear();
+            m_pendingChanges = 0;
+            return true;
+        }
+
         bool PrescriptionRepository::load()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+
+            // Reloading replaces the records, so deferred changes are written first
+            flushPendingInternal();
             return loadInternal();
         }
 
@@ -190,20 +534,35 @@ namespace HMS
 
                 FileHelper::createFileIfNotExists(m_filePath);
 
-                std::vector<std::string> lines = FileHelper::readLines(m_filePath);
+                m_journal.waitForCompaction();
+                MappedFile file(m_filePath);
+                std::vector<std::string_view> lines = FileHelper::readLineViews(file);
 
-                m_prescriptions.clear();
+                // IDs are seeded once here; removed IDs stay behind the stored mark
+                m_idSequence.reset();
+                for (std::string_view headerLine : FileHelper::readHeaderLines(file))
+                {
+                    m_idSequence.restore(headerLine);
+                }
 
-                for (const auto &line : lines)
+                // Chunks are parsed concurrently and merged back in file order
+                m_prescriptions = parseLines<Model::Prescription>(lines, &Model::Prescription::deserialize);
+
+                // Replay mutations logged since the last snapshot. The journal is
+                // replayed even when journal mode is off so no logged change is lost.
+                m_journal.replay(
+                    m_prescriptions.items(), [](const auto &item)
+                    { return item.getPrescriptionID(); },
+                    [this](const std::string &id)
+                    { m_idSequence.observe(id); });
+
+                for (const auto &prescription : m_prescriptions)
                 {
-                    // Prescription::deserialize() handles complex items parsing
-                    auto prescription = Model::Prescription::deserialize(line);
-                    if (prescription)
-                    {
-                        m_prescriptions.push_back(prescription.value());
-                    }
+                    m_idSequence.observe(prescription.getPrescriptionID());
                 }
 
+                rebuildIndex();
+                rebuildDateIndex();
                 m_isLoaded = true;
                 return true;
             }
@@ -214,28 +573,93 @@ namespace HMS
             }
         }
 
+        // ==================== Journal Mode ====================
+        void PrescriptionRepository::setJournalEnabled(bool enabled)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            if (m_journalEnabled == enabled)
+            {
+                return;
+            }
+
+            // Deferred changes were recorded for the current mode
+            flushPendingInternal();
+
+            if (!enabled && m_isLoaded)
+            {
+                // Fold pending records into the data file before going back to full rewrites
+                saveInternal();
+            }
+
+            m_journalEnabled = enabled;
+        }
+
+        bool PrescriptionRepository::isJournalEnabled() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_journalEnabled;
+        }
+
+        size_t PrescriptionRepository::getJournalRecordCount() const
+        {
+            auto lock = lockForRead();
+            return m_journal.getRecordCount();
+        }
+
+        void PrescriptionRepository::setCompactionPolicy(const Journal::CompactionPolicy &policy)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            m_journal.setCompactionPolicy(policy);
+        }
+
+        // ==================== Durability ====================
+        void PrescriptionRepository::setDurabilityPolicy(const DurabilityPolicy &policy)
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            flushPendingInternal();
+            m_durability = policy;
+        }
+
+        DurabilityPolicy PrescriptionRepository::getDurabilityPolicy() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_durability;
+        }
+
+        bool PrescriptionRepository::flush()
+        {
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            return flushPendingInternal();
+        }
+
+        size_t PrescriptionRepository::getPendingChangeCount() const
+        {
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
+            return m_pendingChanges;
+        }
+
         // ==================== Query Operations ====================
         size_t PrescriptionRepository::count() const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
             return m_prescriptions.size();
         }
 
         bool PrescriptionRepository::exists(const std::string &id) const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
-            return std::ranges::any_of(m_prescriptions, [&id](const auto &p)
-                                       { return p.getPrescriptionID() == id; });
+            return m_idIndex.contains(id);
         }
 
         bool PrescriptionRepository::clear()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
             m_prescriptions.clear();
+            m_idIndex.clear();
+            m_dateIndex.clear();
             m_isLoaded = true;
+            m_idSequence.reset();
             return saveInternal();
         }
 
@@ -243,8 +667,7 @@ namespace HMS
         std::optional<Model::Prescription>
         PrescriptionRepository::getByAppointment(const std::string &appointmentID)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             auto it =
                 std::ranges::find_if(m_prescriptions, [&appointmentID](const auto &p)
@@ -260,19 +683,25 @@ namespace HMS
         std::vector<Model::Prescription>
         PrescriptionRepository::getByPatient(const std::string &patientUsername)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
+            // A username no record has interned cannot match anything
             std::vector<Model::Prescription> results;
+            auto patient = InternedString::lookup(patientUsername);
+            if (!patient)
+            {
+                return results;
+            }
+
             std::ranges::copy_if(m_prescriptions, std::back_inserter(results),
-                                 [&patientUsername](const auto &p)
+                                 [&patient](const auto &p)
                                  {
-                                     return p.getPatientUsername() == patientUsername;
+                                     return p.getPatientHandle() == *patient;
                                  });
 
             // Sort by date descending (most recent first)
             std::ranges::sort(results, [](const auto &a, const auto &b)
-                              { return Utils::compareDates(a.getPrescriptionDate(), b.getPrescriptionDate()) > 0; });
+                              { return a.getPrescriptionDateValue() > b.getPrescriptionDateValue(); });
 
             return results;
         }
@@ -280,26 +709,30 @@ namespace HMS
         std::vector<Model::Prescription>
         PrescriptionRepository::getByDoctor(const std::string &doctorID)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Prescription> results;
+            auto doctor = InternedString::lookup(doctorID);
+            if (!doctor)
+            {
+                return results;
+            }
+
             std::ranges::copy_if(
                 m_prescriptions, std::back_inserter(results),
-                [&doctorID](const auto &p)
-                { return p.getDoctorID() == doctorID; });
+                [&doctor](const auto &p)
+                { return p.getDoctorHandle() == *doctor; });
 
             // Sort by date descending (most recent first)
             std::ranges::sort(results, [](const auto &a, const auto &b)
-                              { return Utils::compareDates(a.getPrescriptionDate(), b.getPrescriptionDate()) > 0; });
+                              { return a.getPrescriptionDateValue() > b.getPrescriptionDateValue(); });
 
             return results;
         }
 
         std::vector<Model::Prescription> PrescriptionRepository::getUndispensed()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Prescription> results;
             std::ranges::copy_if(m_prescriptions, std::back_inserter(results),
@@ -308,15 +741,14 @@ namespace HMS
 
             // Sort by date ascending (oldest first - priority for dispensing)
             std::ranges::sort(results, [](const auto &a, const auto &b)
-                              { return Utils::compareDates(a.getPrescriptionDate(), b.getPrescriptionDate()) < 0; });
+                              { return a.getPrescriptionDateValue() < b.getPrescriptionDateValue(); });
 
             return results;
         }
 
         std::vector<Model::Prescription> PrescriptionRepository::getDispensed()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Prescription> results;
             std::ranges::copy_if(m_prescriptions, std::back_inserter(results),
@@ -325,7 +757,7 @@ namespace HMS
 
             // Sort by date descending (most recent first)
             std::ranges::sort(results, [](const auto &a, const auto &b)
-                              { return Utils::compareDates(a.getPrescriptionDate(), b.getPrescriptionDate()) > 0; });
+                              { return a.getPrescriptionDateValue() > b.getPrescriptionDateValue(); });
 
             return results;
         }
@@ -333,14 +765,20 @@ namespace HMS
         std::vector<Model::Prescription>
         PrescriptionRepository::getByDate(const std::string &date)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Prescription> results;
-            std::ranges::copy_if(
-                m_prescriptions, std::back_inserter(results),
-                [&date](const auto &p)
-                { return p.getPrescriptionDate() == date; });
+            auto day = Date::parse(date);
+            if (!day)
+            {
+                return results;
+            }
+
+            auto [first, last] = m_dateIndex.equal_range(*day);
+            for (auto it = first; it != last; ++it)
+            {
+                results.push_back(m_prescriptions[m_idIndex.at(it->second)]);
+            }
 
             return results;
         }
@@ -349,21 +787,23 @@ namespace HMS
         PrescriptionRepository::getByDateRange(const std::string &startDate,
                                                const std::string &endDate)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Prescription> results;
-            std::ranges::copy_if(m_prescriptions, std::back_inserter(results),
-                                 [&startDate, &endDate](const auto &p)
-                                 {
-                                     const std::string &date = p.getPrescriptionDate();
-                                     return Utils::compareDates(date, startDate) >= 0 &&
-                                            Utils::compareDates(date, endDate) <= 0;
-                                 });
+            auto start = Date::parse(startDate);
+            auto end = Date::parse(endDate);
+            if (!start || !end || *start > *end)
+            {
+                return results;
+            }
 
-            // Sort by date descending (most recent first)
-            std::ranges::sort(results, [](const auto &a, const auto &b)
-                              { return Utils::compareDates(a.getPrescriptionDate(), b.getPrescriptionDate()) > 0; });
+            // Walk the date index backwards: most recent first
+            auto first = m_dateIndex.lower_bound(*start);
+            auto last = m_dateIndex.upper_bound(*end);
+            for (auto it = std::make_reverse_iterator(last); it != std::make_reverse_iterator(first); ++it)
+            {
+                results.push_back(m_prescriptions[m_idIndex.at(it->second)]);
+            }
 
             return results;
         }
@@ -371,17 +811,22 @@ namespace HMS
         std::vector<Model::Prescription>
         PrescriptionRepository::getByMedicine(const std::string &medicineID)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForRead();
 
             std::vector<Model::Prescription> results;
+            auto medicine = InternedString::lookup(medicineID);
+            if (!medicine)
+            {
+                return results;
+            }
+
             for (const auto &prescription : m_prescriptions)
             {
                 const auto &items = prescription.getItems();
                 // Check if any item in this prescription contains the medicineID
                 bool hasMedicine =
-                    std::ranges::any_of(items, [&medicineID](const auto &item)
-                                        { return item.medicineID == medicineID; });
+                    std::ranges::any_of(items, [&medicine](const auto &item)
+                                        { return item.medicineID == *medicine; });
 
                 if (hasMedicine)
                 {
@@ -394,55 +839,23 @@ namespace HMS
 
         std::string PrescriptionRepository::getNextId()
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
-
-            if (m_prescriptions.empty())
-            {
-                return std::format("{}001", Constants::PRESCRIPTION_ID_PREFIX);
-            }
-
-            // Find max ID number
-            int maxID = 0;
-            const std::string prefix = Constants::PRESCRIPTION_ID_PREFIX;
-
-            for (const auto &prescription : m_prescriptions)
-            {
-                const std::string &prescriptionID = prescription.getPrescriptionID();
-
-                // Only process valid format: prefix + digits
-                if (prescriptionID.length() > prefix.length() &&
-                    prescriptionID.starts_with(prefix))
-                {
-                    std::string numPart = prescriptionID.substr(prefix.length());
-
-                    // Validate numeric before parsing
-                    if (Utils::isNumeric(numPart))
-                    {
-                        try
-                        {
-                            int idNum = std::stoi(numPart);
-                            maxID = std::max(maxID, idNum);
-                        }
-                        catch (const std::exception &)
-                        {
-                            // Ignore parse errors
-                        }
-                    }
-                }
-            }
+            auto lock = lockForRead();
+            return m_idSequence.peek();
+        }
 
-            return std::format("{}{:03d}", prefix, maxID + 1);
+        std::string PrescriptionRepository::allocateId()
+        {
+            // Loading needs the lock; allocation itself is atomic
+            auto lock = lockForRead();
+            return m_idSequence.allocate();
         }
 
         // ==================== Dispensing Operations ====================
         bool PrescriptionRepository::markAsDispensed(const std::string &id)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
-            auto it = std::ranges::find_if(m_prescriptions, [&id](const auto &p)
-                                           { return p.getPrescriptionID() == id; });
+            auto it = findById(id);
 
             if (it == m_prescriptions.end())
             {
@@ -456,16 +869,14 @@ namespace HMS
             }
 
             it->setDispensed(true);
-            return saveInternal();
+            return persistUpsert(*it);
         }
 
         bool PrescriptionRepository::markAsUndispensed(const std::string &id)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
-            ensureLoaded();
+            auto lock = lockForWrite();
 
-            auto it = std::ranges::find_if(m_prescriptions, [&id](const auto &p)
-                                           { return p.getPrescriptionID() == id; });
+            auto it = findById(id);
 
             if (it == m_prescriptions.end())
             {
@@ -479,20 +890,22 @@ namespace HMS
             }
 
             it->setDispensed(false);
-            return saveInternal();
+            return persistUpsert(*it);
         }
 
         // ==================== File Path Management ====================
         void PrescriptionRepository::setFilePath(const std::string &filePath)
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::lock_guard<std::shared_mutex> lock(m_dataMutex);
+            flushPendingInternal();
             m_filePath = filePath;
+            m_journal.setDataFilePath(filePath);
             m_isLoaded = false; // Force reload with new file
         }
 
         std::string PrescriptionRepository::getFilePath() const
         {
-            std::lock_guard<std::mutex> lock(m_dataMutex);
+            std::shared_lock<std::shared_mutex> lock(m_dataMutex);
             return m_filePath;
         }
 
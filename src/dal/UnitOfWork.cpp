@@ -0,0 +1,162 @@
+#include "dal/UnitOfWork.h"
+#include "dal/DataSnapshot.h"
+#include "dal/MedicineRepository.h"
+#include "dal/PrescriptionRepository.h"
+
+#include <algorithm>
+#include <shared_mutex>
+
+namespace HMS
+{
+    namespace DAL
+    {
+        // ==================== Staging ====================
+        void UnitOfWork::adjustStock(const std::string &medicineID, int delta)
+        {
+            m_stockDeltas[medicineID] += delta;
+        }
+
+        void UnitOfWork::markDispensed(const std::string &prescriptionID)
+        {
+            if (std::ranges::find(m_dispensed, prescriptionID) == m_dispensed.end())
+            {
+                m_dispensed.push_back(prescriptionID);
+            }
+        }
+
+        bool UnitOfWork::isEmpty() const
+        {
+            return m_stockDeltas.empty() && m_dispensed.empty();
+        }
+
+        // ==================== Commit ====================
+        bool UnitOfWork::commit()
+        {
+            m_failedMedicines.clear();
+            m_failedPrescriptions.clear();
+            m_committedMedicines.clear();
+
+            MedicineRepository *medicineRepo = MedicineRepository::getInstance();
+            PrescriptionRepository *prescriptionRepo = PrescriptionRepository::getInstance();
+
+            // Global lock order (DataSnapshot::Source): medicines before prescriptions
+            static_assert(DataSnapshot::MEDICINES < DataSnapshot::PRESCRIPTIONS);
+            std::unique_lock<std::shared_mutex> medicineLock;
+            std::unique_lock<std::shared_mutex> prescriptionLock;
+            if (!m_stockDeltas.empty())
+                medicineLock = medicineRepo->lockForWrite();
+            if (!m_dispensed.empty())
+                prescriptionLock = prescriptionRepo->lockForWrite();
+
+            // Validate everything before changing anything
+            for (const auto &[id, delta] : m_stockDeltas)
+            {
+                auto it = medicineRepo->findById(id);
+                if (it == medicineRepo->m_medicines.end() || it->getQuantityInStock() + delta < 0)
+                {
+                    m_failedMedicines.push_back(id);
+                }
+            }
+            for (const auto &id : m_dispensed)
+            {
+                auto it = prescriptionRepo->findById(id);
+                if (it == prescriptionRepo->m_prescriptions.end() || it->isDispensed())
+                {
+                    m_failedPrescriptions.push_back(id);
+                }
+            }
+            if (!m_failedMedicines.empty() || !m_failedPrescriptions.empty())
+            {
+                return false;
+            }
+
+            // Apply, keeping the previous records to undo a failed write
+            std::vector<Model::Medicine> previousMedicines;
+            std::vector<Journal::Record> medicineRecords;
+            for (const auto &[id, delta] : m_stockDeltas)
+            {
+                auto it = medicineRepo->findById(id);
+                previousMedicines.push_back(*it);
+                it->setQuantityInStock(it->getQuantityInStock() + delta);
+                medicineRecords.push_back({Journal::Operation::UPSERT, it->serialize()});
+            }
+
+            std::vector<Model::Prescription> previousPrescriptions;
+            std::vector<Journal::Record> prescriptionRecords;
+            for (const auto &id : m_dispensed)
+            {
+                auto it = prescriptionRepo->findById(id);
+                previousPrescriptions.push_back(*it);
+                it->setDispensed(true);
+                prescriptionRecords.push_back({Journal::Operation::UPSERT, it->serialize()});
+            }
+
+            auto undo = [&]()
+            {
+                for (const auto &medicine : previousMedicines)
+                {
+                    *medicineRepo->findById(medicine.getMedicineID()) = medicine;
+                }
+                for (const auto &prescription : previousPrescriptions)
+                {
+                    *prescriptionRepo->findById(prescription.getPrescriptionID()) = prescription;
+                }
+            };
+
+            if (!medicineRecords.empty() && !medicineRepo->persistRecords(medicineRecords))
+            {
+                // Records left queued by a failed deferred write would reach the file later
+                medicineRepo->discardPendingRecords(medicineRecords.size());
+                undo();
+                return false;
+            }
+
+            if (!prescriptionRecords.empty() && !prescriptionRepo->persistRecords(prescriptionRecords))
+            {
+                prescriptionRepo->discardPendingRecords(prescriptionRecords.size());
+                undo();
+
+                // Unless the stock change is still queued, it is on disk; write the old stock back
+                if (!previousMedicines.empty() && !medicineRepo->discardPendingRecords(medicineRecords.size()))
+                {
+                    std::vector<Journal::Record> undoRecords;
+                    for (const auto &medicine : previousMedicines)
+                    {
+                        undoRecords.push_back({Journal::Operation::UPSERT, medicine.serialize()});
+                    }
+                    medicineRepo->persistRecords(undoRecords);
+                }
+                return false;
+            }
+
+            for (const auto &[id, delta] : m_stockDeltas)
+            {
+                m_committedMedicines.emplace(id, *medicineRepo->findById(id));
+            }
+            m_stockDeltas.clear();
+            m_dispensed.clear();
+            return true;
+        }
+
+        const std::vector<std::string> &UnitOfWork::getFailedMedicines() const
+        {
+            return m_failedMedicines;
+        }
+
+        const std::vector<std::string> &UnitOfWork::getFailedPrescriptions() const
+        {
+            return m_failedPrescriptions;
+        }
+
+        std::optional<Model::Medicine> UnitOfWork::getCommittedMedicine(const std::string &medicineID) const
+        {
+            auto it = m_committedMedicines.find(medicineID);
+            if (it == m_committedMedicines.end())
+            {
+                return std::nullopt;
+            }
+            return it->second;
+        }
+
+    } // namespace DAL
+} // namespace HMS
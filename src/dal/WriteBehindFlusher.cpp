@@ -0,0 +1,116 @@
+#include "dal/WriteBehindFlusher.h"
+
+namespace HMS
+{
+    namespace DAL
+    {
+        // ==================== Private Constructor ====================
+        WriteBehindFlusher::WriteBehindFlusher()
+            : m_running(nullptr), m_flushRequested(false)
+        {
+            m_thread = std::thread(&WriteBehindFlusher::run, this);
+        }
+
+        // ==================== Singleton Access ====================
+        WriteBehindFlusher *WriteBehindFlusher::getInstance()
+        {
+            // Leaked on purpose: repository destructors run during static destruction
+            static WriteBehindFlusher *flusher = new WriteBehindFlusher();
+            return flusher;
+        }
+
+        // ==================== Scheduling ====================
+        void WriteBehindFlusher::schedule(const void *owner, std::chrono::milliseconds delay,
+                                          std::function<void()> flush)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_queueMutex);
+                const auto deadline = Clock::now() + delay;
+                auto [it, inserted] = m_scheduled.try_emplace(owner, ScheduledFlush{deadline, std::move(flush)});
+                if (!inserted && deadline >= it->second.deadline)
+                {
+                    return;
+                }
+                it->second.deadline = deadline;
+            }
+            m_wake.notify_one();
+        }
+
+        void WriteBehindFlusher::cancel(const void *owner)
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_scheduled.erase(owner);
+            m_idle.notify_all();
+            m_idle.wait(lock, [this, owner]
+                        { return m_running != owner; });
+        }
+
+        void WriteBehindFlusher::flushAll()
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            if (m_scheduled.empty() && !m_running)
+            {
+                return;
+            }
+
+            m_flushRequested = true;
+            m_wake.notify_one();
+            m_idle.wait(lock, [this]
+                        { return m_scheduled.empty() && !m_running; });
+        }
+
+        size_t WriteBehindFlusher::getScheduledCount() const
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            return m_scheduled.size() + (m_running ? 1 : 0);
+        }
+
+        // ==================== Worker Loop ====================
+        void WriteBehindFlusher::run()
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            while (true)
+            {
+                if (m_scheduled.empty())
+                {
+                    m_flushRequested = false;
+                    m_wake.wait(lock);
+                    continue;
+                }
+
+                auto due = m_scheduled.begin();
+                for (auto it = m_scheduled.begin(); it != m_scheduled.end(); ++it)
+                {
+                    if (it->second.deadline < due->second.deadline)
+                        due = it;
+                }
+
+                if (!m_flushRequested && due->second.deadline > Clock::now())
+                {
+                    m_wake.wait_until(lock, due->second.deadline);
+                    continue;
+                }
+
+                const void *owner = due->first;
+                std::function<void()> flush = std::move(due->second.flush);
+                m_scheduled.erase(due);
+                m_running = owner;
+
+                lock.unlock();
+                try
+                {
+                    flush();
+                }
+                catch (...)
+                {
+                    // Changes stay pending in the repository until its next flush
+                }
+                lock.lock();
+
+                m_running = nullptr;
+                m_idle.notify_all();
+            }
+        }
+
+    } // namespace DAL
+} // namespace HMS
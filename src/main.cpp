@@ -4,6 +4,10 @@
  *
  * This file initializes the system, loads data, and starts
  * the console user interface.
+ *
+ * Usage: HospitalApp [--early-login]
+ *   --early-login  Show the login prompt once accounts are loaded and
+ *                  finish loading the other data files in the background
  */
 
 #include "ui/HMSFacade.h"
@@ -11,16 +15,26 @@
 
 #include <iostream>
 #include <exception>
+#include <string_view>
 
-int main()
+int main(int argc, char *argv[])
 {
     try
     {
+        bool earlyLogin = false;
+        for (int i = 1; i < argc; ++i)
+        {
+            if (std::string_view(argv[i]) == "--early-login")
+            {
+                earlyLogin = true;
+            }
+        }
+
         // Get the facade instance
         HMS::UI::HMSFacade *facade = HMS::UI::HMSFacade::getInstance();
 
         // Initialize the system (loads all data)
-        if (!facade->initialize())
+        if (!facade->initialize(earlyLogin))
         {
             std::cerr << "Lỗi: Thất bại trong việc khởi tạo hệ thống." << std::endl;
             return 1;
@@ -2,6 +2,7 @@
 #include "common/Types.h"
 #include "common/Utils.h"
 #include "common/Constants.h"
+#include <array>
 #include <iostream>
 #include <format>
 
@@ -25,12 +26,12 @@ namespace HMS
 
         // ==================== Getters ====================
 
-        std::string Account::getUsername() const
+        const std::string &Account::getUsername() const
         {
             return m_username;
         }
 
-        std::string Account::getPasswordHash() const
+        const std::string &Account::getPasswordHash() const
         {
             return m_passwordHash;
         }
@@ -50,7 +51,7 @@ namespace HMS
             return m_isActive;
         }
 
-        std::string Account::getCreatedDate() const
+        const std::string &Account::getCreatedDate() const
         {
             return m_createdDate;
         }
@@ -92,7 +93,7 @@ namespace HMS
 
         // ==================== Deserialize ====================
 
-        Result<Account> Account::deserialize(const std::string &line)
+        Result<Account> Account::deserialize(std::string_view line)
         {
             // Skip empty lines and comments
             if (line.empty() || line[0] == Constants::COMMENT_CHAR)
@@ -101,13 +102,14 @@ namespace HMS
             }
 
             // Split by delimiter
-            auto parts = Utils::split(line, Constants::FIELD_DELIMITER);
+            std::array<std::string_view, 5> parts;
+            size_t fieldCount = Utils::splitView(line, Constants::FIELD_DELIMITER, parts);
 
             // Validate field count
-            if (parts.size() != 5)
+            if (fieldCount != 5)
             {
                 std::cerr << std::format("Error: Invalid account format. Expected 5 fields, got {}\n",
-                                         parts.size());
+                                         fieldCount);
                 return std::nullopt;
             }
 
@@ -2,6 +2,7 @@
 #include "common/Utils.h"
 #include "common/Constants.h"
 
+#include <array>
 #include <iostream>
 #include <format>
 
@@ -24,17 +25,17 @@ namespace HMS
         }
 
         // ==================== Getters ====================
-        std::string Admin::getID() const
+        const std::string &Admin::getID() const
         {
             return m_adminID;
         }
 
-        std::string Admin::getAdminID() const
+        const std::string &Admin::getAdminID() const
         {
             return m_adminID;
         }
 
-        std::string Admin::getUsername() const
+        const std::string &Admin::getUsername() const
         {
             return m_username;
         }
@@ -97,7 +98,7 @@ namespace HMS
         }
 
         // ==================== Static Factory Method ====================
-        Result<Admin> Admin::deserialize(const std::string &line)
+        Result<Admin> Admin::deserialize(std::string_view line)
         {
             // Skip empty lines and comments
             if (line.empty() || line[0] == Constants::COMMENT_CHAR)
@@ -106,14 +107,15 @@ namespace HMS
             }
 
             // Split by delimiter
-            std::vector<std::string> fields = Utils::split(line, Constants::FIELD_DELIMITER);
+            std::array<std::string_view, 6> fields;
+            size_t fieldCount = Utils::splitView(line, Constants::FIELD_DELIMITER, fields);
 
             // Validate field count
-            if (fields.size() != 6)
+            if (fieldCount != 6)
             {
                 std::cerr << std::format(
                     "Error: Invalid admin record format. Expected 6 fields, got {}\n",
-                    fields.size());
+                    fieldCount);
                 return std::nullopt;
             }
 
@@ -1,6 +1,7 @@
 #include "model/Appointment.h"
 #include "common/Utils.h"
 #include "common/Constants.h"
+#include <array>
 #include <iostream>
 #include <iomanip>
 #include <format>
@@ -23,8 +24,10 @@ namespace HMS
               m_doctorID(doctorID),
               m_appointmentDate(date),
               m_appointmentTime(time),
+              m_dateValue(Date::parse(date).value_or(Date{})),
+              m_timeValue(TimeOfDay::parse(time).value_or(TimeOfDay{})),
               m_disease(disease),
-              m_price(price),
+              m_price(Money::fromDouble(price)),
               m_isPaid(false),
               m_status(AppointmentStatus::SCHEDULED),
               m_notes("") {}
@@ -39,11 +42,26 @@ namespace HMS
                                  bool isPaid,
                                  AppointmentStatus status,
                                  const std::string &notes)
+            : Appointment(appointmentID, patientUsername, doctorID, date, time, disease,
+                          Money::fromDouble(price), isPaid, status, notes) {}
+
+        Appointment::Appointment(const std::string &appointmentID,
+                                 const std::string &patientUsername,
+                                 const std::string &doctorID,
+                                 const std::string &date,
+                                 const std::string &time,
+                                 const std::string &disease,
+                                 Money price,
+                                 bool isPaid,
+                                 AppointmentStatus status,
+                                 const std::string &notes)
             : m_appointmentID(appointmentID),
               m_patientUsername(patientUsername),
               m_doctorID(doctorID),
               m_appointmentDate(date),
               m_appointmentTime(time),
+              m_dateValue(Date::parse(date).value_or(Date{})),
+              m_timeValue(TimeOfDay::parse(time).value_or(TimeOfDay{})),
               m_disease(disease),
               m_price(price),
               m_isPaid(isPaid),
@@ -52,27 +70,47 @@ namespace HMS
 
         // ==================== Getters ====================
 
-        std::string Appointment::getAppointmentID() const
+        const std::string &Appointment::getAppointmentID() const
         {
             return m_appointmentID;
         }
 
-        std::string Appointment::getPatientUsername() const
+        const std::string &Appointment::getPatientUsername() const
+        {
+            return m_patientUsername.str();
+        }
+
+        const std::string &Appointment::getDoctorID() const
+        {
+            return m_doctorID.str();
+        }
+
+        Date Appointment::getDateValue() const
+        {
+            return m_dateValue;
+        }
+
+        TimeOfDay Appointment::getTimeValue() const
+        {
+            return m_timeValue;
+        }
+
+        const InternedString &Appointment::getPatientHandle() const
         {
             return m_patientUsername;
         }
 
-        std::string Appointment::getDoctorID() const
+        const InternedString &Appointment::getDoctorHandle() const
         {
             return m_doctorID;
         }
 
-        std::string Appointment::getDate() const
+        const std::string &Appointment::getDate() const
         {
             return m_appointmentDate;
         }
 
-        std::string Appointment::getTime() const
+        const std::string &Appointment::getTime() const
         {
             return m_appointmentTime;
         }
@@ -82,12 +120,17 @@ namespace HMS
             return m_appointmentDate + " " + m_appointmentTime;
         }
 
-        std::string Appointment::getDisease() const
+        const std::string &Appointment::getDisease() const
         {
             return m_disease;
         }
 
         double Appointment::getPrice() const
+        {
+            return m_price.toDouble();
+        }
+
+        Money Appointment::getPriceValue() const
         {
             return m_price;
         }
@@ -107,7 +150,7 @@ namespace HMS
             return statusToString(m_status);
         }
 
-        std::string Appointment::getNotes() const
+        const std::string &Appointment::getNotes() const
         {
             return m_notes;
         }
@@ -118,11 +161,13 @@ namespace HMS
         void Appointment::setDate(const std::string &date)
         {
             m_appointmentDate = date;
+            m_dateValue = Date::parse(date).value_or(Date{});
         }
 
         void Appointment::setTime(const std::string &time)
         {
             m_appointmentTime = time;
+            m_timeValue = TimeOfDay::parse(time).value_or(TimeOfDay{});
         }
 
         void Appointment::setDisease(const std::string &disease)
@@ -132,7 +177,7 @@ namespace HMS
 
         void Appointment::setPrice(double price)
         {
-            m_price = price;
+            m_price = Money::fromDouble(price);
         }
 
         void Appointment::setPaid(bool paid)
@@ -225,14 +270,14 @@ namespace HMS
 
         std::string Appointment::serialize() const
         {
-            return std::format("{}|{}|{}|{}|{}|{}|{:.0f}|{}|{}|{}",
+            return std::format("{}|{}|{}|{}|{}|{}|{}|{}|{}|{}",
                                m_appointmentID,
-                               m_patientUsername,
-                               m_doctorID,
+                               m_patientUsername.str(),
+                               m_doctorID.str(),
                                m_appointmentDate,
                                m_appointmentTime,
                                m_disease,
-                               m_price,
+                               m_price.toString(),
                                (m_isPaid ? "1" : "0"),
                                statusToString(m_status),
                                m_notes);
@@ -240,7 +285,7 @@ namespace HMS
 
         // ==================== Static Factory Method ====================
 
-        Result<Appointment> Appointment::deserialize(const std::string &line)
+        Result<Appointment> Appointment::deserialize(std::string_view line)
         {
             if (line.empty() || line[0] == Constants::COMMENT_CHAR)
             {
@@ -248,10 +293,11 @@ namespace HMS
             }
 
             // Split by delimiter
-            auto parts = Utils::split(line, Constants::FIELD_DELIMITER);
+            std::array<std::string_view, 10> parts;
+            size_t fieldCount = Utils::splitView(line, Constants::FIELD_DELIMITER, parts);
 
             // Expected 10 fields
-            if (parts.size() != 10)
+            if (fieldCount != 10)
             {
                 return std::nullopt;
             }
@@ -265,8 +311,8 @@ namespace HMS
                 std::string date = Utils::trim(parts[3]);
                 std::string time = Utils::trim(parts[4]);
                 std::string disease = Utils::trim(parts[5]);
-                double price = std::stod(Utils::trim(parts[6]));
-                bool isPaid = (Utils::trim(parts[7]) == "1");
+                auto price = Money::parse(Utils::trimView(parts[6]));
+                bool isPaid = (Utils::trimView(parts[7]) == "1");
                 AppointmentStatus status = stringToStatus(Utils::trim(parts[8]));
                 std::string notes = Utils::trim(parts[9]);
 
@@ -283,7 +329,7 @@ namespace HMS
                 }
 
                 // Validate price
-                if (price < 0)
+                if (!price || price->isNegative())
                 {
                     return std::nullopt;
                 }
@@ -295,7 +341,7 @@ namespace HMS
                 }
 
                 return Appointment(appointmentID, patientUsername, doctorID,
-                                   date, time, disease, price, isPaid, status, notes);
+                                   date, time, disease, *price, isPaid, status, notes);
             }
             catch (const std::exception &e)
             {
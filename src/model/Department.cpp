@@ -3,6 +3,7 @@
 #include "common/Utils.h"
 
 #include <algorithm>
+#include <array>
 #include <format>
 #include <iostream>
 
@@ -21,22 +22,22 @@ namespace HMS
         }
 
         // ==================== Getters ====================
-        std::string Department::getDepartmentID() const { return m_departmentID; }
+        const std::string &Department::getDepartmentID() const { return m_departmentID; }
 
-        std::string Department::getName() const { return m_name; }
+        const std::string &Department::getName() const { return m_name; }
 
-        std::string Department::getDescription() const { return m_description; }
+        const std::string &Department::getDescription() const { return m_description; }
 
-        std::string Department::getHeadDoctorID() const { return m_headDoctorID; }
+        const std::string &Department::getHeadDoctorID() const { return m_headDoctorID; }
 
-        std::vector<std::string> Department::getDoctorIDs() const
+        const std::vector<std::string> &Department::getDoctorIDs() const
         {
             return m_doctorIDs;
         }
 
-        std::string Department::getLocation() const { return m_location; }
+        const std::string &Department::getLocation() const { return m_location; }
 
-        std::string Department::getPhone() const { return m_phone; }
+        const std::string &Department::getPhone() const { return m_phone; }
 
         // ==================== Setters ====================
         void Department::setName(const std::string &name) { m_name = name; }
@@ -140,7 +141,7 @@ namespace HMS
                                m_phone);
         }
 
-        Result<Department> Department::deserialize(const std::string &line)
+        Result<Department> Department::deserialize(std::string_view line)
         {
             // Skip empty lines and comments
             if (line.empty() || line[0] == Constants::COMMENT_CHAR)
@@ -149,14 +150,15 @@ namespace HMS
             }
 
             // Split by delimiter
-            auto parts = Utils::split(line, Constants::FIELD_DELIMITER);
+            std::array<std::string_view, 7> parts;
+            size_t fieldCount = Utils::splitView(line, Constants::FIELD_DELIMITER, parts);
 
             // Expected 7 fields
-            if (parts.size() != 7)
+            if (fieldCount != 7)
             {
                 std::cerr << std::format(
                     "Error: Invalid department format. Expected 7 fields, got {}\n",
-                    parts.size());
+                    fieldCount);
                 return std::nullopt;
             }
 
@@ -192,13 +194,14 @@ namespace HMS
 
                 if (!doctorIDsStr.empty())
                 {
-                    auto doctorIDs = Utils::split(doctorIDsStr, Constants::LIST_DELIMITER);
-                    for (const auto &doctorID : doctorIDs)
+                    Utils::FieldTokenizer doctorIDs(doctorIDsStr, Constants::LIST_DELIMITER);
+                    std::string_view doctorID;
+                    while (doctorIDs.next(doctorID))
                     {
-                        std::string trimmedID = Utils::trim(doctorID);
+                        std::string_view trimmedID = Utils::trimView(doctorID);
                         if (!trimmedID.empty())
                         {
-                            dept.addDoctor(trimmedID);
+                            dept.addDoctor(std::string(trimmedID));
                         }
                     }
                 }
@@ -2,6 +2,7 @@
 #include "common/Utils.h"
 #include "common/Constants.h"
 
+#include <array>
 #include <format>
 #include <iostream>
 #include <algorithm>
@@ -20,6 +21,17 @@ namespace HMS
                        const std::string &dateOfBirth,
                        const std::string &specialization,
                        double consultationFee)
+            : Doctor(doctorID, username, name, phone, gender, dateOfBirth, specialization,
+                     Money::fromDouble(consultationFee)) {}
+
+        Doctor::Doctor(const std::string &doctorID,
+                       const std::string &username,
+                       const std::string &name,
+                       const std::string &phone,
+                       Gender gender,
+                       const std::string &dateOfBirth,
+                       const std::string &specialization,
+                       Money consultationFee)
             : Person(name, phone, gender, dateOfBirth),
               m_doctorID(doctorID),
               m_username(username),
@@ -27,22 +39,22 @@ namespace HMS
               m_consultationFee(consultationFee) {}
 
         // ==================== Getters ====================
-        std::string Doctor::getID() const
+        const std::string &Doctor::getID() const
         {
             return m_doctorID;
         }
 
-        std::string Doctor::getDoctorID() const
+        const std::string &Doctor::getDoctorID() const
         {
             return m_doctorID;
         }
 
-        std::string Doctor::getUsername() const
+        const std::string &Doctor::getUsername() const
         {
             return m_username;
         }
 
-        std::string Doctor::getSpecialization() const
+        const std::string &Doctor::getSpecialization() const
         {
             return m_specialization;
         }
@@ -58,6 +70,11 @@ namespace HMS
         }
 
         double Doctor::getConsultationFee() const
+        {
+            return m_consultationFee.toDouble();
+        }
+
+        Money Doctor::getConsultationFeeValue() const
         {
             return m_consultationFee;
         }
@@ -154,7 +171,7 @@ namespace HMS
 
         void Doctor::setConsultationFee(double fee)
         {
-            m_consultationFee = fee;
+            m_consultationFee = Money::fromDouble(fee);
         }
 
         // ==================== Override Methods ====================
@@ -177,7 +194,7 @@ namespace HMS
 
         std::string Doctor::serialize() const
         {
-            return std::format("{}|{}|{}|{}|{}|{}|{}|{:.0f}",
+            return std::format("{}|{}|{}|{}|{}|{}|{}|{}",
                                m_doctorID,
                                m_username,
                                m_name,
@@ -185,11 +202,11 @@ namespace HMS
                                genderToString(m_gender),
                                m_dateOfBirth,
                                m_specialization,
-                               m_consultationFee);
+                               m_consultationFee.toString());
         }
 
         // ==================== Static Factory Method ====================
-        Result<Doctor> Doctor::deserialize(const std::string &line)
+        Result<Doctor> Doctor::deserialize(std::string_view line)
         {
             // Skip empty lines and comments
             if (line.empty() || line[0] == Constants::COMMENT_CHAR)
@@ -198,13 +215,14 @@ namespace HMS
             }
 
             // Split by delimiter
-            auto parts = Utils::split(line, Constants::FIELD_DELIMITER);
+            std::array<std::string_view, 9> parts;
+            size_t fieldCount = Utils::splitView(line, Constants::FIELD_DELIMITER, parts);
 
             // Support both old format (9 fields with schedule) and new format (8 fields without schedule)
-            if (parts.size() != 8 && parts.size() != 9)
+            if (fieldCount != 8 && fieldCount != 9)
             {
                 std::cerr << std::format("Error: Invalid doctor format. Expected 8 or 9 fields, got {}\n",
-                                         parts.size());
+                                         fieldCount);
                 return std::nullopt;
             }
 
@@ -220,16 +238,16 @@ namespace HMS
                 std::string specialization = Utils::trim(parts[6]);
 
                 // Handle backward compatibility: skip schedule field if present (old format)
-                double consultationFee;
-                if (parts.size() == 9)
+                std::optional<Money> consultationFee;
+                if (fieldCount == 9)
                 {
                     // Old format: parts[7] is schedule, parts[8] is fee
-                    consultationFee = std::stod(Utils::trim(parts[8]));
+                    consultationFee = Money::parse(Utils::trimView(parts[8]));
                 }
                 else
                 {
                     // New format: parts[7] is fee directly
-                    consultationFee = std::stod(Utils::trim(parts[7]));
+                    consultationFee = Money::parse(Utils::trimView(parts[7]));
                 }
 
                 // Validate required fields are not empty
@@ -264,7 +282,7 @@ namespace HMS
                 }
 
                 // Validate consultation fee
-                if (consultationFee < 0)
+                if (!consultationFee || consultationFee->isNegative())
                 {
                     std::cerr << std::format("Error: Invalid consultation fee for doctor {}\n",
                                              doctorID);
@@ -280,7 +298,7 @@ namespace HMS
                 }
 
                 return Doctor(doctorID, username, name, phone, gender,
-                              dateOfBirth, specialization, consultationFee);
+                              dateOfBirth, specialization, *consultationFee);
             }
             catch (const std::exception &e)
             {
@@ -2,6 +2,7 @@
 #include "common/Constants.h"
 #include "common/Utils.h"
 
+#include <array>
 #include <format>
 #include <iomanip>
 #include <iostream>
@@ -16,6 +17,11 @@ namespace HMS
         Medicine::Medicine(const std::string &medicineID, const std::string &name,
                            const std::string &category, double unitPrice,
                            int quantityInStock)
+            : Medicine(medicineID, name, category, Money::fromDouble(unitPrice), quantityInStock) {}
+
+        Medicine::Medicine(const std::string &medicineID, const std::string &name,
+                           const std::string &category, Money unitPrice,
+                           int quantityInStock)
             : m_medicineID(medicineID), m_name(name), m_genericName(""),
               m_category(category), m_manufacturer(""), m_description(""),
               m_unitPrice(unitPrice), m_quantityInStock(quantityInStock),
@@ -23,29 +29,31 @@ namespace HMS
               m_dosageForm(""), m_strength("") {}
 
         // ==================== Getters ====================
-        std::string Medicine::getMedicineID() const { return m_medicineID; }
+        const std::string &Medicine::getMedicineID() const { return m_medicineID; }
+
+        const std::string &Medicine::getName() const { return m_name; }
 
-        std::string Medicine::getName() const { return m_name; }
+        const std::string &Medicine::getGenericName() const { return m_genericName; }
 
-        std::string Medicine::getGenericName() const { return m_genericName; }
+        const std::string &Medicine::getCategory() const { return m_category; }
 
-        std::string Medicine::getCategory() const { return m_category; }
+        const std::string &Medicine::getManufacturer() const { return m_manufacturer; }
 
-        std::string Medicine::getManufacturer() const { return m_manufacturer; }
+        const std::string &Medicine::getDescription() const { return m_description; }
 
-        std::string Medicine::getDescription() const { return m_description; }
+        double Medicine::getUnitPrice() const { return m_unitPrice.toDouble(); }
 
-        double Medicine::getUnitPrice() const { return m_unitPrice; }
+        Money Medicine::getUnitPriceValue() const { return m_unitPrice; }
 
         int Medicine::getQuantityInStock() const { return m_quantityInStock; }
 
         int Medicine::getReorderLevel() const { return m_reorderLevel; }
 
-        std::string Medicine::getExpiryDate() const { return m_expiryDate; }
+        const std::string &Medicine::getExpiryDate() const { return m_expiryDate; }
 
-        std::string Medicine::getDosageForm() const { return m_dosageForm; }
+        const std::string &Medicine::getDosageForm() const { return m_dosageForm; }
 
-        std::string Medicine::getStrength() const { return m_strength; }
+        const std::string &Medicine::getStrength() const { return m_strength; }
 
         // ==================== Setters ====================
         void Medicine::setName(const std::string &name) { m_name = name; }
@@ -73,7 +81,7 @@ namespace HMS
         void Medicine::setUnitPrice(double price)
         {
             // Model is a data container - validation is done at BLL layer
-            m_unitPrice = price;
+            m_unitPrice = Money::fromDouble(price);
         }
 
         void Medicine::setQuantityInStock(int quantity)
@@ -220,14 +228,14 @@ namespace HMS
         {
             // Format:
             // medicineID|name|genericName|category|manufacturer|description|unitPrice|quantity|reorderLevel|expiryDate|dosageForm|strength
-            return std::format("{}|{}|{}|{}|{}|{}|{:.0f}|{}|{}|{}|{}|{}", m_medicineID,
+            return std::format("{}|{}|{}|{}|{}|{}|{}|{}|{}|{}|{}|{}", m_medicineID,
                                m_name, m_genericName, m_category, m_manufacturer,
-                               m_description, m_unitPrice, m_quantityInStock,
+                               m_description, m_unitPrice.toString(), m_quantityInStock,
                                m_reorderLevel, m_expiryDate, m_dosageForm, m_strength);
         }
 
         // ==================== Static Factory Method ====================
-        Result<Medicine> Medicine::deserialize(const std::string &line)
+        Result<Medicine> Medicine::deserialize(std::string_view line)
         {
             // Skip empty lines and comments
             if (line.empty() || line[0] == Constants::COMMENT_CHAR)
@@ -236,14 +244,15 @@ namespace HMS
             }
 
             // Split by delimiter
-            auto parts = Utils::split(line, Constants::FIELD_DELIMITER);
+            std::array<std::string_view, 12> parts;
+            size_t fieldCount = Utils::splitView(line, Constants::FIELD_DELIMITER, parts);
 
             // Expected 12 fields
-            if (parts.size() != 12)
+            if (fieldCount != 12)
             {
                 std::cerr << std::format(
                     "Error: Invalid medicine format. Expected 12 fields, got {}\n",
-                    parts.size());
+                    fieldCount);
                 return std::nullopt;
             }
 
@@ -255,7 +264,7 @@ namespace HMS
                 std::string category = Utils::trim(parts[3]);
                 std::string manufacturer = Utils::trim(parts[4]);
                 std::string description = Utils::trim(parts[5]);
-                double unitPrice = std::stod(Utils::trim(parts[6]));
+                auto unitPrice = Money::parse(Utils::trimView(parts[6]));
                 int quantityInStock = std::stoi(Utils::trim(parts[7]));
                 int reorderLevel = std::stoi(Utils::trim(parts[8]));
                 std::string expiryDate = Utils::trim(parts[9]);
@@ -270,7 +279,7 @@ namespace HMS
                 }
 
                 // Validate price is non-negative
-                if (unitPrice < 0)
+                if (!unitPrice || unitPrice->isNegative())
                 {
                     std::cerr << std::format("Error: Invalid unit price for medicine {}\n",
                                              medicineID);
@@ -304,7 +313,7 @@ namespace HMS
 
                 // Create Medicine object using parameterized constructor and set additional
                 // fields
-                Medicine med(medicineID, name, category, unitPrice, quantityInStock);
+                Medicine med(medicineID, name, category, *unitPrice, quantityInStock);
                 med.setGenericName(genericName);
                 med.setManufacturer(manufacturer);
                 med.setDescription(description);
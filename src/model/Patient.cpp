@@ -2,6 +2,7 @@
 #include "common/Utils.h"
 #include "common/Constants.h"
 
+#include <array>
 #include <format>
 #include <iostream>
 
@@ -21,27 +22,27 @@ HMS::Model::Patient::Patient(const std::string &patientID,
       m_medicalHistory(medicalHistory) {}
 
 // ==================== Getters ====================
-std::string HMS::Model::Patient::getID() const
+const std::string &HMS::Model::Patient::getID() const
 {
     return m_patientID;
 }
 
-std::string HMS::Model::Patient::getPatientID() const
+const std::string &HMS::Model::Patient::getPatientID() const
 {
     return m_patientID;
 }
 
-std::string HMS::Model::Patient::getUsername() const
+const std::string &HMS::Model::Patient::getUsername() const
 {
     return m_username;
 }
 
-std::string HMS::Model::Patient::getAddress() const
+const std::string &HMS::Model::Patient::getAddress() const
 {
     return m_address;
 }
 
-std::string HMS::Model::Patient::getMedicalHistory() const
+const std::string &HMS::Model::Patient::getMedicalHistory() const
 {
     return m_medicalHistory;
 }
@@ -106,7 +107,7 @@ std::string HMS::Model::Patient::serialize() const
 
 // ==================== Static Factory Method ====================
 
-HMS::Result<HMS::Model::Patient> HMS::Model::Patient::deserialize(const std::string &line)
+HMS::Result<HMS::Model::Patient> HMS::Model::Patient::deserialize(std::string_view line)
 {
     // Skip empty lines and comments
     if (line.empty() || line[0] == Constants::COMMENT_CHAR)
@@ -115,13 +116,14 @@ HMS::Result<HMS::Model::Patient> HMS::Model::Patient::deserialize(const std::str
     }
 
     // Split by delimiter
-    auto fields = Utils::split(line, Constants::FIELD_DELIMITER);
+    std::array<std::string_view, 8> fields;
+    size_t fieldCount = Utils::splitView(line, Constants::FIELD_DELIMITER, fields);
 
     // Validate field count
-    if (fields.size() != 8)
+    if (fieldCount != 8)
     {
         std::cerr << std::format("Error: Invalid patient format. Expected 8 fields, got {}\n",
-                                 fields.size());
+                                 fieldCount);
         return std::nullopt;
     }
 
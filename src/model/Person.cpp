@@ -16,12 +16,12 @@ namespace HMS
               m_dateOfBirth(dateOfBirth) {}
 
         // ==================== Getters ====================
-        std::string Person::getName() const
+        const std::string &Person::getName() const
         {
             return m_name;
         }
 
-        std::string Person::getPhone() const
+        const std::string &Person::getPhone() const
         {
             return m_phone;
         }
@@ -36,7 +36,7 @@ namespace HMS
             return genderToString(m_gender);
         }
 
-        std::string Person::getDateOfBirth() const
+        const std::string &Person::getDateOfBirth() const
         {
             return m_dateOfBirth;
         }
@@ -3,6 +3,7 @@
 #include "common/Utils.h"
 
 #include <algorithm>
+#include <array>
 #include <format>
 #include <iostream>
 #include <sstream>
@@ -20,31 +21,38 @@ namespace HMS
                                    const std::string &prescriptionDate)
             : m_prescriptionID(prescriptionID), m_appointmentID(appointmentID),
               m_patientUsername(patientUsername), m_doctorID(doctorID),
-              m_prescriptionDate(prescriptionDate), m_items(), m_diagnosis(""),
+              m_prescriptionDate(prescriptionDate),
+              m_prescriptionDateValue(Date::parse(prescriptionDate).value_or(Date{})), m_items(), m_diagnosis(""),
               m_notes(""), m_isDispensed(false) {}
 
         // ==================== Getters ====================
-        std::string Prescription::getPrescriptionID() const { return m_prescriptionID; }
+        const std::string &Prescription::getPrescriptionID() const { return m_prescriptionID; }
 
-        std::string Prescription::getAppointmentID() const { return m_appointmentID; }
+        const std::string &Prescription::getAppointmentID() const { return m_appointmentID; }
 
-        std::string Prescription::getPatientUsername() const
+        const std::string &Prescription::getPatientUsername() const
         {
-            return m_patientUsername;
+            return m_patientUsername.str();
         }
 
-        std::string Prescription::getDoctorID() const { return m_doctorID; }
+        const std::string &Prescription::getDoctorID() const { return m_doctorID.str(); }
 
-        std::string Prescription::getPrescriptionDate() const
+        const InternedString &Prescription::getPatientHandle() const { return m_patientUsername; }
+
+        const InternedString &Prescription::getDoctorHandle() const { return m_doctorID; }
+
+        const std::string &Prescription::getPrescriptionDate() const
         {
             return m_prescriptionDate;
         }
 
-        std::vector<PrescriptionItem> Prescription::getItems() const { return m_items; }
+        Date Prescription::getPrescriptionDateValue() const { return m_prescriptionDateValue; }
+
+        const std::vector<PrescriptionItem> &Prescription::getItems() const { return m_items; }
 
-        std::string Prescription::getDiagnosis() const { return m_diagnosis; }
+        const std::string &Prescription::getDiagnosis() const { return m_diagnosis; }
 
-        std::string Prescription::getNotes() const { return m_notes; }
+        const std::string &Prescription::getNotes() const { return m_notes; }
 
         bool Prescription::isDispensed() const { return m_isDispensed; }
 
@@ -88,7 +96,7 @@ namespace HMS
              */
             std::string serializeItem(const PrescriptionItem &item)
             {
-                return std::format("{}{}{}{}{}{}{}{}{}{}{}", item.medicineID,
+                return std::format("{}{}{}{}{}{}{}{}{}{}{}", item.medicineID.str(),
                                    Constants::ITEM_FIELD_DELIMITER, item.medicineName,
                                    Constants::ITEM_FIELD_DELIMITER, item.quantity,
                                    Constants::ITEM_FIELD_DELIMITER, item.dosage,
@@ -102,12 +110,13 @@ namespace HMS
              * - Legacy (5 fields): medicineID:quantity:dosage:duration:instructions
              * - New (6 fields): medicineID:medicineName:quantity:dosage:duration:instructions
              */
-            Result<PrescriptionItem> deserializeItem(const std::string &itemStr)
+            Result<PrescriptionItem> deserializeItem(std::string_view itemStr)
             {
-                auto parts = Utils::split(itemStr, Constants::ITEM_FIELD_DELIMITER);
+                std::array<std::string_view, 6> parts;
+                size_t fieldCount = Utils::splitView(itemStr, Constants::ITEM_FIELD_DELIMITER, parts);
 
                 // Need at least 5 fields (legacy format without medicineName)
-                if (parts.size() < 5)
+                if (fieldCount < 5)
                 {
                     return std::nullopt;
                 }
@@ -116,7 +125,7 @@ namespace HMS
                 {
                     PrescriptionItem item;
 
-                    if (parts.size() >= 6)
+                    if (fieldCount >= 6)
                     {
                         // New format with medicineName: medicineID:medicineName:quantity:dosage:duration:instructions
                         item.medicineID = Utils::trim(parts[0]);
@@ -176,7 +185,7 @@ namespace HMS
             /**
              * @brief Deserialize items from a single string
              */
-            std::vector<PrescriptionItem> deserializeItems(const std::string &itemsStr)
+            std::vector<PrescriptionItem> deserializeItems(std::string_view itemsStr)
             {
                 std::vector<PrescriptionItem> items;
                 if (itemsStr.empty())
@@ -184,8 +193,9 @@ namespace HMS
                     return items;
                 }
 
-                auto itemStrings = Utils::split(itemsStr, Constants::ITEM_DELIMITER);
-                for (const auto &itemStr : itemStrings)
+                Utils::FieldTokenizer itemStrings(itemsStr, Constants::ITEM_DELIMITER);
+                std::string_view itemStr;
+                while (itemStrings.next(itemStr))
                 {
                     auto item = deserializeItem(itemStr);
                     if (item.has_value())
@@ -205,8 +215,8 @@ namespace HMS
             std::cout << "========================================\n";
             std::cout << std::format("{:<18}: {}\n", "Prescription ID", m_prescriptionID);
             std::cout << std::format("{:<18}: {}\n", "Appointment ID", m_appointmentID);
-            std::cout << std::format("{:<18}: {}\n", "Patient", m_patientUsername);
-            std::cout << std::format("{:<18}: {}\n", "Doctor ID", m_doctorID);
+            std::cout << std::format("{:<18}: {}\n", "Patient", m_patientUsername.str());
+            std::cout << std::format("{:<18}: {}\n", "Doctor ID", m_doctorID.str());
             std::cout << std::format("{:<18}: {}\n", "Date",
                                      Utils::formatDateDisplay(m_prescriptionDate));
             if (!m_diagnosis.empty())
@@ -223,9 +233,9 @@ namespace HMS
                 {
                     const auto &item = m_items[i];
                     std::cout << std::format("  {}. {} ({})\n", i + 1,
-                                             item.medicineName.empty() ? item.medicineID
+                                             item.medicineName.empty() ? item.medicineID.str()
                                                                        : item.medicineName,
-                                             item.medicineID);
+                                             item.medicineID.str());
                     std::cout << std::format("     Qty: {}, Dosage: {}\n", item.quantity,
                                              item.dosage);
                     std::cout << std::format("     Duration: {}\n", item.duration);
@@ -346,7 +356,7 @@ namespace HMS
 
             for (size_t i = 0; i < m_items.size(); ++i) {
                 const auto& item = m_items[i];
-                std::string name = item.medicineName.empty() ? item.medicineID : item.medicineName;
+                std::string name = item.medicineName.empty() ? item.medicineID.str() : item.medicineName;
                 printField(std::to_string(i+1) + ". Thuốc", name);
                 printField("Số lượng", std::to_string(item.quantity));
                 printField("Liều dùng", item.dosage);
@@ -371,13 +381,13 @@ namespace HMS
             // Items format:
             // medicineID:medicineName:quantity:dosage:duration:instructions;...
             return std::format("{}|{}|{}|{}|{}|{}|{}|{}|{}", m_prescriptionID,
-                               m_appointmentID, m_patientUsername, m_doctorID,
+                               m_appointmentID, m_patientUsername.str(), m_doctorID.str(),
                                m_prescriptionDate, m_diagnosis, m_notes,
                                (m_isDispensed ? "1" : "0"), serializeItems(m_items));
         }
 
         // ==================== Static Factory Method ====================
-        Result<Prescription> Prescription::deserialize(const std::string &line)
+        Result<Prescription> Prescription::deserialize(std::string_view line)
         {
             // Skip empty lines and comments
             if (line.empty() || line[0] == Constants::COMMENT_CHAR)
@@ -386,14 +396,15 @@ namespace HMS
             }
 
             // Split by delimiter
-            auto parts = Utils::split(line, Constants::FIELD_DELIMITER);
+            std::array<std::string_view, 9> parts;
+            size_t fieldCount = Utils::splitView(line, Constants::FIELD_DELIMITER, parts);
 
             // Expected 9 fields
-            if (parts.size() != 9)
+            if (fieldCount != 9)
             {
                 std::cerr << std::format(
                     "Error: Invalid prescription format. Expected 9 fields, got {}\n",
-                    parts.size());
+                    fieldCount);
                 return std::nullopt;
             }
 
@@ -406,8 +417,8 @@ namespace HMS
                 std::string prescriptionDate = Utils::trim(parts[4]);
                 std::string diagnosis = Utils::trim(parts[5]);
                 std::string notes = Utils::trim(parts[6]);
-                bool isDispensed = (Utils::trim(parts[7]) == "1");
-                std::string itemsStr = Utils::trim(parts[8]);
+                bool isDispensed = (Utils::trimView(parts[7]) == "1");
+                std::string_view itemsStr = Utils::trimView(parts[8]);
 
                 // Validate required fields are not empty
                 if (prescriptionID.empty() || patientUsername.empty() || doctorID.empty())
@@ -1,5 +1,7 @@
 #include "ui/HMSFacade.h"
 #include "common/Utils.h"
+#include "dal/BackupWorker.h"
+#include "dal/WriteBehindFlusher.h"
 
 namespace HMS {
 namespace UI {
@@ -64,20 +66,44 @@ void HMSFacade::resetInstance() {
 HMSFacade::~HMSFacade() = default;
 
 // ==================== System Lifecycle ====================
-bool HMSFacade::initialize() {
+bool HMSFacade::initialize(bool earlyLogin) {
     if (m_isInitialized) {
         return true;
     }
 
-    m_isInitialized = loadData();
+    if (!earlyLogin) {
+        m_isInitialized = loadData();
+        return m_isInitialized;
+    }
+
+    // Login only needs accounts. A request that reaches another repository
+    // before its load finishes blocks on that repository's lock meanwhile.
+    m_isInitialized = startDataLoad().get();
     return m_isInitialized;
 }
 
+bool HMSFacade::waitForDataLoad() {
+    bool allLoaded = true;
+    for (auto& load : m_pendingLoads) {
+        allLoaded = load.get() && allLoaded;
+    }
+    m_pendingLoads.clear();
+    return allLoaded;
+}
+
 void HMSFacade::shutdown() {
+    waitForDataLoad();
+
+    // Persist changes still deferred by write-behind repositories
+    DAL::WriteBehindFlusher::getInstance()->flushAll();
+
     if (m_isInitialized) {
         saveData();
         m_isInitialized = false;
     }
+
+    // Write backups still waiting for their coalescing interval
+    DAL::BackupWorker::getInstance()->flush();
 }
 
 bool HMSFacade::isInitialized() const {
@@ -629,8 +655,25 @@ bool HMSFacade::saveData() {
 }
 
 bool HMSFacade::loadData() {
-    // Services auto-load via repositories
-    return true;
+    bool accountsLoaded = startDataLoad().get();
+    bool othersLoaded = waitForDataLoad();
+    return accountsLoaded && othersLoaded;
+}
+
+// ==================== Private Helpers ====================
+std::future<bool> HMSFacade::startDataLoad() {
+    auto launch = [](auto* service) {
+        return std::async(std::launch::async, [service] { return service->loadData(); });
+    };
+
+    m_pendingLoads.push_back(launch(m_patientService));
+    m_pendingLoads.push_back(launch(m_doctorService));
+    m_pendingLoads.push_back(launch(m_appointmentService));
+    m_pendingLoads.push_back(launch(m_medicineService));
+    m_pendingLoads.push_back(launch(m_departmentService));
+    m_pendingLoads.push_back(launch(m_prescriptionService));
+
+    return launch(m_authService);
 }
 
 } // namespace UI
@@ -425,6 +425,25 @@ TEST_F(AdminServiceTest, LoadAllData_DoesNotCrash)
     EXPECT_TRUE(result);
 }
 
+TEST_F(AdminServiceTest, LoadAllData_ReloadsEveryRepository)
+{
+    PatientRepository::getInstance()->add(
+        Patient("P001", "patient1", "Patient One", "0912345678", Gender::MALE,
+                "1990-01-01", "Address", "None"));
+    DoctorRepository::getInstance()->add(
+        Doctor("D001", "doctor1", "Doctor One", "0987654321", Gender::FEMALE,
+               "1980-01-01", "Cardiology", 500000.0));
+    AppointmentRepository::getInstance()->add(
+        Appointment("APT001", "patient1", "D001", "2030-01-01", "09:00",
+                    "Checkup", 500000.0, false, AppointmentStatus::SCHEDULED, ""));
+
+    EXPECT_TRUE(adminService->loadAllData());
+
+    EXPECT_EQ(PatientRepository::getInstance()->count(), 1u);
+    EXPECT_EQ(DoctorRepository::getInstance()->count(), 1u);
+    EXPECT_EQ(AppointmentRepository::getInstance()->count(), 1u);
+}
+
 // ==================== Validation Tests ====================
 
 TEST_F(AdminServiceTest, GenerateMonthlyReport_InvalidMonth_ReturnsError)
@@ -838,6 +838,18 @@ TEST_F(DepartmentServiceTest, GetDoctorCountByDepartment_ReturnsCounts)
     EXPECT_EQ(counts["DEP002"], 0);
 }
 
+TEST_F(DepartmentServiceTest, GetDoctorCountByDepartment_OrderedByIdNumber)
+{
+    service->createDepartment(createTestDepartment("DEP1000", "Cardiology"));
+    service->createDepartment(createTestDepartment("DEP999", "Neurology"));
+
+    auto counts = service->getDoctorCountByDepartment();
+
+    ASSERT_EQ(counts.size(), 2u);
+    EXPECT_EQ(counts.begin()->first, "DEP999");
+    EXPECT_EQ(std::next(counts.begin())->first, "DEP1000");
+}
+
 // ==================== Validation Tests ====================
 
 TEST_F(DepartmentServiceTest, ValidateDepartment_ValidDepartment_ReturnsTrue)
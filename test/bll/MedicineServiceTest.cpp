@@ -364,6 +364,47 @@ TEST_F(MedicineServiceTest, DeleteMedicine_EmptyID_Fail)
     EXPECT_FALSE(result);
 }
 
+TEST_F(MedicineServiceTest, CreateMedicines_ValidBatch_Success)
+{
+    bool result = service->createMedicines({createTestMedicine("MED001", "Aspirin"),
+                                            createTestMedicine("MED002", "Ibuprofen")});
+
+    EXPECT_TRUE(result);
+    EXPECT_EQ(repo->count(), 2u);
+}
+
+TEST_F(MedicineServiceTest, CreateMedicines_InvalidMedicine_NothingAdded)
+{
+    bool result = service->createMedicines({createTestMedicine("MED001", "Aspirin"),
+                                            createTestMedicine("MED002", "Ibuprofen", "Painkiller", -1.0)});
+
+    EXPECT_FALSE(result);
+    EXPECT_EQ(repo->count(), 0u);
+}
+
+TEST_F(MedicineServiceTest, CreateMedicines_ExistingID_NothingAdded)
+{
+    service->createMedicine(createTestMedicine("MED001", "Aspirin"));
+
+    bool result = service->createMedicines({createTestMedicine("MED001", "Aspirin"),
+                                            createTestMedicine("MED002", "Ibuprofen")});
+
+    EXPECT_FALSE(result);
+    EXPECT_EQ(repo->count(), 1u);
+}
+
+TEST_F(MedicineServiceTest, UpsertMedicines_UpdatesAndAdds)
+{
+    service->createMedicine(createTestMedicine("MED001", "Aspirin", "Antibiotic", 10.0, 5));
+
+    bool result = service->upsertMedicines({createTestMedicine("MED001", "Aspirin", "Antibiotic", 10.0, 50),
+                                            createTestMedicine("MED002", "Ibuprofen")});
+
+    EXPECT_TRUE(result);
+    EXPECT_EQ(repo->count(), 2u);
+    EXPECT_EQ(repo->getById("MED001")->getQuantityInStock(), 50);
+}
+
 // ==================== Query Operations Tests ====================
 
 TEST_F(MedicineServiceTest, GetMedicineByID_ExistingMedicine_Success)
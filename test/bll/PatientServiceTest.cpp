@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
+#include <atomic>
 #include <filesystem>
+#include <thread>
+#include <vector>
 
 #include "bll/PatientService.h"
 #include "bll/AppointmentService.h"
@@ -104,6 +107,86 @@ TEST_F(PatientServiceTest, CreatePatient_DuplicateUsername)
     EXPECT_FALSE(service->createPatient(createTestPatient("P002", "same")));
 }
 
+// ==================== BULK CREATE ====================
+TEST_F(PatientServiceTest, CreatePatients_Valid)
+{
+    EXPECT_TRUE(service->createPatients({createTestPatient("P001", "user1"),
+                                         createTestPatient("P002", "user2"),
+                                         createTestPatient("P003", "user3")}));
+    EXPECT_EQ(service->getAllPatients().size(), 3u);
+}
+
+TEST_F(PatientServiceTest, CreatePatients_OneInvalid_NothingAdded)
+{
+    EXPECT_FALSE(service->createPatients({createTestPatient("P001", "user1"),
+                                          createTestPatient("P002", "user2", "A")}));
+    EXPECT_TRUE(service->getAllPatients().empty());
+}
+
+TEST_F(PatientServiceTest, CreatePatients_DuplicateUsername_NothingAdded)
+{
+    service->createPatient(createTestPatient("P001", "taken"));
+
+    EXPECT_FALSE(service->createPatients({createTestPatient("P002", "user2"),
+                                          createTestPatient("P003", "taken")}));
+    EXPECT_FALSE(service->createPatients({createTestPatient("P002", "same"),
+                                          createTestPatient("P003", "same")}));
+    EXPECT_EQ(service->getAllPatients().size(), 1u);
+}
+
+TEST_F(PatientServiceTest, UpsertPatients_UpdatesAndAdds)
+{
+    service->createPatient(createTestPatient("P001", "user1", "Old Name"));
+
+    EXPECT_TRUE(service->upsertPatients({createTestPatient("P001", "user1", "New Name"),
+                                         createTestPatient("P002", "user2")}));
+    EXPECT_EQ(service->getAllPatients().size(), 2u);
+    EXPECT_EQ(service->getPatientByID("P001")->getName(), "New Name");
+}
+
+TEST_F(PatientServiceTest, UpsertPatients_UsernameOfOtherPatient_Fails)
+{
+    service->createPatient(createTestPatient("P001", "user1"));
+
+    EXPECT_FALSE(service->upsertPatients({createTestPatient("P002", "user1")}));
+    EXPECT_EQ(service->getAllPatients().size(), 1u);
+}
+
+TEST_F(PatientServiceTest, UpsertPatients_RenameFreesUsername)
+{
+    service->createPatients({createTestPatient("P001", "user1"),
+                             createTestPatient("P002", "user2")});
+
+    // Swap the usernames in one batch
+    EXPECT_TRUE(service->upsertPatients({createTestPatient("P001", "user2"),
+                                         createTestPatient("P002", "user1")}));
+    EXPECT_EQ(service->getPatientByUsername("user1")->getPatientID(), "P002");
+    EXPECT_EQ(service->getPatientByUsername("user2")->getPatientID(), "P001");
+}
+
+TEST_F(PatientServiceTest, CreatePatients_ConcurrentBatchesSameUsername_OneSucceeds)
+{
+    constexpr int THREADS = 8;
+    std::atomic<int> succeeded{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([this, &succeeded, t]
+                             {
+            const std::string id = "P" + std::to_string(100 + t);
+            if (service->createPatients({createTestPatient(id, "contested")}))
+                ++succeeded; });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(succeeded, 1);
+    EXPECT_EQ(service->getAllPatients().size(), 1u);
+}
+
 // ==================== VALIDATION ====================
 TEST_F(PatientServiceTest, Validation_EmptyID)
 {
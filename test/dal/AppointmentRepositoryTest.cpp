@@ -5,6 +5,7 @@
 #include "common/Types.h"
 #include "common/Utils.h"
 #include "dal/FileHelper.h"
+#include "dal/Journal.h"
 
 #include <filesystem>
 #include <fstream>
@@ -175,6 +176,99 @@ TEST_F(AppointmentRepositoryTest, GetUnpaidByPatient)
     EXPECT_EQ(unpaid[0].getAppointmentID(), "APT1");
 }
 
+TEST_F(AppointmentRepositoryTest, GetByPatientSortedByDateTime)
+{
+    repo->add(makeAppointment("APT1", "alice", "D1", "2030-03-01", "09:00"));
+    repo->add(makeAppointment("APT2", "alice", "D1", "2030-01-01", "14:00"));
+    repo->add(makeAppointment("APT3", "alice", "D2", "2030-01-01", "08:00"));
+
+    auto result = repo->getByPatient("alice");
+    ASSERT_EQ(result.size(), 3);
+    EXPECT_EQ(result[0].getAppointmentID(), "APT3");
+    EXPECT_EQ(result[1].getAppointmentID(), "APT2");
+    EXPECT_EQ(result[2].getAppointmentID(), "APT1");
+}
+
+TEST_F(AppointmentRepositoryTest, PatientIndexFollowsUpdateAndRemove)
+{
+    repo->add(makeAppointment("APT1", "alice", "D1", "2030-01-01", "09:00"));
+    repo->add(makeAppointment("APT2", "alice", "D1", "2030-01-02", "09:00"));
+    repo->add(makeAppointment("APT3", "bob", "D1", "2030-01-03", "09:00"));
+
+    // Reschedule APT1 after APT2 and hand APT3 over to alice
+    repo->update(makeAppointment("APT1", "alice", "D1", "2030-01-05", "09:00"));
+    repo->update(makeAppointment("APT3", "alice", "D1", "2030-01-04", "09:00"));
+    repo->remove("APT2");
+
+    auto result = repo->getByPatient("alice");
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[0].getAppointmentID(), "APT3");
+    EXPECT_EQ(result[1].getAppointmentID(), "APT1");
+    EXPECT_TRUE(repo->getByPatient("bob").empty());
+}
+
+TEST_F(AppointmentRepositoryTest, RangeOperationsMaintainIndexes)
+{
+    EXPECT_TRUE(repo->addRange({makeAppointment("APT1", "alice", "D1", "2030-01-02", "09:00"),
+                                makeAppointment("APT2", "bob", "D1", "2030-01-01", "09:00")}));
+
+    // Move APT2 over to alice and add a third appointment in the same batch
+    EXPECT_TRUE(repo->upsertRange({makeAppointment("APT2", "alice", "D1", "2030-01-03", "10:00"),
+                                   makeAppointment("APT3", "bob", "D1", "2030-01-01", "09:00")}));
+
+    auto alice = repo->getByPatient("alice");
+    ASSERT_EQ(alice.size(), 2);
+    EXPECT_EQ(alice[0].getAppointmentID(), "APT1");
+    EXPECT_EQ(alice[1].getAppointmentID(), "APT2");
+
+    auto bob = repo->getByPatient("bob");
+    ASSERT_EQ(bob.size(), 1);
+    EXPECT_EQ(bob[0].getAppointmentID(), "APT3");
+
+    EXPECT_FALSE(repo->isSlotAvailable("D1", "2030-01-03", "10:00"));
+    EXPECT_TRUE(repo->isSlotAvailable("D1", "2030-01-02", "10:00"));
+}
+
+TEST_F(AppointmentRepositoryTest, UpsertRange_WriteFails_IndexesRestored)
+{
+    const std::string missingDir = TEST_DATA_DIR + "range_write_fails/";
+    std::filesystem::create_directories(missingDir);
+    repo->setFilePath(missingDir + "Appointment.txt");
+    repo->add(makeAppointment("APT1", "alice", "D1", "2030-01-01", "09:00"));
+
+    // Every later write of the data file fails
+    std::filesystem::remove_all(missingDir);
+
+    EXPECT_FALSE(repo->upsertRange({makeAppointment("APT1", "bob", "D1", "2030-01-02", "10:00"),
+                                    makeAppointment("APT2", "bob", "D1", "2030-01-03", "11:00")}));
+
+    EXPECT_EQ(repo->count(), 1u);
+    auto alice = repo->getByPatient("alice");
+    ASSERT_EQ(alice.size(), 1);
+    EXPECT_EQ(alice[0].getDate(), "2030-01-01");
+    EXPECT_TRUE(repo->getByPatient("bob").empty());
+
+    EXPECT_FALSE(repo->isSlotAvailable("D1", "2030-01-01", "09:00"));
+    EXPECT_TRUE(repo->isSlotAvailable("D1", "2030-01-02", "10:00"));
+    EXPECT_TRUE(repo->isSlotAvailable("D1", "2030-01-03", "11:00"));
+}
+
+TEST_F(AppointmentRepositoryTest, GetHistoryByPatientMostRecentFirst)
+{
+    repo->add(makeAppointment("APT1", "alice", "D1", "2020-01-01", "09:00", AppointmentStatus::COMPLETED));
+    repo->add(makeAppointment("APT2", "alice", "D1", "2020-06-01", "09:00", AppointmentStatus::CANCELLED));
+    repo->add(makeAppointment("APT3", "alice", "D1", "2030-01-01", "09:00", AppointmentStatus::SCHEDULED));
+
+    auto history = repo->getHistoryByPatient("alice");
+    ASSERT_EQ(history.size(), 2);
+    EXPECT_EQ(history[0].getAppointmentID(), "APT2");
+    EXPECT_EQ(history[1].getAppointmentID(), "APT1");
+
+    auto upcoming = repo->getUpcomingByPatient("alice");
+    ASSERT_EQ(upcoming.size(), 1);
+    EXPECT_EQ(upcoming[0].getAppointmentID(), "APT3");
+}
+
 // ============================================================================
 // DOCTOR QUERIES
 // ============================================================================
@@ -192,6 +286,42 @@ TEST_F(AppointmentRepositoryTest, GetByDoctorAndDateSorted)
     EXPECT_EQ(result[1].getTime(), "10:00");
 }
 
+// ============================================================================
+// DATE QUERIES
+// ============================================================================
+
+TEST_F(AppointmentRepositoryTest, GetByDateRangeOrderedAndBounded)
+{
+    repo->add(makeAppointment("APT1", "p1", "D1", "2030-02-01", "09:00"));
+    repo->add(makeAppointment("APT2", "p2", "D1", "2030-01-15", "14:00"));
+    repo->add(makeAppointment("APT3", "p3", "D2", "2030-01-15", "08:00"));
+    repo->add(makeAppointment("APT4", "p4", "D2", "2029-12-31", "16:00"));
+
+    auto result = repo->getByDateRange("2030-01-01", "2030-02-01");
+    ASSERT_EQ(result.size(), 3);
+    EXPECT_EQ(result[0].getAppointmentID(), "APT3");
+    EXPECT_EQ(result[1].getAppointmentID(), "APT2");
+    EXPECT_EQ(result[2].getAppointmentID(), "APT1");
+
+    auto day = repo->getByDate("2030-01-15");
+    ASSERT_EQ(day.size(), 2);
+    EXPECT_EQ(day[0].getTime(), "08:00");
+}
+
+TEST_F(AppointmentRepositoryTest, DateIndexFollowsRescheduleAndRemove)
+{
+    repo->add(makeAppointment("APT1", "p1", "D1", "2030-01-01", "09:00"));
+    repo->add(makeAppointment("APT2", "p2", "D1", "2030-01-01", "10:00"));
+
+    repo->update(makeAppointment("APT1", "p1", "D1", "2030-01-02", "09:00"));
+    repo->remove("APT2");
+
+    EXPECT_TRUE(repo->getByDate("2030-01-01").empty());
+    auto moved = repo->getByDate("2030-01-02");
+    ASSERT_EQ(moved.size(), 1);
+    EXPECT_EQ(moved[0].getAppointmentID(), "APT1");
+}
+
 // ============================================================================
 // SLOT AVAILABILITY
 // ============================================================================
@@ -250,6 +380,57 @@ TEST_F(AppointmentRepositoryTest, SlotAvailableWithExclusion_MultipleAppointment
     EXPECT_TRUE(repo->isSlotAvailable("D1", "2030-01-01", "10:00", "APT2"));
 }
 
+TEST_F(AppointmentRepositoryTest, BookedSlotMaskFollowsCancelAndReschedule)
+{
+    const SlotMask at0900 = SlotMask{1} << Utils::getSlotIndex("09:00");
+    const SlotMask at1000 = SlotMask{1} << Utils::getSlotIndex("10:00");
+
+    repo->add(makeAppointment("APT1", "p1", "D1", "2030-01-01", "09:00"));
+    EXPECT_EQ(repo->getBookedSlotMask("D1", "2030-01-01"), at0900);
+    EXPECT_EQ(repo->getBookedSlotMask("D2", "2030-01-01"), 0u);
+
+    // Reschedule to 10:00
+    repo->update(makeAppointment("APT1", "p1", "D1", "2030-01-01", "10:00"));
+    EXPECT_EQ(repo->getBookedSlotMask("D1", "2030-01-01"), at1000);
+    EXPECT_TRUE(repo->isSlotAvailable("D1", "2030-01-01", "09:00"));
+
+    // Cancel frees the slot
+    repo->update(makeAppointment("APT1", "p1", "D1", "2030-01-01", "10:00",
+                                 AppointmentStatus::CANCELLED));
+    EXPECT_EQ(repo->getBookedSlotMask("D1", "2030-01-01"), 0u);
+    EXPECT_TRUE(repo->getBookedSlots("D1", "2030-01-01").empty());
+}
+
+TEST_F(AppointmentRepositoryTest, DoubleBookedSlotStaysBookedUntilBothReleased)
+{
+    repo->add(makeAppointment("APT1", "p1", "D1", "2030-01-01", "09:00"));
+    repo->add(makeAppointment("APT2", "p2", "D1", "2030-01-01", "09:00"));
+    repo->add(makeAppointment("APT3", "p3", "D1", "2030-01-01", "08:00"));
+
+    auto booked = repo->getBookedSlots("D1", "2030-01-01");
+    ASSERT_EQ(booked.size(), 3);
+    EXPECT_EQ(booked[0], "08:00");
+    EXPECT_EQ(booked[1], "09:00");
+    EXPECT_EQ(booked[2], "09:00");
+
+    EXPECT_FALSE(repo->isSlotAvailable("D1", "2030-01-01", "09:00", "APT1"));
+    repo->remove("APT2");
+    EXPECT_FALSE(repo->isSlotAvailable("D1", "2030-01-01", "09:00"));
+    EXPECT_TRUE(repo->isSlotAvailable("D1", "2030-01-01", "09:00", "APT1"));
+}
+
+TEST_F(AppointmentRepositoryTest, OffGridTimesAreTrackedOutsideMask)
+{
+    repo->add(makeAppointment("APT1", "p1", "D1", "2030-01-01", "09:15"));
+
+    EXPECT_FALSE(repo->isSlotAvailable("D1", "2030-01-01", "09:15"));
+    EXPECT_EQ(repo->getBookedSlotMask("D1", "2030-01-01"), 0u);
+
+    auto booked = repo->getBookedSlots("D1", "2030-01-01");
+    ASSERT_EQ(booked.size(), 1);
+    EXPECT_EQ(booked[0], "09:15");
+}
+
 // ============================================================================
 // FILE PERSISTENCE
 // ============================================================================
@@ -280,6 +461,83 @@ TEST_F(AppointmentRepositoryTest, SaveAndLoadPersistence)
     EXPECT_TRUE(repo->exists("APT2"));
 }
 
+// ============================================================================
+// JOURNAL MODE
+// ============================================================================
+
+TEST_F(AppointmentRepositoryTest, JournalModeAppendsInsteadOfRewriting)
+{
+    repo->setJournalEnabled(true);
+    ASSERT_TRUE(repo->isJournalEnabled());
+
+    auto apt = makeAppointment("APT1", "alice", "D1");
+    EXPECT_TRUE(repo->add(apt));
+    EXPECT_TRUE(repo->add(makeAppointment("APT2", "bob", "D2")));
+    apt.setNotes("Updated");
+    EXPECT_TRUE(repo->update(apt));
+    EXPECT_TRUE(repo->remove("APT2"));
+
+    // Data file still holds the snapshot written by clear(); changes live in the journal
+    EXPECT_TRUE(FileHelper::readLines(TEST_DATA_FILE).empty());
+    EXPECT_EQ(repo->getJournalRecordCount(), 4);
+    EXPECT_EQ(FileHelper::readLines(Journal::getJournalPath(TEST_DATA_FILE)).size(), 4);
+}
+
+TEST_F(AppointmentRepositoryTest, JournalReplayRestoresStateAfterRestart)
+{
+    repo->setJournalEnabled(true);
+    auto apt = makeAppointment("APT1", "alice", "D1");
+    repo->add(apt);
+    repo->add(makeAppointment("APT2", "bob", "D2"));
+    apt.setStatus(AppointmentStatus::COMPLETED);
+    repo->update(apt);
+    repo->remove("APT2");
+
+    AppointmentRepository::resetInstance();
+    repo = AppointmentRepository::getInstance();
+    repo->setFilePath(TEST_DATA_FILE);
+    repo->load();
+
+    EXPECT_EQ(repo->count(), 1);
+    auto result = repo->getById("APT1");
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->getStatus(), AppointmentStatus::COMPLETED);
+    EXPECT_FALSE(repo->exists("APT2"));
+}
+
+TEST_F(AppointmentRepositoryTest, SaveCompactsJournalIntoSnapshot)
+{
+    repo->setJournalEnabled(true);
+    repo->add(makeAppointment("APT1", "alice", "D1"));
+    repo->add(makeAppointment("APT2", "bob", "D2"));
+
+    EXPECT_TRUE(repo->save());
+    EXPECT_EQ(repo->getJournalRecordCount(), 0);
+    EXPECT_FALSE(FileHelper::fileExists(Journal::getJournalPath(TEST_DATA_FILE)));
+    EXPECT_EQ(FileHelper::readLines(TEST_DATA_FILE).size(), 2);
+}
+
+TEST_F(AppointmentRepositoryTest, JournalIgnoresTornTrailingRecord)
+{
+    repo->setJournalEnabled(true);
+    repo->add(makeAppointment("APT1", "alice", "D1"));
+
+    {
+        // Simulate a crash in the middle of writing the next record
+        std::ofstream journal(Journal::getJournalPath(TEST_DATA_FILE), std::ios::app);
+        journal << "U|APT2|bob|D2|2030-01";
+    }
+
+    repo->load();
+    EXPECT_EQ(repo->count(), 1);
+
+    // Appends after recovery start on a clean line
+    EXPECT_TRUE(repo->add(makeAppointment("APT3", "carol", "D3")));
+    repo->load();
+    EXPECT_EQ(repo->count(), 2);
+    EXPECT_TRUE(repo->exists("APT3"));
+}
+
 // ============================================================================
 // EDGE CASES
 // ============================================================================
@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include "dal/BackupStore.h"
+#include "dal/FileHelper.h"
+#include <filesystem>
+#include <fstream>
+
+using HMS::DAL::BackupEntry;
+using HMS::DAL::BackupStore;
+using HMS::DAL::FileHelper;
+using HMS::DAL::RetentionPolicy;
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr std::int64_t HOUR = 60LL * 60 * 1000;
+    constexpr std::int64_t DAY = 24 * HOUR;
+    constexpr std::int64_t BASE = 1699920000000LL; // 2023-11-14 00:00 UTC
+}
+
+class BackupStoreTest : public ::testing::Test
+{
+protected:
+    std::string testDir = "test_backupstore_temp";
+    std::string backupDir = testDir + "/backup";
+    std::string dataFile = testDir + "/Data.txt";
+
+    void SetUp() override
+    {
+        fs::create_directories(testDir);
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(testDir);
+    }
+
+    void writeData(const std::string &content)
+    {
+        std::ofstream file(dataFile, std::ios::trunc);
+        file << content;
+    }
+
+    size_t objectCount() const
+    {
+        size_t count = 0;
+        for (const auto &entry : fs::directory_iterator(backupDir))
+        {
+            if (entry.path().filename() != "backup.index")
+                count++;
+        }
+        return count;
+    }
+};
+
+// ==================== Deduplication ====================
+
+TEST_F(BackupStoreTest, Backup_UnchangedContent_StoresOnce)
+{
+    BackupStore store(backupDir);
+    writeData("v1");
+
+    EXPECT_TRUE(store.backup(dataFile, BASE));
+    EXPECT_TRUE(store.backup(dataFile, BASE + 1000));
+
+    EXPECT_EQ(store.getEntries(dataFile).size(), 1u);
+    EXPECT_EQ(objectCount(), 1u);
+}
+
+TEST_F(BackupStoreTest, Backup_RevertedContent_SharesCopy)
+{
+    BackupStore store(backupDir);
+
+    writeData("v1");
+    store.backup(dataFile, BASE);
+    writeData("v2");
+    store.backup(dataFile, BASE + 1);
+    writeData("v1");
+    store.backup(dataFile, BASE + 2);
+
+    auto entries = store.getEntries(dataFile);
+    ASSERT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries[0].object, entries[2].object);
+    EXPECT_EQ(objectCount(), 2u);
+}
+
+TEST_F(BackupStoreTest, Backup_SameMillisecond_KeepsBothVersions)
+{
+    BackupStore store(backupDir);
+
+    writeData("first");
+    store.backup(dataFile, BASE);
+    writeData("second");
+    store.backup(dataFile, BASE);
+
+    EXPECT_EQ(store.getEntries(dataFile).size(), 2u);
+    ASSERT_TRUE(store.restoreLatest(dataFile));
+    EXPECT_EQ(FileHelper::readFile(dataFile), "second");
+}
+
+TEST_F(BackupStoreTest, Backup_HashCollision_StoresSeparateCopy)
+{
+    BackupStore store(backupDir);
+    writeData("v1");
+    store.backup(dataFile, BASE);
+
+    // Same size and name as the copy of v1, other bytes: what a colliding content leaves behind
+    const std::string object = store.getEntries(dataFile).front().object;
+    std::ofstream(fs::path(backupDir) / object, std::ios::trunc) << "xx";
+
+    EXPECT_TRUE(store.backup(dataFile, BASE + 1));
+
+    auto entries = store.getEntries(dataFile);
+    ASSERT_EQ(entries.size(), 2u);
+    EXPECT_NE(entries[1].object, object);
+    ASSERT_TRUE(store.restoreLatest(dataFile));
+    EXPECT_EQ(FileHelper::readFile(dataFile), "v1");
+}
+
+TEST_F(BackupStoreTest, Backup_NonExistentFile_ReturnsFalse)
+{
+    BackupStore store(backupDir);
+
+    EXPECT_FALSE(store.backup(testDir + "/missing.txt", BASE));
+    EXPECT_FALSE(store.getLatest(testDir + "/missing.txt").has_value());
+}
+
+// ==================== Index ====================
+
+TEST_F(BackupStoreTest, RestoreLatest_UsesIndexFromNewInstance)
+{
+    {
+        BackupStore store(backupDir);
+        writeData("old");
+        store.backup(dataFile, BASE);
+        writeData("new");
+        store.backup(dataFile, BASE + HOUR);
+    }
+
+    writeData("corrupted");
+    BackupStore reopened(backupDir);
+
+    ASSERT_TRUE(reopened.restoreLatest(dataFile));
+    EXPECT_EQ(FileHelper::readFile(dataFile), "new");
+    EXPECT_EQ(reopened.getLatest(dataFile)->timestamp, BASE + HOUR);
+}
+
+TEST_F(BackupStoreTest, Open_AdoptsLegacyTimestampedBackups)
+{
+    fs::create_directories(backupDir);
+    std::ofstream(backupDir + "/Data_backup_20240101_100000.txt") << "legacy-old";
+    std::ofstream(backupDir + "/Data_backup_20240102_100000.txt") << "legacy-new";
+
+    BackupStore store(backupDir);
+
+    EXPECT_EQ(store.getEntries(dataFile).size(), 2u);
+    ASSERT_TRUE(store.restoreLatest(dataFile));
+    EXPECT_EQ(FileHelper::readFile(dataFile), "legacy-new");
+    EXPECT_TRUE(fs::exists(backupDir + "/backup.index"));
+}
+
+// ==================== Retention ====================
+
+TEST_F(BackupStoreTest, Retention_KeepsLastN)
+{
+    BackupStore store(backupDir, RetentionPolicy{3, 0, 0});
+
+    for (int i = 0; i < 10; ++i)
+    {
+        writeData("version " + std::to_string(i));
+        store.backup(dataFile, BASE + i);
+    }
+
+    auto entries = store.getEntries(dataFile);
+    ASSERT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries.front().timestamp, BASE + 7);
+    EXPECT_EQ(objectCount(), 3u);
+}
+
+TEST_F(BackupStoreTest, Retention_KeepsNewestPerHourAndDay)
+{
+    BackupStore store(backupDir, RetentionPolicy{1, 2, 3});
+
+    // Four saves a day, five days in a row
+    int version = 0;
+    for (int day = 0; day < 5; ++day)
+    {
+        for (int hour = 0; hour < 4; ++hour)
+        {
+            writeData("version " + std::to_string(version++));
+            store.backup(dataFile, BASE + day * DAY + hour * HOUR);
+        }
+    }
+
+    std::vector<std::int64_t> kept;
+    for (const auto &entry : store.getEntries(dataFile))
+    {
+        kept.push_back(entry.timestamp - BASE);
+    }
+
+    // Last of days 2 and 3, then the last two hours of day 4
+    std::vector<std::int64_t> expected = {2 * DAY + 3 * HOUR, 3 * DAY + 3 * HOUR,
+                                          4 * DAY + 2 * HOUR, 4 * DAY + 3 * HOUR};
+    EXPECT_EQ(kept, expected);
+    EXPECT_EQ(objectCount(), expected.size());
+}
+
+TEST_F(BackupStoreTest, Retention_IsPerSourceFile)
+{
+    BackupStore store(backupDir, RetentionPolicy{1, 0, 0});
+    std::string otherFile = testDir + "/Other.txt";
+    std::ofstream(otherFile) << "other";
+
+    store.backup(otherFile, BASE);
+    writeData("a");
+    store.backup(dataFile, BASE + 1);
+    writeData("b");
+    store.backup(dataFile, BASE + 2);
+
+    EXPECT_EQ(store.getEntries(otherFile).size(), 1u);
+    EXPECT_EQ(store.getEntries(dataFile).size(), 1u);
+}
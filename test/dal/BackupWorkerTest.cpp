@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include "dal/BackupWorker.h"
+#include "dal/BackupStore.h"
+#include "dal/FileHelper.h"
+
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+using namespace HMS::DAL;
+using namespace std::chrono_literals;
+
+class BackupWorkerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        BackupWorker::resetInstance();
+    }
+
+    void TearDown() override
+    {
+        // Restores the default interval for later tests
+        BackupWorker::resetInstance();
+    }
+
+    // Unique per run so index entries from earlier runs do not interfere
+    static std::string uniquePath(const std::string &name)
+    {
+        return "test_backupworker/" + name + "_" + std::to_string(BackupStore::now()) + ".txt";
+    }
+
+    static std::optional<std::string> latestContent(const std::string &path)
+    {
+        auto latest = BackupStore::getInstance()->getLatest(path);
+        if (!latest)
+            return std::nullopt;
+        return FileHelper::readFile(BackupStore::getInstance()->getObjectPath(*latest));
+    }
+};
+
+// ==================== Coalescing ====================
+
+TEST_F(BackupWorkerTest, Flush_WritesSubmittedContent)
+{
+    std::string path = uniquePath("Flush");
+
+    BackupWorker::getInstance()->submit(path, {"# header", "row1", "row2"});
+    BackupWorker::getInstance()->flush();
+
+    EXPECT_EQ(BackupWorker::getInstance()->getPendingCount(), 0u);
+    EXPECT_EQ(latestContent(path), "# header\nrow1\nrow2\n");
+}
+
+TEST_F(BackupWorkerTest, BurstWithinInterval_CoalescesIntoOneBackup)
+{
+    auto *worker = BackupWorker::getInstance();
+    worker->setInterval(1h);
+    std::string path = uniquePath("Burst");
+
+    worker->submit(path, {"v1"});
+    worker->flush();
+
+    for (int i = 2; i <= 5; ++i)
+    {
+        worker->submit(path, {"v" + std::to_string(i)});
+    }
+    std::this_thread::sleep_for(50ms);
+
+    // Still waiting for the interval: only the first backup exists
+    EXPECT_EQ(worker->getPendingCount(), 1u);
+    EXPECT_EQ(BackupStore::getInstance()->getEntries(path).size(), 1u);
+
+    worker->flush();
+
+    EXPECT_EQ(BackupStore::getInstance()->getEntries(path).size(), 2u);
+    EXPECT_EQ(latestContent(path), "v5\n");
+}
+
+TEST_F(BackupWorkerTest, ElapsedInterval_BacksUpWithoutFlush)
+{
+    auto *worker = BackupWorker::getInstance();
+    worker->setInterval(20ms);
+    std::string path = uniquePath("Interval");
+
+    worker->submit(path, {"v1"});
+    std::this_thread::sleep_for(5ms);
+    worker->submit(path, {"v2"});
+
+    for (int i = 0; i < 200 && latestContent(path) != "v2\n"; ++i)
+    {
+        std::this_thread::sleep_for(5ms);
+    }
+    EXPECT_EQ(latestContent(path), "v2\n");
+}
+
+TEST_F(BackupWorkerTest, Destructor_WritesPendingBackups)
+{
+    BackupWorker::getInstance()->setInterval(1h);
+    std::string path = uniquePath("Shutdown");
+
+    BackupWorker::getInstance()->submit(path, {"v1"});
+    BackupWorker::getInstance()->flush();
+    BackupWorker::getInstance()->submit(path, {"v2"});
+    BackupWorker::resetInstance();
+
+    EXPECT_EQ(latestContent(path), "v2\n");
+}
+
+TEST_F(BackupWorkerTest, Submit_TestFixture_IsIgnored)
+{
+    BackupWorker::getInstance()->submit("test/fixtures/Ignored.txt", {"row"});
+
+    EXPECT_EQ(BackupWorker::getInstance()->getPendingCount(), 0u);
+}
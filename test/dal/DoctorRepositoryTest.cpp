@@ -886,7 +886,7 @@ TEST_F(DoctorRepositoryTest, Remove_LastDoctor_LeavesRepoEmpty)
     EXPECT_TRUE(repo->getAll().empty());
 }
 
-TEST_F(DoctorRepositoryTest, GetNextId_AfterRemove_IgnoresRemoved)
+TEST_F(DoctorRepositoryTest, GetNextId_AfterRemove_DoesNotReuseId)
 {
     repo->add(createTestDoctor("D001", "user1"));
     repo->add(createTestDoctor("D002", "user2"));
@@ -895,7 +895,7 @@ TEST_F(DoctorRepositoryTest, GetNextId_AfterRemove_IgnoresRemoved)
     repo->remove("D003");
 
     std::string nextId = repo->getNextId();
-    EXPECT_EQ(nextId, "D003");
+    EXPECT_EQ(nextId, "D004");
 }
 
 TEST_F(DoctorRepositoryTest, Clear_FollowedByAdd_StartsClean)
@@ -1300,8 +1300,9 @@ TEST_F(DoctorRepositoryTest, FullWorkflow_AddUpdateSearchRemovePersist)
     EXPECT_EQ(janeAfterReload->getSpecialization(), "Neurosurgery");
     EXPECT_DOUBLE_EQ(janeAfterReload->getConsultationFee(), 950000.0);
 
+    // The removed ID stays reserved across the reload
     std::string nextId = repo->getNextId();
-    EXPECT_EQ(nextId, "D003");
+    EXPECT_EQ(nextId, "D004");
     // Get all specializations
     auto specs = repo->getAllSpecializations();
     EXPECT_EQ(specs.size(), 2u); // Cardiology and Neurosurgery
@@ -1,9 +1,16 @@
 #include <gtest/gtest.h>
 #include "dal/FileHelper.h"
+#include "dal/LineParser.h"
+#include <atomic>
 #include <filesystem>
 #include <fstream>
+#include <thread>
+#include <vector>
 
 using HMS::DAL::FileHelper;
+using HMS::DAL::MappedFile;
+using HMS::DAL::ParseWorkerBudget;
+using HMS::DAL::parseLines;
 namespace fs = std::filesystem;
 
 class FileHelperTest : public ::testing::Test
@@ -104,6 +111,124 @@ TEST_F(FileHelperTest, ReadFile_NonExistentFile_ReturnsNullopt)
     EXPECT_FALSE(result.has_value());
 }
 
+TEST_F(FileHelperTest, MappedFile_ViewMatchesFileContent)
+{
+    createTestFile(testFile, "line1\nline2\n");
+
+    MappedFile file(testFile);
+
+    ASSERT_TRUE(file.isOpen());
+    EXPECT_EQ(file.size(), 12u);
+    EXPECT_EQ(file.view(), "line1\nline2\n");
+}
+
+TEST_F(FileHelperTest, MappedFile_EmptyAndMissingFiles)
+{
+    createTestFile(testFile, "");
+
+    MappedFile empty(testFile);
+    EXPECT_TRUE(empty.isOpen());
+    EXPECT_TRUE(empty.view().empty());
+
+    MappedFile missing(testDir + "/missing.txt");
+    EXPECT_FALSE(missing.isOpen());
+    EXPECT_TRUE(missing.view().empty());
+}
+
+TEST_F(FileHelperTest, MappedFile_MoveKeepsView)
+{
+    createTestFile(testFile, "content");
+
+    MappedFile original(testFile);
+    MappedFile moved(std::move(original));
+
+    EXPECT_FALSE(original.isOpen());
+    ASSERT_TRUE(moved.isOpen());
+    EXPECT_EQ(moved.view(), "content");
+}
+
+TEST_F(FileHelperTest, ReadLineViews_MatchesReadLines)
+{
+    createTestFile(testFile, "# header\nline1\r\n\n   \nline2\n# comment\nline3");
+
+    MappedFile file(testFile);
+    auto views = FileHelper::readLineViews(file);
+
+    ASSERT_EQ(views.size(), 3);
+    EXPECT_EQ(views[0], "line1");
+    EXPECT_EQ(views[1], "line2");
+    EXPECT_EQ(views[2], "line3");
+}
+
+TEST_F(FileHelperTest, ParseLines_KeepsOrderAcrossChunks)
+{
+    const size_t count = HMS::Constants::PARALLEL_LOAD_MIN_LINES * 3 + 7;
+    std::vector<std::string> storage;
+    for (size_t i = 0; i < count; ++i)
+    {
+        storage.push_back(std::to_string(i));
+    }
+    std::vector<std::string_view> lines(storage.begin(), storage.end());
+
+    // Odd lines are rejected, like malformed records
+    auto parsed = parseLines<size_t>(lines, [](std::string_view line) -> std::optional<size_t>
+                                     {
+        size_t value = std::stoul(std::string(line));
+        if (value % 2 == 1)
+            return std::nullopt;
+        return value; });
+
+    ASSERT_EQ(parsed.size(), (count + 1) / 2);
+    for (size_t i = 0; i < parsed.size(); ++i)
+    {
+        EXPECT_EQ(parsed[i], i * 2);
+    }
+}
+
+TEST_F(FileHelperTest, ParseLines_RethrowsWorkerException)
+{
+    std::vector<std::string_view> lines(HMS::Constants::PARALLEL_LOAD_MIN_LINES * 2, "x");
+    lines.back() = "throw";
+
+    EXPECT_THROW(parseLines<int>(lines, [](std::string_view line) -> std::optional<int>
+                                 {
+        if (line == "throw")
+            throw std::runtime_error("bad line");
+        return 1; }),
+                 std::runtime_error);
+}
+
+TEST_F(FileHelperTest, ParseLines_ConcurrentCallsShareWorkerBudget)
+{
+    const size_t cap = std::max(1u, std::thread::hardware_concurrency()) - 1;
+    std::vector<std::string_view> lines(HMS::Constants::PARALLEL_LOAD_MIN_LINES * 16, "1");
+    std::atomic<size_t> peak{0};
+
+    // Seven loaders at once, like the startup load of every repository
+    std::vector<std::thread> loaders;
+    for (int i = 0; i < 7; ++i)
+    {
+        loaders.emplace_back([&lines, &peak]
+                             {
+            auto parsed = parseLines<int>(lines, [&peak](std::string_view) -> std::optional<int>
+                                          {
+                size_t inUse = ParseWorkerBudget::inUse();
+                size_t seen = peak.load();
+                while (inUse > seen && !peak.compare_exchange_weak(seen, inUse))
+                {
+                }
+                return 1; });
+            EXPECT_EQ(parsed.size(), lines.size()); });
+    }
+    for (auto &loader : loaders)
+    {
+        loader.join();
+    }
+
+    EXPECT_LE(peak.load(), cap);
+    EXPECT_EQ(ParseWorkerBudget::inUse(), 0u);
+}
+
 // ==================== Write Operations ====================
 
 TEST_F(FileHelperTest, WriteLines_CreatesFileWithContent)
@@ -141,6 +266,52 @@ TEST_F(FileHelperTest, WriteFile_CreatesFileWithContent)
     EXPECT_EQ(readBack.value(), content);
 }
 
+TEST_F(FileHelperTest, WriteLines_LeavesNoTempFiles)
+{
+    FileHelper::writeLines(testFile, {"a", "b"});
+    FileHelper::writeFile(testFile, "c\n");
+
+    size_t files = 0;
+    for (const auto &entry : fs::directory_iterator(testDir))
+    {
+        EXPECT_EQ(entry.path().filename(), "test.txt");
+        ++files;
+    }
+    EXPECT_EQ(files, 1u);
+}
+
+TEST_F(FileHelperTest, WriteLines_LargeContent_WrittenCompletely)
+{
+    std::vector<std::string> lines(20000, std::string(40, 'x'));
+
+    ASSERT_TRUE(FileHelper::writeLines(testFile, lines));
+
+    EXPECT_EQ(fs::file_size(testFile), lines.size() * 41);
+}
+
+TEST_F(FileHelperTest, WriteLines_MissingDirectory_ReturnsFalse)
+{
+    EXPECT_FALSE(FileHelper::writeLines(testDir + "/missing/test.txt", {"line"}));
+    EXPECT_FALSE(FileHelper::writeFile(testDir + "/missing/test.txt", "content"));
+}
+
+TEST_F(FileHelperTest, WriteFile_FailedReplace_KeepsOldContent)
+{
+    // A directory at the target cannot be replaced by a file
+    fs::create_directories(testDir + "/target");
+    createTestFile(testDir + "/target/keep.txt", "old\n");
+
+    EXPECT_FALSE(FileHelper::writeFile(testDir + "/target", "new"));
+
+    EXPECT_EQ(FileHelper::readFile(testDir + "/target/keep.txt").value(), "old\n");
+    size_t files = 0;
+    for ([[maybe_unused]] const auto &entry : fs::directory_iterator(testDir))
+    {
+        ++files;
+    }
+    EXPECT_EQ(files, 1u);
+}
+
 TEST_F(FileHelperTest, AppendLine_AddsToExistingFile)
 {
     createTestFile(testFile, "line1\n");
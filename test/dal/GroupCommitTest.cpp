@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include "dal/GroupCommit.h"
+#include "dal/AppointmentRepository.h"
+#include "dal/Journal.h"
+#include "model/Appointment.h"
+
+#include <atomic>
+#include <filesystem>
+#include <format>
+#include <thread>
+#include <vector>
+
+using namespace HMS;
+using namespace HMS::DAL;
+using namespace HMS::Model;
+using namespace std::chrono_literals;
+
+namespace
+{
+    const std::string TEST_DATA_FILE = "test/fixtures/GroupCommit_test.txt";
+    constexpr int THREADS = 8;
+    constexpr int WRITES_PER_THREAD = 10;
+}
+
+// ==================== GroupCommit ====================
+
+TEST(GroupCommitTest, ConcurrentWriters_ShareWrites)
+{
+    GroupCommit group;
+    std::shared_mutex dataMutex;
+    int applied = 0;
+    int written = 0;
+    std::atomic<int> flushes{0};
+    std::atomic<int> failures{0};
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        writers.emplace_back([&]
+                             {
+            for (int i = 0; i < WRITES_PER_THREAD; ++i)
+            {
+                dataMutex.lock();
+                int mine = ++applied;
+                bool ok = group.commit(dataMutex, [&]
+                                       {
+                    ++flushes;
+                    std::this_thread::sleep_for(2ms);
+                    written = applied;
+                    return true; });
+
+                // Our change was covered by the write that woke us
+                if (!ok || written < mine)
+                    ++failures;
+                dataMutex.unlock();
+            } });
+    }
+    for (auto &writer : writers)
+    {
+        writer.join();
+    }
+
+    EXPECT_EQ(failures, 0);
+    EXPECT_EQ(written, THREADS * WRITES_PER_THREAD);
+    EXPECT_LT(flushes, THREADS * WRITES_PER_THREAD);
+}
+
+TEST(GroupCommitTest, FailedWrite_ReportedToCaller)
+{
+    GroupCommit group;
+    std::shared_mutex dataMutex;
+
+    dataMutex.lock();
+    EXPECT_FALSE(group.commit(dataMutex, []
+                              { return false; }));
+    EXPECT_TRUE(group.commit(dataMutex, []
+                             { return true; }));
+    dataMutex.unlock();
+}
+
+// ==================== Repository Group Commit ====================
+
+class AppointmentGroupCommitTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::filesystem::create_directories("test/fixtures");
+        removeFiles();
+        openRepository()->clear();
+    }
+
+    void TearDown() override
+    {
+        AppointmentRepository::resetInstance();
+        removeFiles();
+    }
+
+    static AppointmentRepository *openRepository()
+    {
+        AppointmentRepository::resetInstance();
+        auto *repo = AppointmentRepository::getInstance();
+        repo->setFilePath(TEST_DATA_FILE);
+        return repo;
+    }
+
+    static void removeFiles()
+    {
+        std::filesystem::remove(TEST_DATA_FILE);
+        std::filesystem::remove(Journal::getJournalPath(TEST_DATA_FILE));
+    }
+
+    static void addConcurrently(AppointmentRepository *repo)
+    {
+        std::atomic<int> failures{0};
+        std::vector<std::thread> writers;
+        for (int t = 0; t < THREADS; ++t)
+        {
+            writers.emplace_back([repo, t, &failures]
+                                 {
+                for (int i = 0; i < WRITES_PER_THREAD; ++i)
+                {
+                    Appointment appointment(std::format("APT{:03d}", t * WRITES_PER_THREAD + i),
+                                            "patient001", "D001", "2024-03-15", "09:00", "Checkup", 200000.0);
+                    if (!repo->add(appointment))
+                        ++failures;
+                } });
+        }
+        for (auto &writer : writers)
+        {
+            writer.join();
+        }
+        EXPECT_EQ(failures, 0);
+    }
+};
+
+TEST_F(AppointmentGroupCommitTest, ConcurrentAdds_AllPersisted)
+{
+    auto *repo = AppointmentRepository::getInstance();
+    repo->setDurabilityPolicy(DurabilityPolicy::groupCommit());
+
+    addConcurrently(repo);
+
+    EXPECT_EQ(repo->getPendingChangeCount(), 0u);
+    EXPECT_EQ(openRepository()->count(), static_cast<size_t>(THREADS * WRITES_PER_THREAD));
+}
+
+TEST_F(AppointmentGroupCommitTest, ConcurrentAdds_JournalMode_AllPersisted)
+{
+    auto *repo = AppointmentRepository::getInstance();
+    repo->setJournalEnabled(true);
+    repo->setDurabilityPolicy(DurabilityPolicy::groupCommit());
+
+    addConcurrently(repo);
+
+    EXPECT_EQ(repo->getJournalRecordCount(), static_cast<size_t>(THREADS * WRITES_PER_THREAD));
+    EXPECT_EQ(openRepository()->count(), static_cast<size_t>(THREADS * WRITES_PER_THREAD));
+}
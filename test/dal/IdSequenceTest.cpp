@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+
+#include "dal/IdSequence.h"
+#include "dal/AppointmentRepository.h"
+#include "dal/FileHelper.h"
+#include "dal/Journal.h"
+#include "model/Appointment.h"
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <map>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace HMS;
+using namespace HMS::DAL;
+using namespace HMS::Model;
+
+namespace
+{
+    const std::string TEST_DATA_FILE = "test/fixtures/IdSequence_test.txt";
+    constexpr int THREADS = 8;
+    constexpr int IDS_PER_THREAD = 50;
+
+    Appointment makeAppointment(const std::string &id)
+    {
+        return Appointment(id, "patient001", "D001", "2024-03-15", "09:00", "Checkup", 200000.0);
+    }
+}
+
+// ==================== Formatting ====================
+
+TEST(IdSequenceTest, Format_PadsToMinimumWidth)
+{
+    EXPECT_EQ(IdSequence::format("D", 7), "D007");
+    EXPECT_EQ(IdSequence::format("APT", 42), "APT042");
+}
+
+TEST(IdSequenceTest, Format_GrowsBeyondMinimumWidth)
+{
+    EXPECT_EQ(IdSequence::format("D", 1000), "D1000");
+    EXPECT_EQ(IdSequence::format("MED", 123456), "MED123456");
+}
+
+TEST(IdSequenceTest, Parse_AcceptsOnlyPrefixAndDigits)
+{
+    EXPECT_EQ(IdSequence::parse("D", "D042"), 42u);
+    EXPECT_EQ(IdSequence::parse("D", "D1000"), 1000u);
+    EXPECT_FALSE(IdSequence::parse("D", "D").has_value());
+    EXPECT_FALSE(IdSequence::parse("D", "DEP001").has_value());
+    EXPECT_FALSE(IdSequence::parse("D", "D12a").has_value());
+    EXPECT_FALSE(IdSequence::parse("D", "P001").has_value());
+}
+
+TEST(IdSequenceTest, Compare_OrdersByNumber)
+{
+    EXPECT_LT(IdSequence::compare("D999", "D1000"), 0);
+    EXPECT_GT(IdSequence::compare("D1000", "D999"), 0);
+    EXPECT_LT(IdSequence::compare("D002", "D010"), 0);
+    EXPECT_EQ(IdSequence::compare("D010", "D010"), 0);
+    EXPECT_LT(IdSequence::compare("APT500", "D001"), 0);
+
+    std::vector<std::string> ids{"D1000", "D002", "D999", "D010"};
+    std::ranges::sort(ids, [](const auto &a, const auto &b)
+                      { return IdSequence::compare(a, b) < 0; });
+    EXPECT_EQ(ids, (std::vector<std::string>{"D002", "D010", "D999", "D1000"}));
+}
+
+TEST(IdSequenceTest, IdLess_OrdersMapByNumber)
+{
+    std::map<std::string, int, IdLess> byId{{"D1000", 3}, {"D999", 2}, {"D002", 1}};
+
+    std::vector<std::string> keys;
+    for (const auto &[id, value] : byId)
+    {
+        keys.push_back(id);
+    }
+    EXPECT_EQ(keys, (std::vector<std::string>{"D002", "D999", "D1000"}));
+
+    // Transparent: lookup by string_view without building a std::string
+    EXPECT_NE(byId.find(std::string_view("D999")), byId.end());
+}
+
+// ==================== Seeding and Allocation ====================
+
+TEST(IdSequenceTest, Allocate_StartsAtOneAndIncrements)
+{
+    IdSequence sequence("P");
+
+    EXPECT_EQ(sequence.peek(), "P001");
+    EXPECT_EQ(sequence.allocate(), "P001");
+    EXPECT_EQ(sequence.allocate(), "P002");
+    EXPECT_EQ(sequence.peek(), "P003");
+}
+
+TEST(IdSequenceTest, Observe_OnlyRaisesSequence)
+{
+    IdSequence sequence("D");
+
+    sequence.observe("D005");
+    sequence.observe("D003");
+    sequence.observe("XYZ");
+    EXPECT_EQ(sequence.peek(), "D006");
+
+    sequence.observe("D999");
+    EXPECT_EQ(sequence.allocate(), "D1000");
+}
+
+TEST(IdSequenceTest, HeaderLine_RoundTrips)
+{
+    IdSequence sequence("MED");
+    sequence.observe("MED041");
+
+    IdSequence restored("MED");
+    EXPECT_TRUE(restored.restore(sequence.getHeaderLine()));
+    EXPECT_EQ(restored.peek(), "MED042");
+
+    EXPECT_FALSE(restored.restore("# medicineID|name"));
+    EXPECT_FALSE(restored.restore("# nextId=abc"));
+}
+
+TEST(IdSequenceTest, ConcurrentAllocate_ReturnsUniqueIds)
+{
+    IdSequence sequence("APT");
+    std::vector<std::vector<std::string>> allocated(THREADS);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([&sequence, &allocated, t]
+                             {
+            for (int i = 0; i < IDS_PER_THREAD; ++i)
+            {
+                allocated[t].push_back(sequence.allocate());
+            } });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    std::set<std::string> unique;
+    for (const auto &ids : allocated)
+    {
+        unique.insert(ids.begin(), ids.end());
+    }
+    EXPECT_EQ(unique.size(), static_cast<size_t>(THREADS * IDS_PER_THREAD));
+}
+
+// ==================== Repository Sequence ====================
+
+class AppointmentIdSequenceTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::filesystem::create_directories("test/fixtures");
+        removeFiles();
+        openRepository()->clear();
+    }
+
+    void TearDown() override
+    {
+        AppointmentRepository::resetInstance();
+        removeFiles();
+    }
+
+    static AppointmentRepository *openRepository()
+    {
+        AppointmentRepository::resetInstance();
+        auto *repo = AppointmentRepository::getInstance();
+        repo->setFilePath(TEST_DATA_FILE);
+        return repo;
+    }
+
+    static void removeFiles()
+    {
+        std::filesystem::remove(TEST_DATA_FILE);
+        std::filesystem::remove(Journal::getJournalPath(TEST_DATA_FILE));
+    }
+};
+
+TEST_F(AppointmentIdSequenceTest, AllocateId_ReservesIds)
+{
+    auto *repo = AppointmentRepository::getInstance();
+
+    EXPECT_EQ(repo->allocateId(), "APT001");
+    EXPECT_EQ(repo->allocateId(), "APT002");
+    EXPECT_EQ(repo->getNextId(), "APT003");
+}
+
+TEST_F(AppointmentIdSequenceTest, ConcurrentAllocateAndAdd_NoDuplicates)
+{
+    auto *repo = AppointmentRepository::getInstance();
+    std::atomic<int> failures{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([repo, &failures]
+                             {
+            for (int i = 0; i < IDS_PER_THREAD / 10; ++i)
+            {
+                if (!repo->add(makeAppointment(repo->allocateId())))
+                    ++failures;
+            } });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(failures, 0);
+    EXPECT_EQ(repo->count(), static_cast<size_t>(THREADS * (IDS_PER_THREAD / 10)));
+}
+
+TEST_F(AppointmentIdSequenceTest, RemovedId_NotReusedAfterReload)
+{
+    auto *repo = AppointmentRepository::getInstance();
+    repo->add(makeAppointment("APT001"));
+    repo->add(makeAppointment("APT002"));
+    repo->remove("APT002");
+
+    EXPECT_EQ(openRepository()->getNextId(), "APT003");
+}
+
+TEST_F(AppointmentIdSequenceTest, RemovedId_JournalMode_NotReusedAfterReload)
+{
+    auto *repo = AppointmentRepository::getInstance();
+    repo->setJournalEnabled(true);
+    repo->add(makeAppointment("APT001"));
+    repo->add(makeAppointment("APT002"));
+    repo->remove("APT002");
+
+    EXPECT_EQ(openRepository()->getNextId(), "APT003");
+}
+
+TEST_F(AppointmentIdSequenceTest, SequenceStoredInDataFileHeader)
+{
+    auto *repo = AppointmentRepository::getInstance();
+    repo->add(makeAppointment("APT041"));
+
+    auto lines = FileHelper::readAllLines(TEST_DATA_FILE);
+    EXPECT_NE(std::ranges::find(lines, "# nextId=42"), lines.end());
+
+    // Data lines are unaffected by the extra header
+    EXPECT_EQ(FileHelper::readLines(TEST_DATA_FILE).size(), 1u);
+}
+
+TEST_F(AppointmentIdSequenceTest, PreexistingFileWithoutHeader_SeededFromData)
+{
+    AppointmentRepository::resetInstance();
+    FileHelper::writeLines(TEST_DATA_FILE, {makeAppointment("APT998").serialize(),
+                                            makeAppointment("APT999").serialize()});
+
+    EXPECT_EQ(openRepository()->allocateId(), "APT1000");
+}
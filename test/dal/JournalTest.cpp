@@ -0,0 +1,257 @@
+#include <gtest/gtest.h>
+
+#include "dal/Journal.h"
+#include "dal/CompactionWorker.h"
+#include "dal/FileHelper.h"
+#include "dal/PatientRepository.h"
+#include "model/Patient.h"
+
+#include <csignal>
+#include <filesystem>
+#include <format>
+#include <fstream>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+using namespace HMS;
+using namespace HMS::DAL;
+using namespace HMS::Model;
+
+namespace
+{
+    const std::string TEST_DATA_DIR = "test/fixtures/";
+    const std::string TEST_DATA_FILE = "test/fixtures/Journal_test.txt";
+
+    Patient makePatient(const std::string &id, const std::string &name = "Test Patient")
+    {
+        return Patient(id, "user_" + id, name, "0123456789", Gender::MALE,
+                       "1990-01-01", "123 Test St", "None");
+    }
+
+    std::vector<Patient> loadSnapshot()
+    {
+        std::vector<Patient> patients;
+        for (const auto &line : FileHelper::readLines(TEST_DATA_FILE))
+        {
+            auto patient = Patient::deserialize(line);
+            if (patient)
+            {
+                patients.push_back(*patient);
+            }
+        }
+        return patients;
+    }
+}
+
+class JournalTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::filesystem::create_directories(TEST_DATA_DIR);
+        removeFiles();
+        std::ofstream ofs(TEST_DATA_FILE, std::ios::trunc);
+    }
+
+    void TearDown() override
+    {
+        CompactionWorker::getInstance()->waitIdle();
+        removeFiles();
+    }
+
+    void removeFiles()
+    {
+        std::filesystem::remove(TEST_DATA_FILE);
+        std::filesystem::remove(Journal::getJournalPath(TEST_DATA_FILE));
+        std::filesystem::remove(Journal::getJournalPath(TEST_DATA_FILE) + ".compacting");
+    }
+};
+
+// ==================== Append / Read ====================
+
+TEST_F(JournalTest, AppendAndReadRecordsRoundTrip)
+{
+    Journal journal(TEST_DATA_FILE);
+    EXPECT_TRUE(journal.append(Journal::Operation::UPSERT, makePatient("P001").serialize()));
+    EXPECT_TRUE(journal.append(Journal::Operation::REMOVE, "P001"));
+    EXPECT_EQ(journal.getRecordCount(), 2u);
+    EXPECT_GT(journal.getSizeBytes(), 0u);
+
+    auto records = journal.readRecords();
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[0].operation, Journal::Operation::UPSERT);
+    EXPECT_EQ(records[1].operation, Journal::Operation::REMOVE);
+    EXPECT_EQ(records[1].payload, "P001");
+}
+
+TEST_F(JournalTest, AppendBatchWritesAllRecordsInOrder)
+{
+    Journal journal(TEST_DATA_FILE);
+    EXPECT_TRUE(journal.append({{Journal::Operation::UPSERT, makePatient("P001").serialize()},
+                                {Journal::Operation::UPSERT, makePatient("P002").serialize()},
+                                {Journal::Operation::REMOVE, "P001"}}));
+    EXPECT_TRUE(journal.append(std::vector<Journal::Record>{}));
+    EXPECT_EQ(journal.getRecordCount(), 3u);
+
+    auto records = journal.readRecords();
+    ASSERT_EQ(records.size(), 3u);
+    EXPECT_EQ(records[1].payload, makePatient("P002").serialize());
+    EXPECT_EQ(records[2].operation, Journal::Operation::REMOVE);
+    EXPECT_EQ(records[2].payload, "P001");
+}
+
+TEST_F(JournalTest, ReplayAppliesUpsertsAndRemovesInOrder)
+{
+    Journal journal(TEST_DATA_FILE);
+    journal.append(Journal::Operation::UPSERT, makePatient("P002", "Updated").serialize());
+    journal.append(Journal::Operation::REMOVE, "P001");
+    journal.append(Journal::Operation::UPSERT, makePatient("P003").serialize());
+    journal.append(Journal::Operation::UPSERT, makePatient("P001", "Re-added").serialize());
+
+    std::vector<Patient> patients = {makePatient("P001"), makePatient("P002")};
+    journal.replay(patients, [](const Patient &p)
+                   { return p.getPatientID(); });
+
+    ASSERT_EQ(patients.size(), 3u);
+    EXPECT_EQ(patients[0].getPatientID(), "P002");
+    EXPECT_EQ(patients[0].getName(), "Updated");
+    EXPECT_EQ(patients[1].getPatientID(), "P003");
+    EXPECT_EQ(patients[2].getPatientID(), "P001");
+    EXPECT_EQ(patients[2].getName(), "Re-added");
+}
+
+#ifndef _WIN32
+TEST_F(JournalTest, FailedAppendIsCutFromFile)
+{
+    Journal journal(TEST_DATA_FILE);
+    ASSERT_TRUE(journal.append(Journal::Operation::UPSERT, makePatient("P001").serialize()));
+    const auto sizeBefore = std::filesystem::file_size(journal.getFilePath());
+
+    // Let the batch write only part of its bytes before the file size limit stops it
+    rlimit original{};
+    ASSERT_EQ(getrlimit(RLIMIT_FSIZE, &original), 0);
+    auto previousHandler = std::signal(SIGXFSZ, SIG_IGN);
+    rlimit limited = original;
+    limited.rlim_cur = sizeBefore + 100;
+    ASSERT_EQ(setrlimit(RLIMIT_FSIZE, &limited), 0);
+
+    const std::string longName(200, 'x');
+    bool written = journal.append({{Journal::Operation::UPSERT, makePatient("P002", longName).serialize()},
+                                   {Journal::Operation::UPSERT, makePatient("P003", longName).serialize()}});
+
+    setrlimit(RLIMIT_FSIZE, &original);
+    std::signal(SIGXFSZ, previousHandler);
+
+    EXPECT_FALSE(written);
+    EXPECT_EQ(std::filesystem::file_size(journal.getFilePath()), sizeBefore);
+
+    EXPECT_TRUE(journal.append(Journal::Operation::REMOVE, "P001"));
+
+    auto records = journal.readRecords();
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[0].payload, makePatient("P001").serialize());
+    EXPECT_EQ(records[1].operation, Journal::Operation::REMOVE);
+    EXPECT_EQ(records[1].payload, "P001");
+}
+#endif
+
+TEST_F(JournalTest, TruncateRemovesJournalFile)
+{
+    Journal journal(TEST_DATA_FILE);
+    journal.append(Journal::Operation::REMOVE, "P001");
+    EXPECT_TRUE(journal.truncate());
+    EXPECT_EQ(journal.getRecordCount(), 0u);
+    EXPECT_FALSE(FileHelper::fileExists(journal.getFilePath()));
+}
+
+// ==================== Compaction ====================
+
+TEST_F(JournalTest, ThresholdTriggersBackgroundSnapshot)
+{
+    Journal journal(TEST_DATA_FILE);
+    journal.setCompactionPolicy({2, 0});
+
+    std::vector<Patient> patients = {makePatient("P001")};
+    journal.append(Journal::Operation::UPSERT, patients[0].serialize(), patients, "Patient");
+    EXPECT_FALSE(journal.isCompactionPending());
+
+    patients.push_back(makePatient("P002"));
+    journal.append(Journal::Operation::UPSERT, patients[1].serialize(), patients, "Patient");
+
+    // Active journal was rotated; the worker owns the copy and writes the snapshot
+    EXPECT_EQ(journal.getRecordCount(), 0u);
+    journal.waitForCompaction();
+
+    auto snapshot = loadSnapshot();
+    ASSERT_EQ(snapshot.size(), 2u);
+    EXPECT_EQ(snapshot[1].getPatientID(), "P002");
+    EXPECT_TRUE(journal.readRecords().empty());
+}
+
+TEST_F(JournalTest, RecordsAfterRotationAreReplayedOverSnapshot)
+{
+    Journal journal(TEST_DATA_FILE);
+    Snapshot<Patient> patients = std::make_shared<const std::vector<Patient>>(
+        std::vector<Patient>{makePatient("P001"), makePatient("P002")});
+    ASSERT_TRUE(journal.compactInBackground(patients, "Patient"));
+
+    journal.append(Journal::Operation::REMOVE, "P001");
+    journal.append(Journal::Operation::UPSERT, makePatient("P003").serialize());
+
+    journal.waitForCompaction();
+    auto loaded = loadSnapshot();
+    journal.replay(loaded, [](const Patient &p)
+                   { return p.getPatientID(); });
+
+    ASSERT_EQ(loaded.size(), 2u);
+    EXPECT_EQ(loaded[0].getPatientID(), "P002");
+    EXPECT_EQ(loaded[1].getPatientID(), "P003");
+}
+
+TEST_F(JournalTest, InterruptedCompactionSegmentIsReplayedFirst)
+{
+    {
+        // Segment left behind by a compaction that never finished
+        std::ofstream segment(Journal::getJournalPath(TEST_DATA_FILE) + ".compacting");
+        segment << "U|" << makePatient("P001", "Old").serialize() << "\n";
+    }
+
+    Journal journal(TEST_DATA_FILE);
+    journal.append(Journal::Operation::UPSERT, makePatient("P001", "New").serialize());
+
+    std::vector<Patient> patients;
+    journal.replay(patients, [](const Patient &p)
+                   { return p.getPatientID(); });
+
+    ASSERT_EQ(patients.size(), 1u);
+    EXPECT_EQ(patients[0].getName(), "New");
+}
+
+TEST_F(JournalTest, RepositoryCompactsAndReloads)
+{
+    PatientRepository::resetInstance();
+    auto *repo = PatientRepository::getInstance();
+    repo->setFilePath(TEST_DATA_FILE);
+    repo->clear();
+    repo->setJournalEnabled(true);
+    repo->setCompactionPolicy({3, 0});
+
+    for (int i = 1; i <= 7; ++i)
+    {
+        ASSERT_TRUE(repo->add(makePatient(std::format("P{:03d}", i))));
+        CompactionWorker::getInstance()->waitIdle();
+    }
+
+    // Two compactions ran (after records 3 and 6); only the last add is still journaled
+    EXPECT_EQ(repo->getJournalRecordCount(), 1u);
+    EXPECT_EQ(loadSnapshot().size(), 6u);
+
+    PatientRepository::resetInstance();
+    repo = PatientRepository::getInstance();
+    repo->setFilePath(TEST_DATA_FILE);
+    EXPECT_EQ(repo->count(), 7u);
+
+    PatientRepository::resetInstance();
+}
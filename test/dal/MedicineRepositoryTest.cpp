@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include "dal/MedicineRepository.h"
+#include "dal/DataSnapshot.h"
+#include "dal/BackupWorker.h"
 #include "advance/Medicine.h"
 #include "common/Constants.h"
 
@@ -1042,6 +1044,9 @@ TEST_F(MedicineRepositoryTest, Save_CreatesBackup)
     // Second add - should trigger backup
     repo->add(createTestMedicine("MED002", "Ibuprofen"));
 
+    // Backups are written by the background worker
+    HMS::DAL::BackupWorker::getInstance()->flush();
+
     std::string backupDir = HMS::Constants::BACKUP_DIR;
 
     if (!std::filesystem::exists(backupDir)) {
@@ -1215,6 +1220,111 @@ TEST_F(MedicineRepositoryTest, EdgeCase_MaxIntQuantity_HandledCorrectly)
     EXPECT_EQ(updated->getQuantityInStock(), INT_MAX);
 }
 
+// ==================== Snapshot Tests ====================
+
+TEST_F(MedicineRepositoryTest, Snapshot_WithoutWrites_SharesStorage)
+{
+    repo->add(createTestMedicine("MED001", "Paracetamol"));
+
+    auto first = repo->getSnapshot();
+    auto second = repo->getSnapshot();
+
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(first->size(), 1u);
+}
+
+TEST_F(MedicineRepositoryTest, Snapshot_UnaffectedByLaterWrites)
+{
+    repo->add(createTestMedicine("MED001", "Paracetamol", "ABC", 100));
+    repo->add(createTestMedicine("MED002", "Ibuprofen"));
+
+    auto snapshot = repo->getSnapshot();
+
+    repo->updateStock("MED001", 5);
+    repo->remove("MED002");
+    repo->add(createTestMedicine("MED003", "Aspirin"));
+
+    ASSERT_EQ(snapshot->size(), 2u);
+    EXPECT_EQ((*snapshot)[0].getMedicineID(), "MED001");
+    EXPECT_EQ((*snapshot)[0].getQuantityInStock(), 100);
+    EXPECT_EQ((*snapshot)[1].getMedicineID(), "MED002");
+
+    EXPECT_EQ(repo->count(), 2u);
+    EXPECT_EQ(repo->getById("MED001")->getQuantityInStock(), 5);
+    EXPECT_NE(repo->getSnapshot().get(), snapshot.get());
+}
+
+TEST_F(MedicineRepositoryTest, DataSnapshot_CapturesOnlyRequestedSources)
+{
+    repo->add(createTestMedicine("MED001", "Paracetamol"));
+
+    auto data = DataSnapshot::capture(DataSnapshot::MEDICINES);
+
+    ASSERT_NE(data.medicines, nullptr);
+    EXPECT_EQ(data.medicines->size(), 1u);
+    EXPECT_EQ(data.patients, nullptr);
+    EXPECT_EQ(data.prescriptions, nullptr);
+}
+
+// ==================== Zero-Copy Access Tests ====================
+
+TEST_F(MedicineRepositoryTest, View_BorrowsRecordsInPlace)
+{
+    repo->add(createTestMedicine("MED001", "Paracetamol"));
+    repo->add(createTestMedicine("MED002", "Ibuprofen"));
+
+    auto snapshot = repo->getSnapshot();
+    {
+        auto view = repo->view();
+
+        ASSERT_EQ(view.size(), 2u);
+        EXPECT_EQ(view[1].getMedicineID(), "MED002");
+        EXPECT_EQ(&view[0], &(*snapshot)[0]);
+    }
+
+    // The view's lock is released once it goes out of scope
+    EXPECT_TRUE(repo->updateStock("MED001", 1));
+}
+
+TEST_F(MedicineRepositoryTest, ForEach_VisitsEveryRecordInOrder)
+{
+    repo->add(createTestMedicine("MED001", "Paracetamol"));
+    repo->add(createTestMedicine("MED002", "Ibuprofen"));
+    repo->add(createTestMedicine("MED003", "Aspirin"));
+
+    std::vector<std::string> ids;
+    repo->forEach([&ids](const Medicine &med)
+                  { ids.push_back(med.getMedicineID()); });
+
+    EXPECT_EQ(ids, (std::vector<std::string>{"MED001", "MED002", "MED003"}));
+}
+
+TEST_F(MedicineRepositoryTest, Scan_VisitsOnlyMatchingRecords)
+{
+    repo->add(createTestMedicine("MED001", "Paracetamol", "ABC", 0));
+    repo->add(createTestMedicine("MED002", "Ibuprofen", "ABC", 50));
+    repo->add(createTestMedicine("MED003", "Aspirin", "ABC", 0));
+
+    int totalStock = 0;
+    size_t visited = repo->scan(
+        [](const Medicine &med)
+        { return med.getQuantityInStock() == 0; },
+        [&totalStock](const Medicine &med)
+        { totalStock += med.getQuantityInStock(); });
+
+    EXPECT_EQ(visited, 2u);
+    EXPECT_EQ(totalStock, 0);
+}
+
+TEST_F(MedicineRepositoryTest, Scan_EmptyRepository_VisitsNothing)
+{
+    size_t visited = repo->scan([](const Medicine &)
+                                { return true; },
+                                [](const Medicine &) {});
+
+    EXPECT_EQ(visited, 0u);
+}
+
 // ==================== Concurrent Access Tests ====================
 
 TEST_F(MedicineRepositoryTest, Concurrent_MultipleGetInstance_ReturnsSame)
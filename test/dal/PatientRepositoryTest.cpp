@@ -2,8 +2,11 @@
 #include "dal/PatientRepository.h"
 #include "model/Patient.h"
 #include "common/Types.h"
+#include <atomic>
 #include <fstream>
 #include <filesystem>
+#include <format>
+#include <thread>
 
 using namespace HMS;
 using namespace HMS::DAL;
@@ -129,6 +132,127 @@ TEST_F(PatientRepositoryTest, Add_DifferentGenders_AllAdded)
     EXPECT_EQ(repo->count(), 3u);
 }
 
+// ==================== AddRange / UpsertRange Tests ====================
+
+TEST_F(PatientRepositoryTest, AddRange_AllAddedAndPersisted)
+{
+    std::vector<Patient> batch;
+    for (int i = 1; i <= 100; ++i)
+    {
+        batch.push_back(createTestPatient(std::format("P{:03d}", i), std::format("user{}", i)));
+    }
+
+    EXPECT_TRUE(repo->addRange(batch));
+    EXPECT_EQ(repo->count(), 100u);
+    EXPECT_EQ(repo->getById("P042")->getUsername(), "user42");
+    EXPECT_EQ(repo->getNextId(), "P101");
+
+    PatientRepository::resetInstance();
+    repo = PatientRepository::getInstance();
+    repo->setFilePath(testFilePath);
+    EXPECT_EQ(repo->count(), 100u);
+}
+
+TEST_F(PatientRepositoryTest, AddRange_ExistingId_NothingAdded)
+{
+    repo->add(createTestPatient("P002", "existing"));
+
+    EXPECT_FALSE(repo->addRange({createTestPatient("P001", "user1"),
+                                 createTestPatient("P002", "user2")}));
+    EXPECT_EQ(repo->count(), 1u);
+    EXPECT_FALSE(repo->exists("P001"));
+}
+
+TEST_F(PatientRepositoryTest, AddRange_RepeatedIdInBatch_NothingAdded)
+{
+    EXPECT_FALSE(repo->addRange({createTestPatient("P001", "user1"),
+                                 createTestPatient("P001", "user2")}));
+    EXPECT_EQ(repo->count(), 0u);
+}
+
+TEST_F(PatientRepositoryTest, AddRange_Empty_ReturnsTrue)
+{
+    EXPECT_TRUE(repo->addRange({}));
+    EXPECT_EQ(repo->count(), 0u);
+}
+
+TEST_F(PatientRepositoryTest, UpsertRange_InsertsAndReplaces)
+{
+    repo->add(createTestPatient("P001", "user1", "Old Name"));
+
+    EXPECT_TRUE(repo->upsertRange({createTestPatient("P001", "user1", "New Name"),
+                                   createTestPatient("P002", "user2")}));
+    EXPECT_EQ(repo->count(), 2u);
+    EXPECT_EQ(repo->getById("P001")->getName(), "New Name");
+    EXPECT_TRUE(repo->exists("P002"));
+}
+
+TEST_F(PatientRepositoryTest, UpsertRange_JournalMode_ReplayedAfterReload)
+{
+    repo->setJournalEnabled(true);
+    repo->add(createTestPatient("P001", "user1", "Old Name"));
+
+    EXPECT_TRUE(repo->upsertRange({createTestPatient("P001", "user1", "New Name"),
+                                   createTestPatient("P002", "user2")}));
+    EXPECT_EQ(repo->getJournalRecordCount(), 3u);
+
+    PatientRepository::resetInstance();
+    repo = PatientRepository::getInstance();
+    repo->setFilePath(testFilePath);
+    EXPECT_EQ(repo->count(), 2u);
+    EXPECT_EQ(repo->getById("P001")->getName(), "New Name");
+}
+
+TEST_F(PatientRepositoryTest, RangeOperations_UniqueKey_CheckedAgainstFinalState)
+{
+    const PatientRepository::UniqueKey byUsername = &Patient::getUsername;
+    repo->add(createTestPatient("P001", "user1"));
+
+    EXPECT_FALSE(repo->addRange({createTestPatient("P002", "user1")}, byUsername));
+    EXPECT_FALSE(repo->addRange({createTestPatient("P002", "dup"),
+                                 createTestPatient("P003", "dup")},
+                                byUsername));
+    EXPECT_EQ(repo->count(), 1u);
+
+    // Empty keys are not compared
+    EXPECT_TRUE(repo->addRange({createTestPatient("P002", ""),
+                                createTestPatient("P003", "")},
+                               byUsername));
+
+    // P001 gives up user1 in the same batch that hands it to P002
+    EXPECT_TRUE(repo->upsertRange({createTestPatient("P001", "renamed"),
+                                   createTestPatient("P002", "user1")},
+                                  byUsername));
+    EXPECT_EQ(repo->getByUsername("user1")->getPatientID(), "P002");
+
+    EXPECT_FALSE(repo->upsertRange({createTestPatient("P003", "renamed")}, byUsername));
+    EXPECT_EQ(repo->getById("P003")->getUsername(), "");
+}
+
+TEST_F(PatientRepositoryTest, RangeOperations_WriteFails_NothingChanged)
+{
+    const std::string missingDir = TEST_DATA_DIR + "range_write_fails/";
+    std::filesystem::create_directories(missingDir);
+    repo->setFilePath(missingDir + "Patient.txt");
+    repo->add(createTestPatient("P001", "user1", "Old Name"));
+
+    // Every later write of the data file fails
+    std::filesystem::remove_all(missingDir);
+
+    EXPECT_FALSE(repo->addRange({createTestPatient("P002", "user2"),
+                                 createTestPatient("P003", "user3")}));
+    EXPECT_EQ(repo->count(), 1u);
+    EXPECT_FALSE(repo->exists("P002"));
+
+    EXPECT_FALSE(repo->upsertRange({createTestPatient("P001", "user1", "New Name"),
+                                    createTestPatient("P004", "user4"),
+                                    createTestPatient("P001", "user1", "Newer Name")}));
+    EXPECT_EQ(repo->count(), 1u);
+    EXPECT_EQ(repo->getById("P001")->getName(), "Old Name");
+    EXPECT_FALSE(repo->exists("P004"));
+    EXPECT_EQ(repo->getAll().size(), 1u);
+}
+
 // ==================== GetById Tests ====================
 
 TEST_F(PatientRepositoryTest, GetById_ExistingPatient_ReturnsPatient)
@@ -318,6 +442,40 @@ TEST_F(PatientRepositoryTest, Remove_FromMiddle_OthersRemain)
     EXPECT_TRUE(repo->exists("P003"));
 }
 
+TEST_F(PatientRepositoryTest, Remove_FromMiddle_LaterPatientsStillResolveById)
+{
+    repo->add(createTestPatient("P001", "user1", "First"));
+    repo->add(createTestPatient("P002", "user2", "Second"));
+    repo->add(createTestPatient("P003", "user3", "Third"));
+    repo->add(createTestPatient("P004", "user4", "Fourth"));
+
+    repo->remove("P002");
+
+    auto third = repo->getById("P003");
+    ASSERT_TRUE(third.has_value());
+    EXPECT_EQ(third->getName(), "Third");
+
+    Patient updated = createTestPatient("P004", "user4", "Fourth Updated");
+    EXPECT_TRUE(repo->update(updated));
+    EXPECT_EQ(repo->getById("P004")->getName(), "Fourth Updated");
+    EXPECT_EQ(repo->getById("P001")->getName(), "First");
+
+    // Re-adding the removed ID takes a fresh slot
+    EXPECT_TRUE(repo->add(createTestPatient("P002", "user2", "Second Again")));
+    EXPECT_EQ(repo->getById("P002")->getName(), "Second Again");
+}
+
+TEST_F(PatientRepositoryTest, GetById_AfterReload_UsesRebuiltIndex)
+{
+    repo->add(createTestPatient("P001", "user1", "First"));
+    repo->add(createTestPatient("P002", "user2", "Second"));
+
+    repo->load();
+
+    EXPECT_FALSE(repo->add(createTestPatient("P002", "user2")));
+    EXPECT_EQ(repo->getById("P002")->getName(), "Second");
+}
+
 // ==================== Exists Tests ====================
 
 TEST_F(PatientRepositoryTest, Exists_ExistingPatient_ReturnsTrue)
@@ -853,6 +1011,52 @@ TEST_F(PatientRepositoryTest, ConcurrentAccess_SingletonWorks)
     EXPECT_TRUE(repo2->exists("P001"));
 }
 
+TEST_F(PatientRepositoryTest, ConcurrentReadersDuringWrites_SeeWholeRecords)
+{
+    for (int i = 0; i < 20; ++i)
+    {
+        repo->add(createTestPatient(std::format("P{:03}", i), std::format("user{}", i),
+                                    "Test Patient", "0123456789", Gender::MALE, "1990-01-01",
+                                    "A-", "H-"));
+    }
+
+    // Reload lazily so the first readers race to load the file
+    repo->setFilePath(testFilePath);
+
+    std::atomic<bool> torn{false};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r)
+    {
+        readers.emplace_back([&]
+                             {
+            for (int i = 0; i < 200; ++i)
+            {
+                auto patient = repo->getById(std::format("P{:03}", i % 20));
+                // Address and history are always written together below
+                if (!patient || patient->getAddress().substr(1) != patient->getMedicalHistory().substr(1))
+                    torn = true;
+                if (repo->count() != 20)
+                    torn = true;
+            } });
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        std::string tag = std::to_string(i);
+        repo->update(createTestPatient(std::format("P{:03}", i % 20), std::format("user{}", i % 20),
+                                       "Test Patient", "0123456789", Gender::MALE, "1990-01-01",
+                                       "A" + tag, "H" + tag));
+    }
+
+    for (auto &reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_FALSE(torn);
+    EXPECT_EQ(repo->count(), 20u);
+}
+
 /*
 Build va run tests:
 cd build && ./HospitalTests --gtest_filter="PatientRepositoryTest.*"
@@ -1,9 +1,11 @@
 #include <gtest/gtest.h>
 #include "dal/PrescriptionRepository.h"
+#include "dal/Journal.h"
 #include "advance/Prescription.h"
 #include "common/Utils.h"
 #include "common/Constants.h"
 #include <filesystem>
+#include <format>
 #include <fstream>
 
 namespace fs = std::filesystem;
@@ -144,6 +146,30 @@ TEST_F(PrescriptionRepositoryTest, ResetInstanceCreatesNewInstance)
     repo = newInstance;
 }
 
+TEST_F(PrescriptionRepositoryTest, FreshInstanceRewritesFileWithoutJournal)
+{
+    std::string journalPath = HMS::DAL::Journal::getJournalPath(testFilePath);
+    fs::remove(journalPath);
+
+    EXPECT_FALSE(repo->isJournalEnabled());
+    EXPECT_TRUE(repo->add(createTestPrescription("PRE001", "APT001", "patient001", "D001")));
+    EXPECT_EQ(repo->getJournalRecordCount(), 0);
+    EXPECT_FALSE(fs::exists(journalPath));
+}
+
+TEST_F(PrescriptionRepositoryTest, JournalModeAppendsNextToDataFile)
+{
+    std::string journalPath = HMS::DAL::Journal::getJournalPath(testFilePath);
+    repo->setJournalEnabled(true);
+
+    EXPECT_TRUE(repo->add(createTestPrescription("PRE001", "APT001", "patient001", "D001")));
+    EXPECT_EQ(repo->getJournalRecordCount(), 1);
+    EXPECT_TRUE(fs::exists(journalPath));
+
+    repo->setJournalEnabled(false);
+    fs::remove(journalPath);
+}
+
 // ==================== CRUD Operations Tests ====================
 
 TEST_F(PrescriptionRepositoryTest, AddPrescriptionSuccess)
@@ -377,6 +403,37 @@ TEST_F(PrescriptionRepositoryTest, PersistenceWithComplexItems)
     EXPECT_EQ(items[1].quantity, 10);
 }
 
+TEST_F(PrescriptionRepositoryTest, LoadLargeFileKeepsFileOrder)
+{
+    // Enough lines to be split across several loader threads
+    const size_t count = HMS::Constants::PARALLEL_LOAD_MIN_LINES * 4 + 3;
+    {
+        std::ofstream file(testFilePath, std::ios::trunc);
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::string id = std::format("PRE{:06}", i);
+            file << createPrescriptionWithItems(id, "APT001", "patient001", "D001").serialize() << '\n';
+            if (i == count / 2)
+            {
+                file << "not|a|valid|record\n";
+            }
+        }
+    }
+
+    HMS::DAL::PrescriptionRepository::resetInstance();
+    repo = HMS::DAL::PrescriptionRepository::getInstance();
+    repo->setFilePath(testFilePath);
+
+    auto results = repo->getAll();
+    ASSERT_EQ(results.size(), count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(results[i].getPrescriptionID(), std::format("PRE{:06}", i));
+    }
+    EXPECT_EQ(results.back().getItemCount(), 2);
+    EXPECT_TRUE(repo->exists(std::format("PRE{:06}", count - 1)));
+}
+
 TEST_F(PrescriptionRepositoryTest, ExplicitSaveRequired)
 {
     auto presc = createTestPrescription("PRE001", "APT001", "patient001", "D001");
@@ -743,6 +800,28 @@ TEST_F(PrescriptionRepositoryTest, GetByDateRangeSingleDay)
     EXPECT_EQ(results[0].getPrescriptionID(), "PRE002");
 }
 
+TEST_F(PrescriptionRepositoryTest, GetByDateRangeReversedBoundsReturnsEmpty)
+{
+    populateTestData();
+
+    EXPECT_TRUE(repo->getByDateRange("2024-03-18", "2024-03-15").empty());
+}
+
+TEST_F(PrescriptionRepositoryTest, GetByDateRangeFollowsUpdatedAndRemovedDates)
+{
+    populateTestData();
+
+    // Move PRE004 into the range and drop PRE003 from it
+    repo->update(createTestPrescription("PRE004", "APT004", "patient003", "D003", "2024-03-16"));
+    repo->remove("PRE003");
+
+    auto results = repo->getByDateRange("2024-03-16", "2024-03-17");
+    ASSERT_EQ(results.size(), 2);
+    EXPECT_EQ(results[0].getPrescriptionDate(), "2024-03-16");
+    EXPECT_EQ(results[1].getPrescriptionDate(), "2024-03-16");
+    EXPECT_TRUE(repo->getByDate("2024-03-18").empty());
+}
+
 TEST_F(PrescriptionRepositoryTest, GetByMedicineFound)
 {
     auto presc = createPrescriptionWithItems("PRE001", "APT001", "patient001", "D001");
@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include "dal/UnitOfWork.h"
+#include "dal/MedicineRepository.h"
+#include "dal/PrescriptionRepository.h"
+#include "dal/Journal.h"
+#include "advance/Medicine.h"
+#include "advance/Prescription.h"
+
+#include <filesystem>
+
+using namespace HMS::DAL;
+using namespace HMS::Model;
+
+namespace
+{
+    const std::string MEDICINE_FILE = "test/fixtures/UnitOfWork_medicines.txt";
+    const std::string PRESCRIPTION_FILE = "test/fixtures/UnitOfWork_prescriptions.txt";
+}
+
+class UnitOfWorkTest : public ::testing::Test
+{
+protected:
+    MedicineRepository *medicineRepo;
+    PrescriptionRepository *prescriptionRepo;
+
+    void SetUp() override
+    {
+        std::filesystem::create_directories("test/fixtures");
+        removeFiles();
+        openRepositories();
+
+        medicineRepo->add(Medicine("MED001", "Paracetamol", "Painkiller", 5000.0, 100));
+        medicineRepo->add(Medicine("MED002", "Amoxicillin", "Antibiotic", 12000.0, 10));
+
+        Prescription presc("PRE001", "APT001", "patient001", "D001", "2024-03-15");
+        prescriptionRepo->add(presc);
+    }
+
+    void TearDown() override
+    {
+        MedicineRepository::resetInstance();
+        PrescriptionRepository::resetInstance();
+        removeFiles();
+    }
+
+    // Fresh singletons reading the test files, as after a restart
+    void openRepositories()
+    {
+        MedicineRepository::resetInstance();
+        PrescriptionRepository::resetInstance();
+        medicineRepo = MedicineRepository::getInstance();
+        medicineRepo->setFilePath(MEDICINE_FILE);
+        prescriptionRepo = PrescriptionRepository::getInstance();
+        prescriptionRepo->setFilePath(PRESCRIPTION_FILE);
+    }
+
+    static void removeFiles()
+    {
+        for (const auto &path : {MEDICINE_FILE, PRESCRIPTION_FILE})
+        {
+            std::filesystem::remove(path);
+            std::filesystem::remove(Journal::getJournalPath(path));
+        }
+    }
+
+    int stockOf(const std::string &id)
+    {
+        return medicineRepo->getById(id)->getQuantityInStock();
+    }
+};
+
+// ==================== Commit ====================
+
+TEST_F(UnitOfWorkTest, Commit_AppliesAndPersistsAllChanges)
+{
+    UnitOfWork work;
+    work.adjustStock("MED001", -30);
+    work.adjustStock("MED002", -10);
+    work.markDispensed("PRE001");
+
+    ASSERT_TRUE(work.commit());
+    EXPECT_TRUE(work.isEmpty());
+    EXPECT_EQ(work.getCommittedMedicine("MED001")->getQuantityInStock(), 70);
+    EXPECT_FALSE(work.getCommittedMedicine("MED999").has_value());
+
+    openRepositories();
+    EXPECT_EQ(stockOf("MED001"), 70);
+    EXPECT_EQ(stockOf("MED002"), 0);
+    EXPECT_TRUE(prescriptionRepo->getById("PRE001")->isDispensed());
+}
+
+TEST_F(UnitOfWorkTest, Commit_InsufficientStock_ChangesNothing)
+{
+    UnitOfWork work;
+    work.adjustStock("MED001", -30);
+    work.adjustStock("MED002", -11);
+    work.markDispensed("PRE001");
+
+    EXPECT_FALSE(work.commit());
+    EXPECT_EQ(work.getFailedMedicines(), std::vector<std::string>{"MED002"});
+    EXPECT_TRUE(work.getFailedPrescriptions().empty());
+
+    EXPECT_EQ(stockOf("MED001"), 100);
+    EXPECT_EQ(stockOf("MED002"), 10);
+    EXPECT_FALSE(prescriptionRepo->getById("PRE001")->isDispensed());
+}
+
+TEST_F(UnitOfWorkTest, Commit_RepeatedMedicine_DeltasAddUp)
+{
+    UnitOfWork work;
+    work.adjustStock("MED002", -6);
+    work.adjustStock("MED002", -6);
+
+    EXPECT_FALSE(work.commit());
+    EXPECT_EQ(work.getFailedMedicines(), std::vector<std::string>{"MED002"});
+    EXPECT_EQ(stockOf("MED002"), 10);
+}
+
+TEST_F(UnitOfWorkTest, Commit_AlreadyDispensed_ChangesNothing)
+{
+    prescriptionRepo->markAsDispensed("PRE001");
+
+    UnitOfWork work;
+    work.adjustStock("MED001", -30);
+    work.markDispensed("PRE001");
+
+    EXPECT_FALSE(work.commit());
+    EXPECT_EQ(work.getFailedPrescriptions(), std::vector<std::string>{"PRE001"});
+    EXPECT_EQ(stockOf("MED001"), 100);
+}
+
+TEST_F(UnitOfWorkTest, Commit_MissingRecords_Fail)
+{
+    UnitOfWork work;
+    work.adjustStock("MED999", -1);
+    work.markDispensed("PRE999");
+
+    EXPECT_FALSE(work.commit());
+    EXPECT_EQ(work.getFailedMedicines(), std::vector<std::string>{"MED999"});
+    EXPECT_EQ(work.getFailedPrescriptions(), std::vector<std::string>{"PRE999"});
+}
+
+TEST_F(UnitOfWorkTest, Commit_JournalMode_AppendsOneBatchPerRepository)
+{
+    medicineRepo->setJournalEnabled(true);
+    prescriptionRepo->setJournalEnabled(true);
+
+    UnitOfWork work;
+    work.adjustStock("MED001", -1);
+    work.adjustStock("MED002", -1);
+    work.markDispensed("PRE001");
+    ASSERT_TRUE(work.commit());
+
+    EXPECT_EQ(medicineRepo->getJournalRecordCount(), 2u);
+    EXPECT_EQ(prescriptionRepo->getJournalRecordCount(), 1u);
+
+    openRepositories();
+    EXPECT_EQ(stockOf("MED001"), 99);
+    EXPECT_EQ(stockOf("MED002"), 9);
+    EXPECT_TRUE(prescriptionRepo->getById("PRE001")->isDispensed());
+}
+
+TEST_F(UnitOfWorkTest, Commit_GroupCommitSecondWriteFails_NothingPersisted)
+{
+    medicineRepo->setJournalEnabled(true);
+    prescriptionRepo->setJournalEnabled(true);
+    medicineRepo->setDurabilityPolicy(DurabilityPolicy::groupCommit());
+    prescriptionRepo->setDurabilityPolicy(DurabilityPolicy::groupCommit());
+
+    // A directory in place of the journal makes the prescription write fail
+    const std::string prescriptionJournal = Journal::getJournalPath(PRESCRIPTION_FILE);
+    std::filesystem::create_directory(prescriptionJournal);
+
+    UnitOfWork work;
+    work.adjustStock("MED001", -30);
+    work.markDispensed("PRE001");
+    EXPECT_FALSE(work.commit());
+    EXPECT_EQ(stockOf("MED001"), 100);
+    EXPECT_FALSE(prescriptionRepo->getById("PRE001")->isDispensed());
+
+    // Shutting down flushes whatever is still queued
+    std::filesystem::remove(prescriptionJournal);
+    openRepositories();
+    EXPECT_EQ(stockOf("MED001"), 100);
+    EXPECT_FALSE(prescriptionRepo->getById("PRE001")->isDispensed());
+}
+
+TEST_F(UnitOfWorkTest, Commit_Empty_Succeeds)
+{
+    UnitOfWork work;
+
+    EXPECT_TRUE(work.isEmpty());
+    EXPECT_TRUE(work.commit());
+}
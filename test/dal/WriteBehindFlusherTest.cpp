@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+
+#include "dal/WriteBehindFlusher.h"
+#include "dal/FileHelper.h"
+#include "dal/Journal.h"
+#include "dal/PatientRepository.h"
+#include "model/Patient.h"
+
+#include <atomic>
+#include <filesystem>
+#include <format>
+#include <thread>
+
+using namespace HMS;
+using namespace HMS::DAL;
+using namespace HMS::Model;
+using namespace std::chrono_literals;
+
+namespace
+{
+    const std::string TEST_DATA_FILE = "test/fixtures/WriteBehind_test.txt";
+
+    Patient makePatient(int n)
+    {
+        std::string id = std::format("P{:03d}", n);
+        return Patient(id, "user_" + id, "Test Patient", "0123456789", Gender::MALE,
+                       "1990-01-01", "123 Test St", "None");
+    }
+
+    // Patients currently in the data file
+    size_t storedCount()
+    {
+        return FileHelper::readLines(TEST_DATA_FILE).size();
+    }
+}
+
+class WriteBehindFlusherTest : public ::testing::Test
+{
+protected:
+    PatientRepository *repo;
+
+    void SetUp() override
+    {
+        std::filesystem::create_directories("test/fixtures");
+        removeFiles();
+        openRepository();
+        repo->clear();
+    }
+
+    void TearDown() override
+    {
+        PatientRepository::resetInstance();
+        removeFiles();
+    }
+
+    void openRepository()
+    {
+        PatientRepository::resetInstance();
+        repo = PatientRepository::getInstance();
+        repo->setFilePath(TEST_DATA_FILE);
+    }
+
+    static void removeFiles()
+    {
+        std::filesystem::remove(TEST_DATA_FILE);
+        std::filesystem::remove(Journal::getJournalPath(TEST_DATA_FILE));
+    }
+};
+
+// ==================== Flusher ====================
+
+TEST_F(WriteBehindFlusherTest, Schedule_RunsAfterDelay)
+{
+    std::atomic<int> runs{0};
+    int owner = 0;
+
+    WriteBehindFlusher::getInstance()->schedule(&owner, 20ms, [&runs]
+                                                { ++runs; });
+    EXPECT_EQ(runs, 0);
+
+    for (int i = 0; i < 200 && runs == 0; ++i)
+    {
+        std::this_thread::sleep_for(5ms);
+    }
+    EXPECT_EQ(runs, 1);
+}
+
+TEST_F(WriteBehindFlusherTest, Schedule_SameOwner_RunsOnce)
+{
+    std::atomic<int> runs{0};
+    int owner = 0;
+    auto *flusher = WriteBehindFlusher::getInstance();
+
+    flusher->schedule(&owner, 1h, [&runs]
+                      { ++runs; });
+    flusher->schedule(&owner, 1h, [&runs]
+                      { ++runs; });
+    EXPECT_EQ(flusher->getScheduledCount(), 1u);
+
+    flusher->flushAll();
+    EXPECT_EQ(runs, 1);
+    EXPECT_EQ(flusher->getScheduledCount(), 0u);
+}
+
+TEST_F(WriteBehindFlusherTest, Cancel_DropsScheduledFlush)
+{
+    std::atomic<int> runs{0};
+    int owner = 0;
+    auto *flusher = WriteBehindFlusher::getInstance();
+
+    flusher->schedule(&owner, 1h, [&runs]
+                      { ++runs; });
+    flusher->cancel(&owner);
+    flusher->flushAll();
+
+    EXPECT_EQ(runs, 0);
+}
+
+// ==================== Repository Write-Behind ====================
+
+TEST_F(WriteBehindFlusherTest, Repository_DefersUntilFlush)
+{
+    repo->setDurabilityPolicy(DurabilityPolicy::writeBehind(1h, 100));
+
+    for (int i = 1; i <= 3; ++i)
+    {
+        ASSERT_TRUE(repo->add(makePatient(i)));
+    }
+    EXPECT_EQ(repo->getPendingChangeCount(), 3u);
+    EXPECT_EQ(repo->count(), 3u);
+    EXPECT_EQ(storedCount(), 0u);
+
+    EXPECT_TRUE(repo->flush());
+    EXPECT_EQ(repo->getPendingChangeCount(), 0u);
+    EXPECT_EQ(storedCount(), 3u);
+}
+
+TEST_F(WriteBehindFlusherTest, Repository_MaxPendingTriggersFlush)
+{
+    repo->setDurabilityPolicy(DurabilityPolicy::writeBehind(1h, 3));
+
+    repo->add(makePatient(1));
+    repo->add(makePatient(2));
+    EXPECT_EQ(storedCount(), 0u);
+
+    repo->add(makePatient(3));
+    EXPECT_EQ(repo->getPendingChangeCount(), 0u);
+    EXPECT_EQ(storedCount(), 3u);
+}
+
+TEST_F(WriteBehindFlusherTest, Repository_IntervalElapsed_FlushedInBackground)
+{
+    repo->setDurabilityPolicy(DurabilityPolicy::writeBehind(20ms, 100));
+
+    repo->add(makePatient(1));
+
+    for (int i = 0; i < 200 && repo->getPendingChangeCount() > 0; ++i)
+    {
+        std::this_thread::sleep_for(5ms);
+    }
+    EXPECT_EQ(repo->getPendingChangeCount(), 0u);
+    EXPECT_EQ(storedCount(), 1u);
+}
+
+TEST_F(WriteBehindFlusherTest, Repository_JournalMode_AppendsDeferredRecords)
+{
+    repo->setJournalEnabled(true);
+    repo->setDurabilityPolicy(DurabilityPolicy::writeBehind(1h, 100));
+
+    repo->add(makePatient(1));
+    repo->remove("P001");
+    repo->add(makePatient(2));
+    EXPECT_EQ(repo->getJournalRecordCount(), 0u);
+
+    WriteBehindFlusher::getInstance()->flushAll();
+    EXPECT_EQ(repo->getJournalRecordCount(), 3u);
+
+    openRepository();
+    EXPECT_EQ(repo->count(), 1u);
+    EXPECT_TRUE(repo->exists("P002"));
+}
+
+TEST_F(WriteBehindFlusherTest, Repository_DestructorAndLoad_KeepPendingChanges)
+{
+    repo->setDurabilityPolicy(DurabilityPolicy::writeBehind(1h, 100));
+    repo->add(makePatient(1));
+
+    // Reloading writes the deferred change first instead of dropping it
+    ASSERT_TRUE(repo->load());
+    EXPECT_TRUE(repo->exists("P001"));
+
+    repo->add(makePatient(2));
+    openRepository();
+    EXPECT_EQ(repo->count(), 2u);
+}
+
+TEST_F(WriteBehindFlusherTest, Repository_SwitchToSync_FlushesPending)
+{
+    repo->setDurabilityPolicy(DurabilityPolicy::writeBehind(1h, 100));
+    repo->add(makePatient(1));
+
+    repo->setDurabilityPolicy(DurabilityPolicy::sync());
+    EXPECT_EQ(storedCount(), 1u);
+
+    repo->add(makePatient(2));
+    EXPECT_EQ(storedCount(), 2u);
+}
@@ -0,0 +1,105 @@
+#include "common/Types.h"
+#include "model/Appointment.h"
+#include "advance/Prescription.h"
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace HMS;
+
+// ==================== Date Tests ====================
+
+TEST(DateTimeTest, Date_ParseFormatRoundTrip) {
+  for (const char* text : {"1970-01-01", "2000-02-29", "2024-12-31", "1900-01-01", "2100-12-31"}) {
+    auto date = Date::parse(text);
+    ASSERT_TRUE(date.has_value()) << text;
+    EXPECT_EQ(date->toString(), text);
+  }
+}
+
+TEST(DateTimeTest, Date_ParseRejectsMalformedInput) {
+  for (const char* text : {"", "invalid-date", "2024-13-01", "2024-00-10", "2023-02-29",
+                           "2024-04-31", "2024/01/01", "2024-1-01", "1899-12-31", "2024-01-01x"}) {
+    EXPECT_FALSE(Date::parse(text).has_value()) << text;
+  }
+}
+
+TEST(DateTimeTest, Date_ComponentsAndWeekday) {
+  auto date = Date::parse("2024-06-19");
+  ASSERT_TRUE(date.has_value());
+
+  EXPECT_EQ(date->year(), 2024);
+  EXPECT_EQ(date->month(), 6);
+  EXPECT_EQ(date->day(), 19);
+  EXPECT_EQ(date->weekday(), 2);  // Wednesday
+  EXPECT_EQ(Date::parse("1969-12-28")->weekday(), 6);  // Sunday before the epoch
+}
+
+TEST(DateTimeTest, Date_ArithmeticCrossesMonthsAndYears) {
+  EXPECT_EQ(Date::parse("2024-02-28")->addDays(1).toString(), "2024-02-29");
+  EXPECT_EQ(Date::parse("2023-02-28")->addDays(1).toString(), "2023-03-01");
+  EXPECT_EQ(Date::parse("2024-12-29")->addDays(6).toString(), "2025-01-04");
+  EXPECT_EQ(Date::parse("2024-03-01")->addDays(-1).toString(), "2024-02-29");
+  EXPECT_EQ(*Date::parse("2025-01-01") - *Date::parse("2024-01-01"), 366);
+}
+
+TEST(DateTimeTest, Date_OrderingMatchesCalendar) {
+  EXPECT_LT(*Date::parse("2024-01-31"), *Date::parse("2024-02-01"));
+  EXPECT_LT(*Date::parse("1999-12-31"), *Date::parse("2000-01-01"));
+
+  // Invalid dates sort before every valid date and never gain a value
+  EXPECT_LT(Date(), *Date::parse("1900-01-01"));
+  EXPECT_FALSE(Date().addDays(10).isValid());
+  EXPECT_EQ(Date().toString(), "");
+}
+
+// ==================== Time Tests ====================
+
+TEST(DateTimeTest, TimeOfDay_ParseAndFormat) {
+  auto time = TimeOfDay::parse("09:30");
+  ASSERT_TRUE(time.has_value());
+
+  EXPECT_EQ(time->hour(), 9);
+  EXPECT_EQ(time->minute(), 30);
+  EXPECT_EQ(time->minutes(), 570);
+  EXPECT_EQ(time->toString(), "09:30");
+  EXPECT_EQ(TimeOfDay::fromMinutes(23 * 60 + 59).toString(), "23:59");
+}
+
+TEST(DateTimeTest, TimeOfDay_ParseRejectsMalformedInput) {
+  for (const char* text : {"", "25:99", "24:00", "12:60", "9:30", "09-30", "09:3a"}) {
+    EXPECT_FALSE(TimeOfDay::parse(text).has_value()) << text;
+  }
+  EXPECT_LT(*TimeOfDay::parse("23:59"), TimeOfDay());
+}
+
+// ==================== Model Integration Tests ====================
+
+TEST(DateTimeTest, Appointment_CachesParsedDateAndTime) {
+  Model::Appointment appt("APT_DT1", "patient_dt", "DOC_DT", "2024-05-06", "14:15", "Flu", 1000.0);
+
+  EXPECT_EQ(appt.getDateValue(), *Date::parse("2024-05-06"));
+  EXPECT_EQ(appt.getTimeValue(), *TimeOfDay::parse("14:15"));
+
+  appt.setDate("2024-05-07");
+  appt.setTime("08:00");
+  EXPECT_EQ(appt.getDateValue().toString(), "2024-05-07");
+  EXPECT_EQ(appt.getTimeValue().toString(), "08:00");
+}
+
+TEST(DateTimeTest, Appointment_MalformedTextKeepsInvalidValue) {
+  Model::Appointment appt("APT_DT2", "patient_dt", "DOC_DT", "2024-05-06", "14:15", "Flu", 1000.0);
+
+  appt.setDate("invalid-date");
+  appt.setTime("25:99");
+
+  EXPECT_EQ(appt.getDate(), "invalid-date");
+  EXPECT_FALSE(appt.getDateValue().isValid());
+  EXPECT_FALSE(appt.getTimeValue().isValid());
+}
+
+TEST(DateTimeTest, Prescription_CachesParsedDate) {
+  auto presc = Model::Prescription::deserialize("PRE_DT1|APT_DT1|patient_dt|DOC_DT|2024-05-06|Flu||0|");
+  ASSERT_TRUE(presc.has_value());
+
+  EXPECT_EQ(presc->getPrescriptionDateValue(), *Date::parse("2024-05-06"));
+}
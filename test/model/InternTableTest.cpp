@@ -0,0 +1,104 @@
+#include "common/InternTable.h"
+#include "model/Appointment.h"
+#include "advance/Prescription.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace HMS;
+
+// ==================== Intern Table Tests ====================
+
+TEST(InternTableTest, SameString_SharesHandle) {
+  InternedString a(std::string("DOC_INTERN_1"));
+  InternedString b("DOC_INTERN_1");
+
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(a.id(), b.id());
+  EXPECT_EQ(&a.str(), &b.str());
+}
+
+TEST(InternTableTest, DifferentStrings_DifferentHandles) {
+  InternedString a("DOC_INTERN_2");
+  InternedString b("DOC_INTERN_3");
+
+  EXPECT_FALSE(a == b);
+  EXPECT_NE(a.id(), b.id());
+}
+
+TEST(InternTableTest, DefaultConstructed_IsEmptyWithHandleZero) {
+  InternedString empty;
+
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.id(), 0u);
+  EXPECT_EQ(empty, InternedString(""));
+}
+
+TEST(InternTableTest, ComparesWithPlainStrings) {
+  InternedString id("MED_INTERN_1");
+
+  EXPECT_TRUE(id == "MED_INTERN_1");
+  EXPECT_TRUE(id == std::string("MED_INTERN_1"));
+  EXPECT_TRUE(id == std::string_view("MED_INTERN_1"));
+  EXPECT_FALSE(id == "MED_INTERN_2");
+}
+
+TEST(InternTableTest, Lookup_DoesNotAddUnknownStrings) {
+  size_t before = InternTable::instance().size();
+
+  EXPECT_FALSE(InternedString::lookup("NEVER_INTERNED_VALUE").has_value());
+  EXPECT_EQ(InternTable::instance().size(), before);
+
+  InternedString added("LOOKUP_INTERN_1");
+  auto found = InternedString::lookup("LOOKUP_INTERN_1");
+  ASSERT_TRUE(found.has_value());
+  EXPECT_EQ(*found, added);
+}
+
+TEST(InternTableTest, ConcurrentInterning_YieldsOneHandlePerString) {
+  constexpr int THREADS = 4;
+  constexpr int VALUES = 500;
+  std::vector<std::vector<InternId>> ids(THREADS);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < THREADS; ++t) {
+    threads.emplace_back([t, &ids] {
+      for (int i = 0; i < VALUES; ++i) {
+        ids[t].push_back(InternedString("CONCURRENT_" + std::to_string(i)).id());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (int t = 1; t < THREADS; ++t) {
+    EXPECT_EQ(ids[t], ids[0]);
+  }
+  EXPECT_EQ(std::unordered_set<InternId>(ids[0].begin(), ids[0].end()).size(),
+            static_cast<size_t>(VALUES));
+}
+
+// ==================== Model Integration Tests ====================
+
+TEST(InternTableTest, Appointments_ShareDoctorHandle) {
+  Model::Appointment a("APT_I1", "patient_i", "DOC_I", "2024-01-01", "09:00", "Flu", 1000.0);
+  Model::Appointment b("APT_I2", "patient_i", "DOC_I", "2024-01-02", "10:00", "Flu", 1000.0);
+
+  EXPECT_EQ(a.getDoctorHandle(), b.getDoctorHandle());
+  EXPECT_EQ(&a.getDoctorID(), &b.getDoctorID());
+  EXPECT_EQ(a.getPatientHandle(), b.getPatientHandle());
+  EXPECT_EQ(a.getDoctorID(), "DOC_I");
+}
+
+TEST(InternTableTest, PrescriptionItems_InternMedicineID) {
+  auto presc = Model::Prescription::deserialize(
+      "PRE_I1|APT_I1|patient_i|DOC_I|2024-01-01|Flu||0|MED_I:Paracetamol:2:1 tablet:3 days:After meals");
+  ASSERT_TRUE(presc.has_value());
+  ASSERT_EQ(presc->getItems().size(), 1u);
+
+  EXPECT_EQ(presc->getItems()[0].medicineID, InternedString("MED_I"));
+  EXPECT_EQ(presc->getDoctorHandle(), InternedString("DOC_I"));
+}
@@ -0,0 +1,96 @@
+#include "common/Types.h"
+#include "common/Utils.h"
+#include "model/Appointment.h"
+#include "advance/Medicine.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace HMS;
+
+// ==================== Parsing Tests ====================
+
+TEST(MoneyTest, Parse_WholeAndFractionalAmounts) {
+  EXPECT_EQ(Money::parse("150000")->minorUnits(), 15000000);
+  EXPECT_EQ(Money::parse("250000.50")->minorUnits(), 25000050);
+  EXPECT_EQ(Money::parse("15.5")->minorUnits(), 1550);
+  EXPECT_EQ(Money::parse(".75")->minorUnits(), 75);
+  EXPECT_EQ(Money::parse("-5000")->minorUnits(), -500000);
+  EXPECT_EQ(Money::parse("0")->minorUnits(), 0);
+}
+
+TEST(MoneyTest, Parse_RoundsExtraFractionDigits) {
+  EXPECT_EQ(Money::parse("99999.999")->minorUnits(), 10000000);
+  EXPECT_EQ(Money::parse("1.234")->minorUnits(), 123);
+  EXPECT_EQ(Money::parse("1.235")->minorUnits(), 124);
+}
+
+TEST(MoneyTest, Parse_RejectsNonDecimalText) {
+  for (const char* text : {"", "-", ".", "abc", "12a", "1e5", "1.2.3", "1,000", " 100",
+                           "--5", "+-5", "99999999999999999999"}) {
+    EXPECT_FALSE(Money::parse(text).has_value()) << text;
+  }
+}
+
+// ==================== Arithmetic Tests ====================
+
+TEST(MoneyTest, FromDouble_RoundsToMinorUnit) {
+  EXPECT_EQ(Money::fromDouble(999999999.99).minorUnits(), 99999999999);
+  EXPECT_DOUBLE_EQ(Money::fromDouble(999999999.99).toDouble(), 999999999.99);
+  EXPECT_EQ(Money::fromDouble(0.1).minorUnits(), 10);
+  EXPECT_TRUE(Money::fromDouble(std::numeric_limits<double>::quiet_NaN()).isZero());
+}
+
+TEST(MoneyTest, Sum_IsExactAndOrderIndependent) {
+  std::vector<Money> amounts;
+  for (int i = 0; i < 1000; ++i) {
+    amounts.push_back(Money::fromDouble(0.1 * (i % 7) + 123456.01));
+  }
+
+  Money forward;
+  for (Money amount : amounts) forward += amount;
+
+  std::reverse(amounts.begin(), amounts.end());
+  Money backward;
+  for (Money amount : amounts) backward += amount;
+
+  EXPECT_EQ(forward, backward);
+  EXPECT_EQ(Money::fromUnits(5000) * 3 - Money::fromUnits(15000), Money());
+}
+
+// ==================== Formatting Tests ====================
+
+TEST(MoneyTest, ToString_IsExact) {
+  EXPECT_EQ(Money::fromUnits(150000).toString(), "150000");
+  EXPECT_EQ(Money::fromDouble(123456.78).toString(), "123456.78");
+  EXPECT_EQ(Money::fromDouble(250000.50).toString(), "250000.50");
+  EXPECT_EQ(Money::fromDouble(0.05).toString(), "0.05");
+  EXPECT_EQ(Money::fromDouble(-1.5).toString(), "-1.50");
+  EXPECT_EQ(Money::fromMinor(std::numeric_limits<std::int64_t>::min()).toString(),
+            "-92233720368547758.08");
+}
+
+TEST(MoneyTest, FormatMoney_RoundsToWholeDong) {
+  EXPECT_EQ(Utils::formatMoney(Money::fromUnits(500000)), "500000 VND");
+  EXPECT_EQ(Utils::formatMoney(Money::fromDouble(250000.50)), "250001 VND");
+}
+
+// ==================== Model Integration Tests ====================
+
+TEST(MoneyTest, Models_SerializeExactAmountAndParseBack) {
+  Model::Appointment whole("APT_M0", "patient_m", "DOC_M", "2024-01-01", "09:00", "Flu", 150000);
+  EXPECT_NE(whole.serialize().find("|150000|"), std::string::npos);
+
+  Model::Appointment appt("APT_M1", "patient_m", "DOC_M", "2024-01-01", "09:00", "Flu", 250000.50);
+  EXPECT_NE(appt.serialize().find("|250000.50|"), std::string::npos);
+  auto reloaded = Model::Appointment::deserialize(appt.serialize());
+  ASSERT_TRUE(reloaded.has_value());
+  EXPECT_EQ(reloaded->getPriceValue(), Money::fromMinor(25000050));
+
+  auto med = Model::Medicine::deserialize(
+      "MED_M1|Paracetamol|Generic|Cat|Mfg|Desc|5000.25|10|5|2025-12-31|Tablet|500mg");
+  ASSERT_TRUE(med.has_value());
+  EXPECT_EQ(med->getUnitPriceValue(), Money::fromMinor(500025));
+  EXPECT_DOUBLE_EQ(med->getUnitPrice(), 5000.25);
+}
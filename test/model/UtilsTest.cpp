@@ -0,0 +1,61 @@
+#include "common/Utils.h"
+#include <gtest/gtest.h>
+#include <array>
+
+using namespace HMS;
+
+// ==================== Tokenizer Tests ====================
+
+TEST(UtilsTest, SplitView_MatchesSplit) {
+  for (std::string_view line : {"a|b|c", "a||c", "a|b|", "|", "single", ""}) {
+    auto expected = Utils::split(line, '|');
+
+    std::array<std::string_view, 4> parts;
+    size_t count = Utils::splitView(line, '|', parts);
+
+    ASSERT_EQ(count, expected.size()) << line;
+    for (size_t i = 0; i < count; ++i) {
+      EXPECT_EQ(parts[i], expected[i]) << line;
+    }
+  }
+}
+
+TEST(UtilsTest, SplitView_CountsFieldsBeyondCapacity) {
+  std::array<std::string_view, 2> parts;
+  size_t count = Utils::splitView("a|b|c|d", '|', parts);
+
+  EXPECT_EQ(count, 4u);
+  EXPECT_EQ(parts[0], "a");
+  EXPECT_EQ(parts[1], "b");
+}
+
+TEST(UtilsTest, SplitView_ViewsPointIntoInput) {
+  std::string line = "P001|name";
+  std::array<std::string_view, 2> parts;
+  Utils::splitView(line, '|', parts);
+
+  EXPECT_EQ(parts[0].data(), line.data());
+  EXPECT_EQ(parts[1].data(), line.data() + 5);
+}
+
+TEST(UtilsTest, FieldTokenizer_IteratesAllFields) {
+  Utils::FieldTokenizer tokenizer("D001,D002,", ',');
+  std::string_view field;
+  std::vector<std::string> fields;
+  while (tokenizer.next(field)) {
+    fields.emplace_back(field);
+  }
+
+  EXPECT_EQ(fields, (std::vector<std::string>{"D001", "D002", ""}));
+  EXPECT_FALSE(tokenizer.next(field));
+}
+
+TEST(UtilsTest, TrimView_StripsWhitespaceWithoutCopying) {
+  std::string_view input = " \t value \r\n";
+  std::string_view trimmed = Utils::trimView(input);
+
+  EXPECT_EQ(trimmed, "value");
+  EXPECT_EQ(trimmed.data(), input.data() + 3);
+  EXPECT_TRUE(Utils::trimView(" \t ").empty());
+  EXPECT_EQ(Utils::trim("  x  "), "x");
+}